@@ -1,33 +1,51 @@
+#include "ijccrl/core/broadcast/LivePgnPublisher.h"
 #include "ijccrl/core/broadcast/TlcsFeedAdapter.h"
 #include "ijccrl/core/broadcast/TlcsIniAdapter.h"
 #include "ijccrl/core/api/RunnerConfig.h"
+#include "ijccrl/core/api/TournamentHost.h"
+#include "ijccrl/core/distributed/Coordinator.h"
+#include "ijccrl/core/distributed/Worker.h"
 #include "ijccrl/core/export/ExportWriter.h"
 #include "ijccrl/core/game/GameRunner.h"
 #include "ijccrl/core/game/TimeControl.h"
 #include "ijccrl/core/openings/EpdParser.h"
 #include "ijccrl/core/openings/OpeningPolicy.h"
+#include "ijccrl/core/openings/OpeningSource.h"
 #include "ijccrl/core/openings/PgnSuite.h"
+#include "ijccrl/core/persist/CheckpointJournal.h"
 #include "ijccrl/core/persist/CheckpointState.h"
 #include "ijccrl/core/pgn/PgnWriter.h"
+#include "ijccrl/core/runtime/DurationModel.h"
 #include "ijccrl/core/runtime/EnginePool.h"
+#include "ijccrl/core/runtime/JobQueue.h"
 #include "ijccrl/core/runtime/MatchRunner.h"
+#include "ijccrl/core/stats/OpeningStats.h"
+#include "ijccrl/core/stats/Sprt.h"
+#include "ijccrl/core/stats/StandingsSimulator.h"
 #include "ijccrl/core/stats/StandingsTable.h"
-#include "ijccrl/core/tournament/RoundRobinScheduler.h"
+#include "ijccrl/core/stats/TieBreaks.h"
+#include "ijccrl/core/tournament/FixtureGenerator.h"
 #include "ijccrl/core/tournament/SwissScheduler.h"
 #include "ijccrl/core/util/AtomicFileWriter.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 
 #include <nlohmann/json.hpp>
 
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <algorithm>
 #include <condition_variable>
+#include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <mutex>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
@@ -60,12 +78,48 @@ bool AppendTournamentPgn(const std::string& path, const std::string& pgn) {
     return static_cast<bool>(output);
 }
 
-bool WriteLivePgn(const std::string& path, const std::string& pgn) {
-    const std::filesystem::path fs_path(path);
-    if (!fs_path.parent_path().empty()) {
-        std::filesystem::create_directories(fs_path.parent_path());
+nlohmann::json SprtJson(const ijccrl::core::stats::Sprt::Snapshot& snapshot) {
+    return {
+        {"elo0", snapshot.elo0},
+        {"elo1", snapshot.elo1},
+        {"alpha", snapshot.alpha},
+        {"beta", snapshot.beta},
+        {"llr", snapshot.llr},
+        {"lower_bound", snapshot.lower_bound},
+        {"upper_bound", snapshot.upper_bound},
+        {"status", ijccrl::core::stats::Sprt::StatusName(snapshot.status)},
+        {"pairs", snapshot.pairs},
+        {"pentanomial", snapshot.pentanomial},
+    };
+}
+
+nlohmann::json SearchJson(const ijccrl::core::stats::SearchSummary& search) {
+    return {
+        {"games", search.games},
+        {"searches", search.searches},
+        {"average_depth", search.average_depth},
+        {"min_depth", search.min_depth},
+        {"nps_p10", search.nps_p10},
+        {"nps_p50", search.nps_p50},
+        {"nps_p90", search.nps_p90},
+        {"time_used_seconds", search.time_used_seconds},
+        {"time_allotted_seconds", search.time_allotted_seconds},
+        {"time_usage", search.time_usage()},
+        {"min_margin_ms", search.min_margin_ms},
+    };
+}
+
+nlohmann::json BroadcastLatencyJson(const ijccrl::core::util::BroadcastLatency& broadcast_latency) {
+    nlohmann::json latency = nlohmann::json::object();
+    for (const auto& [stage, summary] : broadcast_latency.Snapshot()) {
+        latency[stage] = {
+            {"count", summary.count},
+            {"p50", summary.p50_ms},
+            {"p99", summary.p99_ms},
+            {"max", summary.max_ms},
+        };
     }
-    return ijccrl::core::util::AtomicFileWriter::Write(path, pgn);
+    return latency;
 }
 
 bool AppendCsvLine(const std::string& path, const std::string& line, bool write_header) {
@@ -115,6 +169,350 @@ std::string FormatUtcTimestamp(std::time_t timestamp) {
     return out.str();
 }
 
+int ConvertCheckpoint(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "Usage: ijccrlcli --convert-checkpoint <input> <output> [json|binary]" << '\n';
+        return 1;
+    }
+    const std::string input_path = argv[2];
+    const std::string output_path = argv[3];
+
+    std::string raw;
+    {
+        std::ifstream input(input_path, std::ios::binary);
+        std::ostringstream buffer;
+        buffer << input.rdbuf();
+        raw = buffer.str();
+    }
+    const bool input_binary = ijccrl::core::persist::IsBinaryCheckpoint(raw);
+    std::string format_name = input_binary ? "json" : "binary";
+    if (argc >= 5) {
+        format_name = argv[4];
+    }
+    if (format_name != "json" && format_name != "binary") {
+        std::cerr << "[ijccrlcli] Unknown checkpoint format: " << format_name << '\n';
+        return 1;
+    }
+
+    ijccrl::core::persist::CheckpointState state;
+    std::string error;
+    const auto load_start = std::chrono::steady_clock::now();
+    if (!ijccrl::core::persist::LoadCheckpoint(input_path, state, &error)) {
+        std::cerr << "[ijccrlcli] " << error << '\n';
+        return 1;
+    }
+    const auto load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                   load_start)
+                             .count();
+    if (!ijccrl::core::persist::SaveCheckpoint(output_path,
+                                               state,
+                                               ijccrl::core::persist::CheckpointFormatFromString(format_name))) {
+        std::cerr << "[ijccrlcli] Failed to write checkpoint: " << output_path << '\n';
+        return 1;
+    }
+    std::cout << "[ijccrlcli] Converted " << (input_binary ? "binary" : "json") << " checkpoint ("
+              << state.completed_games.size() << " completed games, loaded in " << load_ms << " ms) to "
+              << format_name << ": " << output_path << '\n';
+    return 0;
+}
+
+int BenchSwiss(int argc, char** argv) {
+    const int players = argc >= 3 ? std::max(2, std::atoi(argv[2])) : 1000;
+    const int rounds = argc >= 4 ? std::max(1, std::atoi(argv[3])) : 11;
+
+    std::mt19937 rng(20240601u);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> strength(static_cast<size_t>(players));
+    for (auto& value : strength) {
+        value = uniform(rng) * 800.0;
+    }
+
+    std::vector<double> scores(static_cast<size_t>(players), 0.0);
+    ijccrl::core::stats::TieBreaks tie_breaks(static_cast<size_t>(players));
+    const auto tie_break_order = ijccrl::core::stats::TieBreaks::DefaultOrder();
+    std::vector<int> byes;
+    std::vector<ijccrl::core::tournament::SwissColorState> colors(static_cast<size_t>(players));
+    std::unordered_set<long long> played;
+    ijccrl::core::tournament::SwissScheduler scheduler;
+
+    auto update_color = [&colors](int engine_id, int color) {
+        auto& state = colors[static_cast<size_t>(engine_id)];
+        if (state.last_color == color) {
+            state.streak += 1;
+        } else {
+            state.last_color = color;
+            state.streak = 1;
+        }
+    };
+
+    double total_ms = 0.0;
+    double worst_ms = 0.0;
+    int repeats = 0;
+    for (int round = 0; round < rounds; ++round) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto swiss_round = scheduler.BuildSwissRound(
+            round, scores, tie_breaks.Rank(tie_break_order), byes, colors, played, 1, true);
+        const double elapsed_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        total_ms += elapsed_ms;
+        worst_ms = std::max(worst_ms, elapsed_ms);
+
+        for (const auto& fixture : swiss_round.round.fixtures) {
+            const int white = fixture.white_engine_id;
+            const int black = fixture.black_engine_id;
+            const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
+                                  static_cast<unsigned int>(std::max(white, black));
+            if (!played.insert(key).second) {
+                repeats += 1;
+            }
+            update_color(white, 1);
+            update_color(black, -1);
+            const double diff = strength[static_cast<size_t>(white)] - strength[static_cast<size_t>(black)];
+            const double expected = 1.0 / (1.0 + std::pow(10.0, -diff / 400.0));
+            const double roll = uniform(rng);
+            const double white_score = roll < expected * 0.7 ? 1.0 : (roll < expected * 0.7 + 0.3 ? 0.5 : 0.0);
+            scores[static_cast<size_t>(white)] += white_score;
+            scores[static_cast<size_t>(black)] += 1.0 - white_score;
+            tie_breaks.AddGame(white, black, white_score);
+        }
+        if (swiss_round.round.bye_engine_id.has_value()) {
+            byes.push_back(*swiss_round.round.bye_engine_id);
+            scores[static_cast<size_t>(*swiss_round.round.bye_engine_id)] += 1.0;
+            tie_breaks.AddBye(*swiss_round.round.bye_engine_id, 1.0);
+        }
+        std::cout << "[ijccrlcli] round " << (round + 1) << ": " << swiss_round.pairings.size()
+                  << " pairings in " << std::fixed << std::setprecision(1) << elapsed_ms << " ms" << '\n';
+    }
+    std::cout << "[ijccrlcli] Swiss pairing " << players << " players x " << rounds << " rounds: total "
+              << std::fixed << std::setprecision(1) << total_ms << " ms, worst round " << worst_ms
+              << " ms, repeated pairings " << repeats << '\n';
+    return 0;
+}
+
+int BenchOpenings(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: ijccrlcli --bench-openings <suite.epd|suite.pgn> [threads]" << '\n';
+        return 1;
+    }
+    const std::string path = argv[2];
+    const int threads = argc >= 4 ? std::max(1, std::atoi(argv[3])) : 0;
+    std::error_code ec;
+    const auto bytes = std::filesystem::file_size(path, ec);
+    if (ec) {
+        std::cerr << "[ijccrlcli] Cannot read " << path << '\n';
+        return 1;
+    }
+    const bool pgn = std::filesystem::path(path).extension() == ".pgn";
+    const auto load = [&](int count) {
+        return pgn ? ijccrl::core::openings::PgnSuite::LoadFile(path, count)
+                   : ijccrl::core::openings::EpdParser::LoadFile(path, count);
+    };
+
+    const auto measure = [&](int count, size_t* openings) {
+        const auto start = std::chrono::steady_clock::now();
+        *openings = load(count).size();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    const double megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+    size_t single_count = 0;
+    size_t parallel_count = 0;
+    const double single = measure(1, &single_count);
+    const double parallel = measure(threads, &parallel_count);
+    std::cout << std::fixed << std::setprecision(1) << "[ijccrlcli] " << path << ": " << megabytes << " MB, "
+              << parallel_count << " openings" << '\n'
+              << "[ijccrlcli] 1 thread: " << single * 1000.0 << " ms, " << megabytes / single << " MB/s" << '\n'
+              << "[ijccrlcli] " << (threads > 0 ? std::to_string(threads) : std::string("all")) << " threads: "
+              << parallel * 1000.0 << " ms, " << megabytes / parallel << " MB/s" << '\n';
+    if (single_count != parallel_count) {
+        std::cerr << "[ijccrlcli] Parallel load returned " << parallel_count << " openings, expected "
+                  << single_count << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+int ExportOpeningStats(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: ijccrlcli --opening-stats <opening_stats.bin> [output.csv]" << '\n';
+        return 1;
+    }
+    if (!std::filesystem::exists(argv[2])) {
+        std::cerr << "[ijccrlcli] Cannot read " << argv[2] << '\n';
+        return 1;
+    }
+    ijccrl::core::stats::OpeningStats stats;
+    std::string error;
+    if (!stats.Open(argv[2], &error)) {
+        std::cerr << "[ijccrlcli] " << error << '\n';
+        return 1;
+    }
+    const auto csv = ijccrl::core::stats::OpeningStats::FormatCsv(stats.Totals());
+    if (argc < 4) {
+        std::cout << csv;
+        return 0;
+    }
+    if (!ijccrl::core::util::AtomicFileWriter::Write(argv[3], csv)) {
+        std::cerr << "[ijccrlcli] Failed to write " << argv[3] << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+int RunWorker(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: ijccrlcli --worker <host:port|unix:path> [--slots N] [--name NAME] [--token TOKEN]"
+                  << '\n';
+        return 1;
+    }
+    ijccrl::core::distributed::Worker::Options options;
+    options.address = argv[2];
+    if (const char* token = std::getenv("IJCCRL_TOKEN")) {
+        options.token = token;
+    }
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const std::string arg = argv[i];
+        if (arg == "--slots") {
+            options.slots = std::max(1, std::atoi(argv[i + 1]));
+        } else if (arg == "--name") {
+            options.name = argv[i + 1];
+        } else if (arg == "--token") {
+            options.token = argv[i + 1];
+        }
+    }
+
+    std::atomic<bool> stop{false};
+    ijccrl::core::distributed::Worker worker(options,
+                                             [](const std::string& line) { std::cout << line << '\n'; });
+    std::string error;
+    if (!worker.Run(stop, &error)) {
+        std::cerr << "[ijccrlcli] " << error << '\n';
+        return 1;
+    }
+    std::cout << "[ijccrlcli] Worker finished." << '\n';
+    return 0;
+}
+
+int RunHost(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "Usage: ijccrlcli --host <cores> [--resume] <config.json>[@weight] ..." << '\n';
+        return 1;
+    }
+    const int cores = std::max(1, std::atoi(argv[2]));
+    ijccrl::core::api::TournamentHost host(cores);
+    bool resume = false;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--resume") {
+            resume = true;
+            continue;
+        }
+        double weight = 1.0;
+        const auto at = arg.rfind('@');
+        if (at != std::string::npos) {
+            weight = std::atof(arg.c_str() + at + 1);
+            arg.resize(at);
+        }
+        RunnerConfig config;
+        std::string error;
+        if (!RunnerConfig::LoadFromFile(arg, config, &error)) {
+            std::cerr << "[ijccrlcli] " << error << '\n';
+            return 1;
+        }
+        if (host.admit(arg, config, weight, &error) < 0) {
+            std::cerr << "[ijccrlcli] " << error << '\n';
+            return 1;
+        }
+        std::cout << "[ijccrlcli] Admitted " << arg << " with weight " << weight << '\n';
+    }
+    if (host.eventCount() == 0) {
+        std::cerr << "[ijccrlcli] No configs to host." << '\n';
+        return 1;
+    }
+
+    std::cout << "[ijccrlcli] Hosting " << host.eventCount() << " events on " << cores << " cores" << '\n';
+    host.startAll(resume);
+    // Give every runner a moment to flag itself running before polling.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    auto last_status = std::chrono::steady_clock::now();
+    while (true) {
+        const auto events = host.getEventsSnapshot();
+        bool any_running = false;
+        for (const auto& event : events) {
+            any_running = any_running || event.state.running;
+        }
+        if (!any_running) {
+            break;
+        }
+        if (std::chrono::steady_clock::now() - last_status >= std::chrono::seconds(5)) {
+            last_status = std::chrono::steady_clock::now();
+            std::ostringstream line;
+            line << "[ijccrlcli] cores in use:";
+            for (const auto& event : events) {
+                line << ' ' << event.name << '=' << event.slots_in_use << (event.state.running ? "" : " (done)");
+            }
+            std::cout << line.str() << '\n';
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    host.waitForFinish();
+
+    for (int i = 0; i < static_cast<int>(host.eventCount()); ++i) {
+        auto& service = host.event(i);
+        const auto name = host.getEventsSnapshot()[static_cast<size_t>(i)].name;
+        std::cout << "[ijccrlcli] === " << name << " ===" << '\n' << service.getLastLogLines(20) << '\n';
+        for (const auto& row : service.getStandingsSnapshot()) {
+            std::cout << "[ijccrlcli] " << name << ": " << row.name << ' ' << row.points << '/' << row.games << '\n';
+        }
+    }
+    return 0;
+}
+
+int EngineIdByName(const std::vector<std::string>& engine_names, const std::string& name) {
+    for (size_t i = 0; i < engine_names.size(); ++i) {
+        if (engine_names[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+std::vector<ijccrl::core::stats::TieBreak> ResolveTieBreaks(const RunnerConfig& config,
+                                                           std::vector<std::string>* unknown) {
+    std::vector<ijccrl::core::stats::TieBreak> order;
+    for (const auto& name : config.tournament.tie_breaks) {
+        ijccrl::core::stats::TieBreak tie_break;
+        if (ijccrl::core::stats::TieBreaks::Parse(name, &tie_break)) {
+            order.push_back(tie_break);
+        } else if (unknown) {
+            unknown->push_back(name);
+        }
+    }
+    return order;
+}
+
+double DefaultGameSeconds(const RunnerConfig& config) {
+    constexpr double kTypicalPlies = 80.0;
+    if (config.time_control.move_time_ms > 0) {
+        return kTypicalPlies * config.time_control.move_time_ms / 1000.0;
+    }
+    return 2.0 * config.time_control.base_seconds + kTypicalPlies * config.time_control.increment_seconds;
+}
+
+// Opening stats key an event by its checkpoint file, which stays the same
+// when the config is edited between runs.
+std::string OpeningStatsEvent(const RunnerConfig& config) {
+    if (config.output.checkpoint_json.empty()) {
+        return ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(config));
+    }
+    std::error_code ec;
+    const auto path = std::filesystem::absolute(config.output.checkpoint_json, ec);
+    return (ec ? std::filesystem::path(config.output.checkpoint_json) : path).lexically_normal().generic_string();
+}
+
+int PairedGamesPerPairing(int games_per_pairing) {
+    return std::max(2, games_per_pairing + games_per_pairing % 2);
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -123,6 +521,25 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (std::string(argv[1]) == "--convert-checkpoint") {
+        return ConvertCheckpoint(argc, argv);
+    }
+    if (std::string(argv[1]) == "--bench-swiss") {
+        return BenchSwiss(argc, argv);
+    }
+    if (std::string(argv[1]) == "--bench-openings") {
+        return BenchOpenings(argc, argv);
+    }
+    if (std::string(argv[1]) == "--opening-stats") {
+        return ExportOpeningStats(argc, argv);
+    }
+    if (std::string(argv[1]) == "--worker") {
+        return RunWorker(argc, argv);
+    }
+    if (std::string(argv[1]) == "--host") {
+        return RunHost(argc, argv);
+    }
+
     bool resume = false;
     bool fresh = false;
     std::string config_path;
@@ -174,6 +591,7 @@ int main(int argc, char** argv) {
     const auto& opening_config = runner_config.openings;
     const auto& output_config = runner_config.output;
 
+    ijccrl::core::util::BroadcastLatency broadcast_latency;
     std::unique_ptr<ijccrl::core::broadcast::IBroadcastAdapter> pgn_adapter;
     std::unique_ptr<ijccrl::core::broadcast::TlcsFeedAdapter> feed_adapter;
     std::string site_tag;
@@ -194,6 +612,7 @@ int main(int argc, char** argv) {
         tlcs_config.format = runner_config.broadcast.tlcs.format;
         tlcs_config.auto_write_server_ini = runner_config.broadcast.tlcs.auto_write_server_ini;
         auto tlcs = std::make_unique<ijccrl::core::broadcast::TlcsFeedAdapter>();
+        tlcs->set_broadcast_latency(&broadcast_latency);
         if (!tlcs->Configure(tlcs_config)) {
             std::cerr << "[ijccrlcli] Failed to configure TLCS feed adapter." << '\n';
             return 1;
@@ -207,6 +626,20 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    ijccrl::core::broadcast::LivePgnPublisher::Config live_config;
+    live_config.live_pgn_path = output_config.live_pgn;
+    live_config.board_files = output_config.live_board_files;
+    live_config.max_rate_hz = output_config.live_max_rate_hz;
+    live_config.latency = &broadcast_latency;
+    ijccrl::core::broadcast::LivePgnPublisher live_publisher(
+        live_config,
+        [&pgn_adapter](const std::string& live_pgn) {
+            if (pgn_adapter) {
+                pgn_adapter->PublishLivePgn(live_pgn);
+            }
+        });
+    live_publisher.Start();
+
     if (draw_by_repetition) {
         std::cout << "[ijccrlcli] draw_by_repetition requested (not yet enforced)." << '\n';
     }
@@ -230,6 +663,25 @@ int main(int argc, char** argv) {
         [](const std::string& line) { std::cout << line << '\n'; });
     pool.set_handshake_timeout_ms(runner_config.watchdog.handshake_timeout_ms);
     pool.set_watchdog_enabled(runner_config.watchdog.enabled);
+    // Every gauntlet fixture includes a gauntlet engine and every SPRT game
+    // pairs the first two engines; with one process each they would cap the
+    // event at one game per such engine.
+    std::vector<int> gauntlet_ids;
+    if (runner_config.tournament.mode == "gauntlet") {
+        std::vector<std::string> unknown_engines;
+        gauntlet_ids = ResolveGauntletEngines(runner_config, &unknown_engines);
+        for (const auto& name : unknown_engines) {
+            std::cout << "[ijccrlcli] Unknown gauntlet engine: " << name << '\n';
+        }
+        const int opponents = static_cast<int>(runner_config.engines.size() - gauntlet_ids.size());
+        for (const int engine_id : gauntlet_ids) {
+            pool.set_instances(engine_id,
+                               std::max(1, std::min(runner_config.tournament.concurrency, opponents)));
+        }
+    } else if (runner_config.tournament.mode == "sprt" && runner_config.engines.size() >= 2) {
+        pool.set_instances(0, std::max(1, runner_config.tournament.concurrency));
+        pool.set_instances(1, std::max(1, runner_config.tournament.concurrency));
+    }
     {
         std::ostringstream message;
         message << "[watchdog] enabled=" << std::boolalpha << runner_config.watchdog.enabled
@@ -237,33 +689,110 @@ int main(int argc, char** argv) {
                 << " go_timeout_ms=" << runner_config.watchdog.go_timeout_ms;
         std::cout << message.str() << '\n';
     }
-    if (!pool.StartAll("")) {
+    // With a coordinator the workers start their own engines.
+    if (runner_config.distributed.listen.empty() && !pool.StartAll("")) {
         std::cerr << "[ijccrlcli] Failed to start engine pool." << '\n';
         return 1;
     }
 
-    std::vector<ijccrl::core::openings::Opening> openings;
-    if (!opening_config.path.empty()) {
-        if (opening_config.type == "epd") {
-            openings = ijccrl::core::openings::EpdParser::LoadFile(opening_config.path);
-        } else if (opening_config.type == "pgn") {
-            openings = ijccrl::core::openings::PgnSuite::LoadFile(opening_config.path);
+    ijccrl::core::persist::CheckpointState checkpoint_state;
+    const std::string checkpoint_path = output_config.checkpoint_json;
+    ijccrl::core::runtime::DurationModel duration_model(DefaultGameSeconds(runner_config));
+    const std::string durations_path = ijccrl::core::runtime::DurationModel::PathFor(checkpoint_path);
+    if (std::filesystem::exists(durations_path)) {
+        std::string error;
+        if (!duration_model.Load(durations_path, &error)) {
+            std::cout << "[ijccrlcli] " << error << '\n';
+        }
+    }
+    const std::string config_hash =
+        ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(runner_config));
+    bool has_checkpoint = false;
+    if (resume && !fresh && std::filesystem::exists(checkpoint_path)) {
+        std::string error;
+        if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
+            if (checkpoint_state.config_hash == config_hash) {
+                has_checkpoint = true;
+                std::cout << "[ijccrlcli] Resuming from checkpoint." << '\n';
+                if (!checkpoint_state.active_games.empty()) {
+                    std::cout << "[ijccrlcli] Active games will continue from their last journaled move." << '\n';
+                }
+            } else {
+                std::cout << "[ijccrlcli] Checkpoint config mismatch; starting fresh." << '\n';
+            }
+        } else {
+            std::cout << "[ijccrlcli] Failed to load checkpoint: " << error << '\n';
+        }
+    }
+
+    // Openings are decoded on demand through the suite's offset index.
+    ijccrl::core::openings::OpeningSource openings;
+    if (!opening_config.path.empty() &&
+        (opening_config.type == "epd" || opening_config.type == "pgn" || opening_config.type == "polyglot")) {
+        ijccrl::core::openings::OpeningSource::Options opening_options;
+        opening_options.dedupe = opening_config.dedupe;
+        opening_options.position_ids = opening_config.position_ids;
+        opening_options.book_lines = static_cast<size_t>(std::max(1, opening_config.book_lines));
+        opening_options.book_depth = std::max(1, opening_config.book_depth);
+        opening_options.book_seed = static_cast<uint32_t>(opening_config.seed);
+        std::string opening_error;
+        if (openings.Open(opening_config.path, opening_config.type, opening_options, &opening_error)) {
+            std::cout << "[ijccrlcli] " << openings.size() << " openings loaded, " << openings.duplicates_removed()
+                      << " duplicate positions removed" << '\n';
+        } else {
+            std::cerr << "[ijccrlcli] " << opening_error << '\n';
         }
     }
     if (openings.empty()) {
         ijccrl::core::openings::Opening startpos;
         startpos.id = "startpos";
-        openings.push_back(startpos);
+        openings.Assign({startpos});
     }
-    if (opening_config.seed != 0) {
-        std::mt19937 rng(static_cast<uint32_t>(opening_config.seed));
-        std::shuffle(openings.begin(), openings.end(), rng);
+    // Results per opening accumulate across events. The openings the bias check
+    // skips are saved in the checkpoint and skipped again on resume, whatever
+    // the shared stats have recorded since.
+    const std::string stats_event = OpeningStatsEvent(runner_config);
+    std::vector<std::string> excluded_openings;
+    ijccrl::core::stats::OpeningStats opening_stats;
+    if (!output_config.opening_stats.empty()) {
+        std::string stats_error;
+        if (!opening_stats.Open(output_config.opening_stats, &stats_error)) {
+            std::cerr << "[ijccrlcli] " << stats_error << '\n';
+        }
+    }
+    if (has_checkpoint && !checkpoint_state.excluded_openings.empty()) {
+        excluded_openings = checkpoint_state.excluded_openings;
+        const std::unordered_set<std::string> excluded(excluded_openings.begin(), excluded_openings.end());
+        const size_t skipped = openings.Exclude([&](const ijccrl::core::openings::Opening& opening) {
+            return excluded.count(opening.id) > 0;
+        });
+        std::cout << "[ijccrlcli] " << skipped << " openings skipped, as saved in the checkpoint" << '\n';
+    } else if (!has_checkpoint && opening_stats.is_open() && opening_config.max_bias > 0.0) {
+        const auto totals = opening_stats.Totals(stats_event);
+        const size_t skipped = openings.Exclude([&](const ijccrl::core::openings::Opening& opening) {
+            const auto it = totals.find(opening.id);
+            const bool unbalanced = it != totals.end() && it->second.games() >= opening_config.bias_min_games &&
+                                    it->second.bias() > opening_config.max_bias;
+            if (unbalanced) {
+                excluded_openings.push_back(opening.id);
+            }
+            return unbalanced;
+        });
+        std::cout << "[ijccrlcli] " << skipped << " unbalanced openings skipped" << '\n';
+    }
+    if (opening_config.policy == "random") {
+        openings.Permute(static_cast<std::uint64_t>(opening_config.seed));
+    } else if (opening_config.seed != 0) {
+        openings.Shuffle(static_cast<uint32_t>(opening_config.seed));
     }
 
     if (tournament.mode == "swiss") {
         const std::string event_name = "ijccrl swiss";
         const int engine_count = static_cast<int>(engine_names.size());
-        const int games_per_pairing = std::max(1, tournament.games_per_pairing);
+        const bool paired_openings = tournament.paired_openings;
+        const int games_per_pairing = paired_openings ? PairedGamesPerPairing(tournament.games_per_pairing)
+                                                      : std::max(1, tournament.games_per_pairing);
+        const int opening_games_per_pairing = paired_openings ? 2 : games_per_pairing;
         const int fixtures_per_round = (engine_count / 2) * games_per_pairing;
         int total_rounds = std::max(1, tournament.rounds);
         if (max_games > 0 && fixtures_per_round > 0) {
@@ -278,26 +807,16 @@ int main(int argc, char** argv) {
         std::mutex pause_mutex;
         std::condition_variable pause_cv;
 
-        ijccrl::core::persist::CheckpointState checkpoint_state;
-        const std::string checkpoint_path = output_config.checkpoint_json;
-        const std::string config_hash =
-            ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(runner_config));
-        bool has_checkpoint = false;
-        if (resume && !fresh && std::filesystem::exists(checkpoint_path)) {
-            std::string error;
-            if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
-                if (checkpoint_state.config_hash == config_hash) {
-                    has_checkpoint = true;
-                    std::cout << "[ijccrlcli] Resuming from checkpoint." << '\n';
-                    if (!checkpoint_state.active_games.empty()) {
-                        std::cout << "[ijccrlcli] Active games will be restarted on resume." << '\n';
-                    }
-                } else {
-                    std::cout << "[ijccrlcli] Checkpoint config mismatch; starting fresh." << '\n';
-                }
-            } else {
-                std::cout << "[ijccrlcli] Failed to load checkpoint: " << error << '\n';
+        ijccrl::core::persist::CheckpointJournal journal;
+        if (output_config.checkpoint_journal) {
+            if (!journal.Open(ijccrl::core::persist::JournalPathFor(checkpoint_path),
+                              has_checkpoint ? checkpoint_state.journal_seq : 0,
+                              !has_checkpoint)) {
+                std::cout << "[ijccrlcli] Failed to open checkpoint journal; using full checkpoints." << '\n';
             }
+        } else {
+            std::error_code journal_ec;
+            std::filesystem::remove(ijccrl::core::persist::JournalPathFor(checkpoint_path), journal_ec);
         }
 
         std::vector<int> completed_fixture_indices;
@@ -334,7 +853,6 @@ int main(int argc, char** argv) {
         std::atomic<int> completed_count{static_cast<int>(completed_set.size())};
 
         std::unordered_set<long long> pairings_played_set;
-        std::vector<std::vector<int>> opponent_history(static_cast<size_t>(engine_count));
         for (const auto& pairing : pairings_played) {
             const int white = pairing.white_engine_id;
             const int black = pairing.black_engine_id;
@@ -344,11 +862,14 @@ int main(int argc, char** argv) {
             const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
                                   static_cast<unsigned int>(std::max(white, black));
             pairings_played_set.insert(key);
-            opponent_history[static_cast<size_t>(white)].push_back(black);
-            opponent_history[static_cast<size_t>(black)].push_back(white);
         }
 
         ijccrl::core::stats::StandingsTable standings(engine_names);
+        std::vector<std::string> unknown_tie_breaks;
+        standings.SetTieBreakOrder(ResolveTieBreaks(runner_config, &unknown_tie_breaks));
+        for (const auto& name : unknown_tie_breaks) {
+            std::cout << "[ijccrlcli] Unknown tie-break: " << name << '\n';
+        }
         if (has_checkpoint && !checkpoint_state.standings.empty()) {
             std::vector<ijccrl::core::stats::EngineStats> snapshot;
             snapshot.reserve(engine_names.size());
@@ -371,6 +892,19 @@ int main(int argc, char** argv) {
             }
             standings.LoadSnapshot(snapshot);
         }
+        for (const auto& game : completed_games) {
+            standings.RestoreResult(EngineIdByName(engine_names, game.white),
+                                    EngineIdByName(engine_names, game.black),
+                                    game.result,
+                                    paired_openings ? game.fixture_index / 2 : -1);
+        }
+        if (tournament.bye_points > 0.0) {
+            for (const int bye_engine : bye_history) {
+                standings.RestoreBye(bye_engine, tournament.bye_points);
+            }
+        }
+        standings.UpdateRatings();
+        standings.UpdateRanks();
 
         struct PendingFixture {
             ijccrl::core::tournament::Fixture fixture;
@@ -385,11 +919,29 @@ int main(int argc, char** argv) {
             }
         }
 
+        std::vector<bool> early_paired(static_cast<size_t>(engine_count), false);
+        std::vector<std::pair<int, int>> early_pairings;
+        bool round_paired = false;
+        for (const auto& pending : pending_fixtures) {
+            if (pending.fixture.round_index == current_round) {
+                round_paired = true;
+            } else if (pending.fixture.round_index == current_round + 1) {
+                early_paired[static_cast<size_t>(pending.fixture.white_engine_id)] = true;
+                early_paired[static_cast<size_t>(pending.fixture.black_engine_id)] = true;
+                if (pending.fixture.game_index_within_pairing == 0) {
+                    early_pairings.emplace_back(pending.fixture.white_engine_id, pending.fixture.black_engine_id);
+                }
+            }
+        }
+
         std::unordered_map<long long, int> pairing_games_completed;
         std::unordered_map<long long, int> pairing_games_total;
-        if (!pending_fixtures.empty()) {
+        {
             std::unordered_map<long long, int> pending_counts;
             for (const auto& pending : pending_fixtures) {
+                if (completed_set.count(pending.fixture_index) > 0) {
+                    continue;
+                }
                 const int white = pending.fixture.white_engine_id;
                 const int black = pending.fixture.black_engine_id;
                 const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
@@ -402,6 +954,11 @@ int main(int argc, char** argv) {
             }
         }
 
+        ijccrl::core::runtime::JobQueue job_queue;
+        std::mutex overlap_mutex;
+        std::unordered_map<int, std::chrono::steady_clock::time_point> early_started;
+        double overlap_seconds = 0.0;
+
         std::mutex output_mutex;
         std::mutex checkpoint_mutex;
         std::vector<ijccrl::core::persist::ActiveGameMeta> active_games_meta;
@@ -411,20 +968,24 @@ int main(int argc, char** argv) {
         std::atomic<std::time_t> last_game_end_time{0};
         std::atomic<int> disk_write_errors{0};
 
-        const auto live_update = [&](const ijccrl::core::pgn::PgnGame& live_game) {
-            const std::string live_pgn = ijccrl::core::pgn::PgnWriter::Render(live_game);
-            if (pgn_adapter) {
-                pgn_adapter->PublishLivePgn(live_pgn);
-            }
-            if (!WriteLivePgn(output_config.live_pgn, live_pgn)) {
-                disk_write_errors.fetch_add(1);
-            }
+        const auto live_update = [&](const ijccrl::core::runtime::MatchJob&,
+                                     int,
+                                     int board,
+                                     const ijccrl::core::pgn::PgnGame& live_game) {
+            live_publisher.Update(board, live_game);
         };
 
         const auto on_job_event = [&](const ijccrl::core::runtime::MatchJob& job,
                                       int game_number,
                                       bool started) {
             if (started) {
+                {
+                    std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                    auto it = early_started.find(job.fixture_index);
+                    if (it != early_started.end()) {
+                        it->second = std::chrono::steady_clock::now();
+                    }
+                }
                 if (feed_adapter) {
                     ijccrl::core::broadcast::GameInfo info;
                     info.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
@@ -445,6 +1006,11 @@ int main(int argc, char** argv) {
                 active.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
                 active.black = engine_names[static_cast<size_t>(job.fixture.black_engine_id)];
                 active.opening_id = job.opening.id;
+                active.progress = job.resume;
+                journal.AppendStarted(active);
+                if (!job.resume.moves_uci.empty()) {
+                    journal.AppendProgress(game_number, job.fixture_index, job.resume);
+                }
                 active_games_meta.push_back(std::move(active));
             } else {
                 active_games.fetch_sub(1);
@@ -458,6 +1024,19 @@ int main(int argc, char** argv) {
             }
         };
 
+        const auto progress_update = [&](const ijccrl::core::runtime::MatchJob& job,
+                                         int game_number,
+                                         const ijccrl::core::game::GameProgress& progress) {
+            std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+            for (auto& active : active_games_meta) {
+                if (active.game_no == game_number) {
+                    active.progress = progress;
+                    break;
+                }
+            }
+            journal.AppendProgress(game_number, job.fixture_index, progress);
+        };
+
         const auto move_update = [&](const ijccrl::core::runtime::MatchJob&,
                                      int,
                                      const std::string& move_uci,
@@ -468,6 +1047,7 @@ int main(int argc, char** argv) {
         };
 
         std::function<void()> write_checkpoint;
+        std::function<void()> schedule_rounds;
         const auto on_result = [&](const ijccrl::core::runtime::MatchResult& result) {
             const auto& fixture = result.job.fixture;
             const std::string final_pgn = ijccrl::core::pgn::PgnWriter::Render(result.result.pgn);
@@ -490,7 +1070,19 @@ int main(int argc, char** argv) {
                 disk_write_errors.fetch_add(1);
             }
 
-            standings.RecordResult(fixture.white_engine_id, fixture.black_engine_id, result.result.state.result);
+            standings.RecordResult(fixture.white_engine_id,
+                                  fixture.black_engine_id,
+                                  result.result.state.result,
+                                  paired_openings ? result.job.fixture_index / 2 : -1);
+            standings.RecordSearch(fixture.white_engine_id, result.result.white_search);
+            standings.RecordSearch(fixture.black_engine_id, result.result.black_search);
+            standings.UpdateRatings();
+            standings.UpdateRanks();
+            duration_model.Record(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                                  engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                                  result.job.opening.id,
+                                  static_cast<int>(result.result.state.moves_uci.size()),
+                                  result.duration_seconds);
 
             const auto update_color = [&](int engine_id, int color) {
                 auto& state = color_history[static_cast<size_t>(engine_id)];
@@ -516,20 +1108,22 @@ int main(int argc, char** argv) {
                 entry.white_engine_id = std::min(fixture.white_engine_id, fixture.black_engine_id);
                 entry.black_engine_id = std::max(fixture.white_engine_id, fixture.black_engine_id);
                 pairings_played.push_back(entry);
-                opponent_history[static_cast<size_t>(fixture.white_engine_id)].push_back(fixture.black_engine_id);
-                opponent_history[static_cast<size_t>(fixture.black_engine_id)].push_back(fixture.white_engine_id);
             }
 
-            pending_fixtures.erase(std::remove_if(pending_fixtures.begin(),
-                                                  pending_fixtures.end(),
-                                                  [&](const auto& pending) {
-                                                      return pending.fixture_index == result.job.fixture_index;
-                                                  }),
-                                   pending_fixtures.end());
-            if (pending_fixtures.empty()) {
-                current_round += 1;
-                pairing_games_completed.clear();
-                pairing_games_total.clear();
+            if (completed >= total) {
+                pairing_games_completed.erase(pairing_key);
+                pairing_games_total.erase(pairing_key);
+            }
+            {
+                std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                auto it = early_started.find(result.job.fixture_index);
+                if (it != early_started.end()) {
+                    if (it->second != std::chrono::steady_clock::time_point{}) {
+                        overlap_seconds +=
+                            std::chrono::duration<double>(std::chrono::steady_clock::now() - it->second).count();
+                    }
+                    early_started.erase(it);
+                }
             }
 
             std::ostringstream csv_line;
@@ -546,6 +1140,19 @@ int main(int argc, char** argv) {
                 disk_write_errors.fetch_add(1);
             }
 
+            if (opening_stats.is_open()) {
+                ijccrl::core::stats::OpeningGame stats_game;
+                stats_game.opening_id = result.job.opening.id;
+                stats_game.event = stats_event;
+                stats_game.fixture_index = result.job.fixture_index;
+                stats_game.result = result.result.state.result;
+                stats_game.plies = static_cast<int>(result.result.state.moves_uci.size());
+                stats_game.termination = result.result.state.termination;
+                if (!opening_stats.Record(stats_game)) {
+                    disk_write_errors.fetch_add(1);
+                }
+            }
+
             std::ostringstream log_line;
             log_line << "GAME END #" << result.game_number << " | "
                      << engine_names[static_cast<size_t>(fixture.white_engine_id)] << " vs "
@@ -568,14 +1175,27 @@ int main(int argc, char** argv) {
             results_json["games_played"] = standings.games_played();
             results_json["standings"] = nlohmann::json::array();
             for (const auto& entry : standings.standings()) {
-                results_json["standings"].push_back({
+                nlohmann::json row = {
                     {"name", entry.name},
                     {"pts", entry.points},
                     {"g", entry.games},
                     {"w", entry.wins},
                     {"d", entry.draws},
                     {"l", entry.losses},
-                });
+                    {"elo", entry.elo},
+                    {"elo_error", entry.elo_error},
+                    {"rank", entry.rank},
+                    {"buchholz", entry.buchholz},
+                    {"sonneborn_berger", entry.sonneborn_berger},
+                    {"koya", entry.koya},
+                };
+                if (entry.pairs() > 0) {
+                    row["pentanomial"] = entry.pentanomial;
+                }
+                if (entry.search.games > 0) {
+                    row["search"] = SearchJson(entry.search);
+                }
+                results_json["standings"].push_back(std::move(row));
             }
             if (!ijccrl::core::util::AtomicFileWriter::Write(output_config.results_json,
                                                              results_json.dump(2))) {
@@ -586,6 +1206,14 @@ int main(int argc, char** argv) {
             ijccrl::core::exporter::WriteStandingsHtml(output_config.standings_html,
                                                        event_name,
                                                        standings.standings());
+            ijccrl::core::exporter::WriteCrosstableJson(output_config.crosstable_json,
+                                                       event_name,
+                                                       standings.standings(),
+                                                       standings.crosstable());
+            ijccrl::core::exporter::WriteCrosstableHtml(output_config.crosstable_html,
+                                                       event_name,
+                                                       standings.standings(),
+                                                       standings.crosstable());
             ijccrl::core::exporter::WriteSummaryJson(output_config.summary_json,
                                                      event_name,
                                                      tc_desc.str(),
@@ -605,13 +1233,24 @@ int main(int argc, char** argv) {
                 meta.termination = result.result.state.termination;
                 meta.pgn_offset = pgn_offset;
                 meta.pgn_path = output_config.tournament_pgn;
+                if (journal.is_open() &&
+                    !journal.AppendCompleted(meta,
+                                             fixture.white_engine_id,
+                                             fixture.black_engine_id,
+                                             FormatUtcTimestamp(std::time(nullptr)))) {
+                    disk_write_errors.fetch_add(1);
+                }
                 completed_games.push_back(std::move(meta));
                 completed_set.insert(result.job.fixture_index);
                 completed_count.store(static_cast<int>(completed_set.size()));
             }
+            schedule_rounds();
             last_game_number.store(result.game_number);
             last_game_end_time.store(std::time(nullptr));
-            if (write_checkpoint) {
+            if (write_checkpoint &&
+                (!journal.is_open() ||
+                 journal.completed_since_compaction() >=
+                     static_cast<size_t>(std::max(1, output_config.checkpoint_compact_records)))) {
                 write_checkpoint();
             }
         };
@@ -621,6 +1260,7 @@ int main(int argc, char** argv) {
         control.paused = &paused;
         control.pause_mutex = &pause_mutex;
         control.pause_cv = &pause_cv;
+        control.latency = &broadcast_latency;
 
         const auto watchdog_log = [](const std::string& line) {
             std::cout << line << '\n';
@@ -630,6 +1270,7 @@ int main(int argc, char** argv) {
             ijccrl::core::persist::CheckpointState snapshot;
             snapshot.version = 2;
             snapshot.config_hash = config_hash;
+            snapshot.excluded_openings = excluded_openings;
             snapshot.total_games = total_games;
             snapshot.next_fixture_index = next_fixture_index;
             snapshot.opening_index = next_fixture_index;
@@ -654,12 +1295,17 @@ int main(int argc, char** argv) {
                 std::lock_guard<std::mutex> lock(checkpoint_mutex);
                 snapshot.completed_games = completed_games;
                 snapshot.active_games = active_games_meta;
+                snapshot.journal_seq = journal.last_seq();
                 completed_snapshot.assign(completed_set.begin(), completed_set.end());
             }
             snapshot.completed_fixture_indices = completed_snapshot;
 
-            if (!pending_fixtures.empty()) {
-                const auto& pending = pending_fixtures.front();
+            const auto next_pending =
+                std::find_if(pending_fixtures.begin(), pending_fixtures.end(), [&](const auto& pending) {
+                    return completed_set.count(pending.fixture_index) == 0;
+                });
+            if (next_pending != pending_fixtures.end()) {
+                const auto& pending = *next_pending;
                 snapshot.next_game.fixture_index = pending.fixture_index;
                 snapshot.next_game.white =
                     engine_names[static_cast<size_t>(pending.fixture.white_engine_id)];
@@ -667,7 +1313,7 @@ int main(int argc, char** argv) {
                     engine_names[static_cast<size_t>(pending.fixture.black_engine_id)];
                 snapshot.next_game.opening_id =
                     ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
-                        pending.fixture_index, openings, games_per_pairing)
+                        pending.fixture_index, openings, opening_games_per_pairing)
                         .id;
             }
 
@@ -691,18 +1337,62 @@ int main(int argc, char** argv) {
                 snapshot.standings.push_back(std::move(entry));
             }
 
-            if (!ijccrl::core::persist::SaveCheckpoint(checkpoint_path, snapshot)) {
+            if (!ijccrl::core::persist::SaveCheckpoint(
+                    checkpoint_path,
+                    snapshot,
+                    ijccrl::core::persist::CheckpointFormatFromString(output_config.checkpoint_format))) {
+                disk_write_errors.fetch_add(1);
+            } else if (journal.is_open()) {
+                journal.Compact(snapshot.journal_seq);
+            }
+            if (!duration_model.Save(durations_path)) {
                 disk_write_errors.fetch_add(1);
             }
         };
 
+        std::unique_ptr<ijccrl::core::distributed::Coordinator> coordinator;
+        if (!runner_config.distributed.listen.empty()) {
+            coordinator = std::make_unique<ijccrl::core::distributed::Coordinator>(
+                RunnerConfig::ToJsonString(runner_config),
+                on_result,
+                live_update,
+                move_update,
+                [](const std::string& line) { std::cout << "[ijccrlcli] " << line << '\n'; },
+                on_job_event,
+                progress_update);
+            std::string listen_error;
+            if (!coordinator->Start(runner_config.distributed.listen, runner_config.distributed.token, &listen_error)) {
+                std::cerr << "[ijccrlcli] " << listen_error << '\n';
+                return 1;
+            }
+        }
+
+        // The timers wait on timer_cv so that stopping them does not wait out
+        // a whole interval.
+        std::mutex timer_mutex;
+        std::condition_variable timer_cv;
         std::atomic<bool> checkpoint_running{false};
         std::thread checkpoint_thread;
         if (output_config.checkpoint_interval_seconds > 0) {
             checkpoint_running.store(true);
             checkpoint_thread = std::thread([&]() {
                 while (checkpoint_running.load()) {
-                    std::this_thread::sleep_for(std::chrono::seconds(output_config.checkpoint_interval_seconds));
+                    {
+                        std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                        timer_cv.wait_for(timer_lock,
+                                          std::chrono::seconds(output_config.checkpoint_interval_seconds),
+                                          [&]() { return !checkpoint_running.load(); });
+                    }
+                    if (!checkpoint_running.load()) {
+                        break;
+                    }
+                    // Finished games are already in the journal; snapshots follow
+                    // checkpoint_compact_records.
+                    if (journal.is_open()) {
+                        journal.Flush();
+                        continue;
+                    }
+                    std::lock_guard<std::mutex> lock(output_mutex);
                     write_checkpoint();
                 }
             });
@@ -714,7 +1404,15 @@ int main(int argc, char** argv) {
             metrics_running.store(true);
             metrics_thread = std::thread([&]() {
                 while (metrics_running.load()) {
-                    std::this_thread::sleep_for(std::chrono::seconds(output_config.metrics_interval_seconds));
+                    {
+                        std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                        timer_cv.wait_for(timer_lock,
+                                          std::chrono::seconds(output_config.metrics_interval_seconds),
+                                          [&]() { return !metrics_running.load(); });
+                    }
+                    if (!metrics_running.load()) {
+                        break;
+                    }
                     nlohmann::json metrics;
                     metrics["active_games"] = active_games.load();
                     metrics["queue_remaining"] = total_games - completed_count.load();
@@ -722,7 +1420,24 @@ int main(int argc, char** argv) {
                     metrics["engines_running"] = static_cast<int>(engine_names.size());
                     std::time_t last_time = last_game_end_time.load();
                     metrics["last_game_end_time"] = last_time == 0 ? "" : FormatUtcTimestamp(last_time);
-                    metrics["disk_write_errors_count"] = disk_write_errors.load();
+                    metrics["disk_write_errors_count"] =
+                        disk_write_errors.load() + live_publisher.write_errors();
+                    metrics["live_pgn_writes"] = live_publisher.writes();
+                    metrics["live_pgn_coalesced_updates"] = live_publisher.coalesced_updates();
+                    metrics["broadcast_latency_ms"] = BroadcastLatencyJson(broadcast_latency);
+                    {
+                        std::lock_guard<std::mutex> lock(output_mutex);
+                        nlohmann::json search = nlohmann::json::object();
+                        for (const auto& entry : standings.standings()) {
+                            search[entry.name] = SearchJson(entry.search);
+                        }
+                        metrics["engine_search"] = std::move(search);
+                    }
+                    metrics["worker_idle_seconds"] = job_queue.idle_seconds();
+                    {
+                        std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                        metrics["swiss_overlap_core_seconds"] = overlap_seconds;
+                    }
                     if (!ijccrl::core::util::AtomicFileWriter::Write(output_config.metrics_json,
                                                                      metrics.dump(2))) {
                         disk_write_errors.fetch_add(1);
@@ -761,93 +1476,234 @@ int main(int argc, char** argv) {
                                                         live_update,
                                                         move_update,
                                                         watchdog_log,
-                                                        on_job_event);
+                                                        on_job_event,
+                                                        progress_update);
 
         write_checkpoint();
 
-        while (current_round < total_rounds && !stop_requested.load()) {
-            std::vector<ijccrl::core::runtime::MatchJob> jobs;
-            if (pending_fixtures.empty()) {
-                std::vector<double> scores;
-                scores.reserve(engine_count);
-                for (const auto& entry : standings.standings()) {
-                    scores.push_back(entry.points);
-                }
+        ijccrl::core::tournament::SwissScheduler scheduler;
+        const auto current_scores = [&]() {
+            std::vector<double> scores;
+            scores.reserve(static_cast<size_t>(engine_count));
+            for (const auto& entry : standings.standings()) {
+                scores.push_back(entry.points);
+            }
+            return scores;
+        };
 
-                ijccrl::core::tournament::SwissScheduler scheduler;
-                const auto swiss_round = scheduler.BuildSwissRound(current_round,
-                                                                   scores,
-                                                                   opponent_history,
-                                                                   bye_history,
-                                                                   color_history,
-                                                                   pairings_played_set,
-                                                                   games_per_pairing,
-                                                                   tournament.avoid_repeats);
-
-                const int bye_engine = swiss_round.round.bye_engine_id.value_or(-1);
-                if (bye_engine >= 0) {
-                    if (tournament.bye_points > 0.0) {
-                        standings.RecordBye(bye_engine, tournament.bye_points);
-                    }
-                    bye_history.push_back(bye_engine);
-                    std::cout << "[ijccrlcli] Swiss bye: "
-                              << engine_names[static_cast<size_t>(bye_engine)] << '\n';
+        const auto make_job = [&](const PendingFixture& pending) {
+            ijccrl::core::runtime::MatchJob job;
+            job.fixture = pending.fixture;
+            job.opening = ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
+                pending.fixture_index, openings, opening_games_per_pairing);
+            job.event_name = event_name;
+            job.site_tag = site_tag;
+            job.round_label = std::to_string(pending.fixture.round_index + 1);
+            job.fixture_index = pending.fixture_index;
+            if (has_checkpoint) {
+                const auto* active = ijccrl::core::persist::FindActiveGame(checkpoint_state, job.fixture_index);
+                if (active && active->opening_id == job.opening.id) {
+                    job.resume = active->progress;
                 }
+            }
+            return job;
+        };
 
-                for (const auto& pairing : swiss_round.pairings) {
-                    const long long key = (static_cast<long long>(std::min(pairing.first, pairing.second)) << 32) |
-                                          static_cast<unsigned int>(std::max(pairing.first, pairing.second));
-                    pairing_games_total[key] = games_per_pairing;
+        const bool longest_first = tournament.job_order == "longest_first";
+        const auto add_fixtures = [&](const ijccrl::core::tournament::SwissRound& swiss_round, bool early) {
+            std::vector<ijccrl::core::runtime::MatchJob> batch;
+            batch.reserve(swiss_round.round.fixtures.size());
+            for (const auto& pairing : swiss_round.pairings) {
+                const long long key = (static_cast<long long>(std::min(pairing.first, pairing.second)) << 32) |
+                                      static_cast<unsigned int>(std::max(pairing.first, pairing.second));
+                pairing_games_total[key] = games_per_pairing;
+                if (early) {
+                    early_paired[static_cast<size_t>(pairing.first)] = true;
+                    early_paired[static_cast<size_t>(pairing.second)] = true;
+                    early_pairings.push_back(pairing);
+                }
+            }
+            for (const auto& fixture : swiss_round.round.fixtures) {
+                PendingFixture pending;
+                pending.fixture = fixture;
+                pending.fixture_index = next_fixture_index++;
+                pending_fixtures.push_back(pending);
+                if (early) {
+                    std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                    early_started.emplace(pending.fixture_index, std::chrono::steady_clock::time_point{});
                 }
+                batch.push_back(make_job(pending));
+            }
+            std::vector<size_t> order(batch.size());
+            std::iota(order.begin(), order.end(), 0);
+            if (longest_first) {
+                std::vector<double> predicted;
+                predicted.reserve(batch.size());
+                for (const auto& job : batch) {
+                    predicted.push_back(
+                        duration_model.Predict(engine_names[static_cast<size_t>(job.fixture.white_engine_id)],
+                                               engine_names[static_cast<size_t>(job.fixture.black_engine_id)],
+                                               job.opening.id));
+                }
+                order = ijccrl::core::runtime::LongestFirstOrder(predicted);
+            }
+            for (size_t index : order) {
+                job_queue.Push(std::move(batch[index]));
+            }
+        };
 
-                pending_fixtures.clear();
-                for (const auto& fixture : swiss_round.round.fixtures) {
-                    PendingFixture pending;
-                    pending.fixture = fixture;
-                    pending.fixture_index = next_fixture_index++;
-                    pending_fixtures.push_back(pending);
+        // Called with output_mutex held. Pairs the current round once the
+        // previous one is final and, in overlap mode, pairs settled score
+        // groups of the following round while the current one finishes.
+        schedule_rounds = [&]() {
+            while (!stop_requested.load()) {
+                const bool current_open =
+                    std::any_of(pending_fixtures.begin(), pending_fixtures.end(), [&](const auto& pending) {
+                        return pending.fixture.round_index == current_round &&
+                               completed_set.count(pending.fixture_index) == 0;
+                    });
+                if (round_paired && !current_open) {
+                    pending_fixtures.erase(std::remove_if(pending_fixtures.begin(),
+                                                          pending_fixtures.end(),
+                                                          [&](const auto& pending) {
+                                                              return pending.fixture.round_index <= current_round;
+                                                          }),
+                                           pending_fixtures.end());
+                    if (tournament.swiss_overlap) {
+                        std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                        const auto now = std::chrono::steady_clock::now();
+                        for (const auto& entry : early_started) {
+                            if (entry.second != std::chrono::steady_clock::time_point{}) {
+                                overlap_seconds += std::chrono::duration<double>(now - entry.second).count();
+                            }
+                        }
+                        early_started.clear();
+                        std::ostringstream line;
+                        line << std::fixed << std::setprecision(1) << "[ijccrlcli] Swiss round "
+                             << (current_round + 1) << " complete; early pairings used " << overlap_seconds
+                             << " core-s of round tail so far";
+                        std::cout << line.str() << '\n';
+                    }
+                    current_round += 1;
+                    round_paired = false;
+                    continue;
+                }
+                if (current_round >= total_rounds) {
+                    break;
+                }
+                if (!round_paired) {
+                    const auto swiss_round = scheduler.BuildSwissRound(current_round,
+                                                                       current_scores(),
+                                                                       standings.ranking(),
+                                                                       bye_history,
+                                                                       color_history,
+                                                                       pairings_played_set,
+                                                                       games_per_pairing,
+                                                                       tournament.avoid_repeats,
+                                                                       early_paired);
+
+                    const int bye_engine = swiss_round.round.bye_engine_id.value_or(-1);
+                    if (bye_engine >= 0) {
+                        if (tournament.bye_points > 0.0) {
+                            standings.RecordBye(bye_engine, tournament.bye_points);
+                        }
+                        bye_history.push_back(bye_engine);
+                        std::cout << "[ijccrlcli] Swiss bye: "
+                                  << engine_names[static_cast<size_t>(bye_engine)] << '\n';
+                    }
+                    add_fixtures(swiss_round, false);
+                    early_paired.assign(early_paired.size(), false);
+                    early_pairings.clear();
+                    round_paired = true;
+                    if (journal.is_open()) {
+                        write_checkpoint();
+                    }
+                    continue;
                 }
+                if (tournament.swiss_overlap && current_round + 1 < total_rounds) {
+                    std::vector<double> pending_points(static_cast<size_t>(engine_count), 0.0);
+                    for (const auto& pending : pending_fixtures) {
+                        if (pending.fixture.round_index == current_round &&
+                            completed_set.count(pending.fixture_index) == 0) {
+                            pending_points[static_cast<size_t>(pending.fixture.white_engine_id)] += 1.0;
+                            pending_points[static_cast<size_t>(pending.fixture.black_engine_id)] += 1.0;
+                        }
+                    }
+                    const auto early_round = scheduler.BuildEarlyPairings(current_round + 1,
+                                                                          current_scores(),
+                                                                          pending_points,
+                                                                          early_paired,
+                                                                          standings.ranking(),
+                                                                          color_history,
+                                                                          pairings_played_set,
+                                                                          games_per_pairing,
+                                                                          tournament.avoid_repeats);
+                    if (!early_round.pairings.empty()) {
+                        add_fixtures(early_round, true);
+                        std::ostringstream line;
+                        line << "[ijccrlcli] Swiss round " << (current_round + 2) << ": "
+                             << early_round.pairings.size() << " pairings started early";
+                        std::cout << line.str() << '\n';
+                        if (journal.is_open()) {
+                            write_checkpoint();
+                        }
+                    }
+                }
+                break;
+            }
+            if (stop_requested.load() || current_round >= total_rounds) {
+                job_queue.Close();
             }
+        };
 
-            jobs.reserve(pending_fixtures.size());
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
             for (const auto& pending : pending_fixtures) {
-                if (completed_set.count(pending.fixture_index) > 0) {
-                    continue;
+                if (completed_set.count(pending.fixture_index) == 0) {
+                    job_queue.Push(make_job(pending));
                 }
-                ijccrl::core::runtime::MatchJob job;
-                job.fixture = pending.fixture;
-                job.opening = ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
-                    pending.fixture_index, openings, games_per_pairing);
-                job.event_name = event_name;
-                job.site_tag = site_tag;
-                job.round_label = std::to_string(pending.fixture.round_index + 1);
-                job.fixture_index = pending.fixture_index;
-                jobs.push_back(std::move(job));
-            }
-
-            if (jobs.empty()) {
-                current_round += 1;
-                pending_fixtures.clear();
-                continue;
             }
+            schedule_rounds();
+        }
 
-            match_runner.Run(jobs, tournament.concurrency, control, initial_game_number);
-            initial_game_number = last_game_number.load();
+        control.drain = job_queue.closed_flag();
+        const ijccrl::core::runtime::MatchRunner::JobSource pop_job =
+            [&](size_t, ijccrl::core::runtime::MatchJob& job) { return job_queue.Pop(job, &stop_requested); };
+        if (coordinator) {
+            coordinator->Run(
+                std::numeric_limits<size_t>::max(), pop_job, tournament.concurrency, control, initial_game_number);
+        } else {
+            match_runner.Run(
+                std::numeric_limits<size_t>::max(), pop_job, tournament.concurrency, control, initial_game_number);
         }
 
-        for (size_t i = 0; i < engine_names.size(); ++i) {
-            pool.engine(static_cast<int>(i)).Stop();
+        if (tournament.swiss_overlap) {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << "[ijccrlcli] Swiss overlap: " << overlap_seconds
+                 << " core-s played during round tails, workers idle " << job_queue.idle_seconds() << " core-s";
+            std::cout << line.str() << '\n';
         }
 
+        pool.StopAll();
+        live_publisher.Stop();
+
         write_checkpoint();
         if (checkpoint_running.load()) {
-            checkpoint_running.store(false);
+            {
+                std::lock_guard<std::mutex> timer_lock(timer_mutex);
+                checkpoint_running.store(false);
+            }
+            timer_cv.notify_all();
             if (checkpoint_thread.joinable()) {
                 checkpoint_thread.join();
             }
         }
         if (metrics_running.load()) {
-            metrics_running.store(false);
+            {
+                std::lock_guard<std::mutex> timer_lock(timer_mutex);
+                metrics_running.store(false);
+            }
+            timer_cv.notify_all();
             if (metrics_thread.joinable()) {
                 metrics_thread.join();
             }
@@ -856,39 +1712,43 @@ int main(int argc, char** argv) {
         return 0;
     }
 
-    auto fixtures = ijccrl::core::tournament::RoundRobinScheduler::BuildSchedule(
-        static_cast<int>(runner_config.engines.size()),
-        tournament.double_round_robin,
-        tournament.games_per_pairing,
-        tournament.rounds);
-
-    if (max_games > 0 && static_cast<int>(fixtures.size()) > max_games) {
-        fixtures.resize(static_cast<size_t>(max_games));
+    const bool sprt_mode = tournament.mode == "sprt";
+    const bool gauntlet_mode = tournament.mode == "gauntlet";
+    const bool paired_openings = sprt_mode || gauntlet_mode || tournament.paired_openings;
+    const int games_per_pairing = sprt_mode         ? 2
+                                  : paired_openings ? PairedGamesPerPairing(tournament.games_per_pairing)
+                                                    : tournament.games_per_pairing;
+    const std::string event_name = gauntlet_mode ? "ijccrl gauntlet" : "ijccrl round robin";
+    const int engine_count = static_cast<int>(runner_config.engines.size());
+    const auto schedule =
+        sprt_mode       ? ijccrl::core::tournament::FixtureGenerator::RoundRobin(
+                              2, false, games_per_pairing, std::max(1, tournament.rounds))
+        : gauntlet_mode ? ijccrl::core::tournament::FixtureGenerator::Gauntlet(
+                              engine_count, gauntlet_ids, games_per_pairing, std::max(1, tournament.rounds))
+                        : ijccrl::core::tournament::FixtureGenerator::RoundRobin(
+                              engine_count, tournament.double_round_robin, games_per_pairing, tournament.rounds);
+
+    int total_games = schedule.size();
+    if (max_games > 0 && total_games > max_games) {
+        total_games = max_games;
     }
 
-    auto assigned_openings = ijccrl::core::openings::OpeningPolicy::AssignRoundRobin(
-        fixtures, openings, tournament.games_per_pairing);
+    const int opening_games_per_pairing = paired_openings ? 2 : games_per_pairing;
+    const auto opening_for = [&](int fixture_index) {
+        return ijccrl::core::openings::OpeningPolicy::AssignRoundRobinForIndex(
+            fixture_index, openings, opening_games_per_pairing);
+    };
 
-    ijccrl::core::persist::CheckpointState checkpoint_state;
-    const std::string checkpoint_path = output_config.checkpoint_json;
-    const std::string config_hash =
-        ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(runner_config));
-    bool has_checkpoint = false;
-    if (resume && !fresh && std::filesystem::exists(checkpoint_path)) {
-        std::string error;
-        if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
-            if (checkpoint_state.config_hash == config_hash) {
-                has_checkpoint = true;
-                std::cout << "[ijccrlcli] Resuming from checkpoint." << '\n';
-                if (!checkpoint_state.active_games.empty()) {
-                    std::cout << "[ijccrlcli] Active games will be restarted on resume." << '\n';
-                }
-            } else {
-                std::cout << "[ijccrlcli] Checkpoint config mismatch; starting fresh." << '\n';
-            }
-        } else {
-            std::cout << "[ijccrlcli] Failed to load checkpoint: " << error << '\n';
+    ijccrl::core::persist::CheckpointJournal journal;
+    if (output_config.checkpoint_journal) {
+        if (!journal.Open(ijccrl::core::persist::JournalPathFor(checkpoint_path),
+                          has_checkpoint ? checkpoint_state.journal_seq : 0,
+                          !has_checkpoint)) {
+            std::cout << "[ijccrlcli] Failed to open checkpoint journal; using full checkpoints." << '\n';
         }
+    } else {
+        std::error_code journal_ec;
+        std::filesystem::remove(ijccrl::core::persist::JournalPathFor(checkpoint_path), journal_ec);
     }
 
     std::vector<int> completed_fixture_indices;
@@ -904,23 +1764,33 @@ int main(int argc, char** argv) {
                                           completed_fixture_indices.end());
     std::atomic<int> completed_count{static_cast<int>(completed_set.size())};
 
-    std::vector<ijccrl::core::runtime::MatchJob> jobs;
-    jobs.reserve(fixtures.size());
-    for (size_t i = 0; i < fixtures.size(); ++i) {
-        if (completed_set.count(static_cast<int>(i)) > 0) {
-            continue;
+    std::sort(completed_fixture_indices.begin(), completed_fixture_indices.end());
+    const auto job_source = [&](size_t index, ijccrl::core::runtime::MatchJob& job) {
+        const int fixture_index = static_cast<int>(index);
+        if (std::binary_search(completed_fixture_indices.begin(), completed_fixture_indices.end(), fixture_index)) {
+            return false;
         }
-        ijccrl::core::runtime::MatchJob job;
-        job.fixture = fixtures[i];
-        job.opening = assigned_openings[i];
-        job.event_name = "ijccrl round robin";
+        job.fixture = schedule.At(fixture_index);
+        job.opening = opening_for(fixture_index);
+        job.event_name = event_name;
         job.site_tag = site_tag;
-        job.round_label = std::to_string(fixtures[i].round_index + 1);
-        job.fixture_index = static_cast<int>(i);
-        jobs.push_back(std::move(job));
-    }
+        job.round_label = std::to_string(job.fixture.round_index + 1);
+        job.fixture_index = fixture_index;
+        if (has_checkpoint) {
+            const auto* active = ijccrl::core::persist::FindActiveGame(checkpoint_state, fixture_index);
+            if (active && active->opening_id == job.opening.id) {
+                job.resume = active->progress;
+            }
+        }
+        return true;
+    };
 
     ijccrl::core::stats::StandingsTable standings(engine_names);
+    std::vector<std::string> unknown_tie_breaks;
+    standings.SetTieBreakOrder(ResolveTieBreaks(runner_config, &unknown_tie_breaks));
+    for (const auto& name : unknown_tie_breaks) {
+        std::cout << "[ijccrlcli] Unknown tie-break: " << name << '\n';
+    }
     if (has_checkpoint && !checkpoint_state.standings.empty()) {
         std::vector<ijccrl::core::stats::EngineStats> snapshot;
         snapshot.reserve(engine_names.size());
@@ -943,6 +1813,120 @@ int main(int argc, char** argv) {
         }
         standings.LoadSnapshot(snapshot);
     }
+    for (const auto& game : completed_games) {
+        standings.RestoreResult(EngineIdByName(engine_names, game.white),
+                                EngineIdByName(engine_names, game.black),
+                                game.result,
+                                paired_openings ? game.fixture_index / 2 : -1);
+    }
+    standings.UpdateRatings();
+    standings.UpdateRanks();
+
+    ijccrl::core::stats::Sprt sprt(runner_config.sprt.elo0,
+                                   runner_config.sprt.elo1,
+                                   runner_config.sprt.alpha,
+                                   runner_config.sprt.beta);
+    std::atomic<bool> sprt_drain{false};
+    if (sprt_mode) {
+        if (engine_names.size() > 2) {
+            std::cout << "[ijccrlcli] SPRT mode plays only the first two engines." << '\n';
+        }
+        for (const auto& game : completed_games) {
+            const double score =
+                ijccrl::core::stats::Sprt::GameScore(game.result, game.white == engine_names[0]);
+            if (score >= 0.0) {
+                sprt.RecordGame(game.fixture_index / 2, score);
+            }
+        }
+        if (sprt.status() != ijccrl::core::stats::Sprt::Status::Continue) {
+            sprt_drain.store(true);
+        }
+        std::cout << "[ijccrlcli] " << ijccrl::core::stats::Sprt::Describe(sprt.snapshot()) << '\n';
+    }
+
+    // SPRT stops on its bounds, not at the end of the schedule, so only
+    // round-robin and gauntlet events are simulated.
+    std::unique_ptr<ijccrl::core::stats::StandingsSimulator> simulator;
+    if (!sprt_mode && output_config.simulations > 0) {
+        std::vector<ijccrl::core::stats::SimulatedGame> remaining;
+        for (int i = 0; i < total_games; ++i) {
+            if (completed_set.count(i) == 0) {
+                const auto fixture = schedule.At(i);
+                remaining.push_back({i, fixture.white_engine_id, fixture.black_engine_id});
+            }
+        }
+        const int simulation_threads =
+            output_config.simulation_threads > 0
+                ? output_config.simulation_threads
+                : std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - tournament.concurrency);
+        simulator = std::make_unique<ijccrl::core::stats::StandingsSimulator>(
+            std::move(remaining),
+            output_config.simulations,
+            simulation_threads,
+            static_cast<std::uint64_t>(opening_config.seed));
+        simulator->Update(standings);
+    }
+
+    const auto write_results_json = [&](const ijccrl::core::stats::SimulationResult& simulation) {
+        nlohmann::json results_json;
+        results_json["event"] = event_name;
+        std::ostringstream tc_desc;
+        tc_desc << (time_control.base_ms / 1000) << "+" << (time_control.increment_ms / 1000);
+        results_json["tc"] = tc_desc.str();
+        results_json["mode"] = tournament.mode;
+        results_json["games_played"] = standings.games_played();
+        if (!simulation.empty()) {
+            results_json["simulation"] = {
+                {"simulations", simulation.simulations},
+                {"games_played", simulation.games_played},
+                {"remaining_games", simulation.remaining_games},
+            };
+        }
+        results_json["standings"] = nlohmann::json::array();
+        const auto& engines = standings.standings();
+        for (size_t i = 0; i < engines.size(); ++i) {
+            const auto& entry = engines[i];
+            nlohmann::json row = {
+                {"name", entry.name},
+                {"pts", entry.points},
+                {"g", entry.games},
+                {"w", entry.wins},
+                {"d", entry.draws},
+                {"l", entry.losses},
+                {"elo", entry.elo},
+                {"elo_error", entry.elo_error},
+                {"rank", entry.rank},
+                {"buchholz", entry.buchholz},
+                {"sonneborn_berger", entry.sonneborn_berger},
+                {"koya", entry.koya},
+            };
+            if (entry.pairs() > 0) {
+                row["pentanomial"] = entry.pentanomial;
+            }
+            if (entry.search.games > 0) {
+                row["search"] = SearchJson(entry.search);
+            }
+            if (simulation.engine_count() == engines.size()) {
+                const auto first =
+                    simulation.place_probability.begin() + static_cast<std::ptrdiff_t>(i * engines.size());
+                row["expected_points"] = simulation.expected_points[i];
+                row["place_probability"] =
+                    std::vector<double>(first, first + static_cast<std::ptrdiff_t>(engines.size()));
+            }
+            results_json["standings"].push_back(std::move(row));
+        }
+        const std::filesystem::path results_path(output_config.results_json);
+        if (!results_path.parent_path().empty()) {
+            std::filesystem::create_directories(results_path.parent_path());
+        }
+        std::ofstream results_out(output_config.results_json, std::ios::binary | std::ios::trunc);
+        if (!results_out) {
+            return false;
+        }
+        results_out << results_json.dump(2);
+        return static_cast<bool>(results_out);
+    };
+
     std::mutex output_mutex;
     std::mutex checkpoint_mutex;
     std::vector<ijccrl::core::persist::ActiveGameMeta> active_games_meta;
@@ -950,16 +1934,12 @@ int main(int argc, char** argv) {
     std::atomic<int> disk_write_errors{0};
     std::atomic<int> last_game_number{initial_game_number};
     std::atomic<std::time_t> last_game_end_time{0};
-    const int total_games = static_cast<int>(fixtures.size());
 
-    const auto live_update = [&](const ijccrl::core::pgn::PgnGame& live_game) {
-        const std::string live_pgn = ijccrl::core::pgn::PgnWriter::Render(live_game);
-        if (pgn_adapter) {
-            pgn_adapter->PublishLivePgn(live_pgn);
-        }
-        if (!WriteLivePgn(output_config.live_pgn, live_pgn)) {
-            disk_write_errors.fetch_add(1);
-        }
+    const auto live_update = [&](const ijccrl::core::runtime::MatchJob&,
+                                 int,
+                                 int board,
+                                 const ijccrl::core::pgn::PgnGame& live_game) {
+        live_publisher.Update(board, live_game);
     };
 
     std::function<void()> write_checkpoint;
@@ -1001,7 +1981,33 @@ int main(int argc, char** argv) {
             }
         }
 
-        standings.RecordResult(fixture.white_engine_id, fixture.black_engine_id, result.result.state.result);
+        standings.RecordResult(fixture.white_engine_id,
+                                  fixture.black_engine_id,
+                                  result.result.state.result,
+                                  paired_openings ? result.job.fixture_index / 2 : -1);
+        standings.RecordSearch(fixture.white_engine_id, result.result.white_search);
+        standings.RecordSearch(fixture.black_engine_id, result.result.black_search);
+        standings.UpdateRatings();
+        standings.UpdateRanks();
+        if (simulator) {
+            simulator->Update(standings, result.job.fixture_index);
+        }
+        duration_model.Record(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                              engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                              result.job.opening.id,
+                              static_cast<int>(result.result.state.moves_uci.size()),
+                              result.duration_seconds);
+        if (sprt_mode) {
+            const double score = ijccrl::core::stats::Sprt::GameScore(result.result.state.result,
+                                                                      fixture.white_engine_id == 0);
+            if (score >= 0.0 &&
+                sprt.RecordGame(result.job.fixture_index / 2, score) !=
+                    ijccrl::core::stats::Sprt::Status::Continue &&
+                !sprt_drain.exchange(true)) {
+                std::cout << "[ijccrlcli] " << ijccrl::core::stats::Sprt::Describe(sprt.snapshot())
+                          << "; finishing running games" << '\n';
+            }
+        }
 
         std::ostringstream csv_line;
         csv_line << result.game_number << ','
@@ -1017,6 +2023,19 @@ int main(int argc, char** argv) {
             disk_write_errors.fetch_add(1);
         }
 
+        if (opening_stats.is_open()) {
+            ijccrl::core::stats::OpeningGame stats_game;
+            stats_game.opening_id = result.job.opening.id;
+            stats_game.event = stats_event;
+            stats_game.fixture_index = result.job.fixture_index;
+            stats_game.result = result.result.state.result;
+            stats_game.plies = static_cast<int>(result.result.state.moves_uci.size());
+            stats_game.termination = result.result.state.termination;
+            if (!opening_stats.Record(stats_game)) {
+                disk_write_errors.fetch_add(1);
+            }
+        }
+
         std::ostringstream log_line;
         log_line << "GAME END #" << result.game_number << " | "
                  << engine_names[static_cast<size_t>(fixture.white_engine_id)] << " vs "
@@ -1029,41 +2048,28 @@ int main(int argc, char** argv) {
             disk_write_errors.fetch_add(1);
         }
 
-        nlohmann::json results_json;
-        results_json["event"] = "ijccrl round robin";
-        std::ostringstream tc_desc;
-        tc_desc << (time_control.base_ms / 1000) << "+" << (time_control.increment_ms / 1000);
-        results_json["tc"] = tc_desc.str();
-        results_json["mode"] = tournament.mode;
-        results_json["games_played"] = standings.games_played();
-        results_json["standings"] = nlohmann::json::array();
-        for (const auto& entry : standings.standings()) {
-            results_json["standings"].push_back({
-                {"name", entry.name},
-                {"pts", entry.points},
-                {"g", entry.games},
-                {"w", entry.wins},
-                {"d", entry.draws},
-                {"l", entry.losses},
-            });
-        }
-        const std::filesystem::path results_path(output_config.results_json);
-        if (!results_path.parent_path().empty()) {
-            std::filesystem::create_directories(results_path.parent_path());
-        }
-        std::ofstream results_out(output_config.results_json, std::ios::binary | std::ios::trunc);
-        if (results_out) {
-            results_out << results_json.dump(2);
-        } else {
+        // The simulation of this game's standings is still running; results
+        // carry the last finished one.
+        if (!write_results_json(simulator ? simulator->Latest() : ijccrl::core::stats::SimulationResult{})) {
             disk_write_errors.fetch_add(1);
         }
+        std::ostringstream tc_desc;
+        tc_desc << (time_control.base_ms / 1000) << "+" << (time_control.increment_ms / 1000);
 
         ijccrl::core::exporter::WriteStandingsCsv(output_config.standings_csv, standings.standings());
         ijccrl::core::exporter::WriteStandingsHtml(output_config.standings_html,
-                                                   "ijccrl round robin",
+                                                   event_name,
                                                    standings.standings());
+        ijccrl::core::exporter::WriteCrosstableJson(output_config.crosstable_json,
+                                                   event_name,
+                                                   standings.standings(),
+                                                   standings.crosstable());
+        ijccrl::core::exporter::WriteCrosstableHtml(output_config.crosstable_html,
+                                                   event_name,
+                                                   standings.standings(),
+                                                   standings.crosstable());
         ijccrl::core::exporter::WriteSummaryJson(output_config.summary_json,
-                                                 "ijccrl round robin",
+                                                 event_name,
                                                  tc_desc.str(),
                                                  tournament.mode,
                                                  total_games,
@@ -1081,13 +2087,23 @@ int main(int argc, char** argv) {
             meta.termination = result.result.state.termination;
             meta.pgn_offset = pgn_offset;
             meta.pgn_path = output_config.tournament_pgn;
+            if (journal.is_open() &&
+                !journal.AppendCompleted(meta,
+                                         fixture.white_engine_id,
+                                         fixture.black_engine_id,
+                                         FormatUtcTimestamp(std::time(nullptr)))) {
+                disk_write_errors.fetch_add(1);
+            }
             completed_games.push_back(std::move(meta));
             completed_set.insert(result.job.fixture_index);
             completed_count.store(static_cast<int>(completed_set.size()));
         }
         last_game_number.store(result.game_number);
         last_game_end_time.store(std::time(nullptr));
-        if (write_checkpoint) {
+        if (write_checkpoint &&
+            (!journal.is_open() ||
+             journal.completed_since_compaction() >=
+                 static_cast<size_t>(std::max(1, output_config.checkpoint_compact_records)))) {
             write_checkpoint();
         }
     };
@@ -1116,6 +2132,11 @@ int main(int argc, char** argv) {
             active.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
             active.black = engine_names[static_cast<size_t>(job.fixture.black_engine_id)];
             active.opening_id = job.opening.id;
+            active.progress = job.resume;
+            journal.AppendStarted(active);
+            if (!job.resume.moves_uci.empty()) {
+                journal.AppendProgress(game_number, job.fixture_index, job.resume);
+            }
             active_games_meta.push_back(std::move(active));
         } else {
             active_games.fetch_sub(1);
@@ -1129,6 +2150,19 @@ int main(int argc, char** argv) {
         }
     };
 
+    const auto progress_update = [&](const ijccrl::core::runtime::MatchJob& job,
+                                     int game_number,
+                                     const ijccrl::core::game::GameProgress& progress) {
+        std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+        for (auto& active : active_games_meta) {
+            if (active.game_no == game_number) {
+                active.progress = progress;
+                break;
+            }
+        }
+        journal.AppendProgress(game_number, job.fixture_index, progress);
+    };
+
     const auto move_update = [&](const ijccrl::core::runtime::MatchJob&,
                                  int,
                                  const std::string& move_uci,
@@ -1142,6 +2176,7 @@ int main(int argc, char** argv) {
         ijccrl::core::persist::CheckpointState snapshot;
         snapshot.version = 1;
         snapshot.config_hash = config_hash;
+        snapshot.excluded_openings = excluded_openings;
         snapshot.total_games = total_games;
         snapshot.rng_seed = static_cast<std::uint64_t>(opening_config.seed);
         snapshot.last_game_no = last_game_number.load();
@@ -1153,6 +2188,7 @@ int main(int argc, char** argv) {
             std::lock_guard<std::mutex> lock(checkpoint_mutex);
             snapshot.completed_games = completed_games;
             snapshot.active_games = active_games_meta;
+            snapshot.journal_seq = journal.last_seq();
             completed_snapshot.assign(completed_set.begin(), completed_set.end());
         }
         snapshot.completed_fixture_indices = completed_snapshot;
@@ -1164,11 +2200,11 @@ int main(int argc, char** argv) {
             if (completed_local.count(i) == 0) {
                 snapshot.next_fixture_index = i;
                 snapshot.opening_index = i;
-                const auto& fixture = fixtures[static_cast<size_t>(i)];
+                const auto fixture = schedule.At(i);
                 snapshot.next_game.fixture_index = i;
                 snapshot.next_game.white = engine_names[static_cast<size_t>(fixture.white_engine_id)];
                 snapshot.next_game.black = engine_names[static_cast<size_t>(fixture.black_engine_id)];
-                snapshot.next_game.opening_id = assigned_openings[static_cast<size_t>(i)].id;
+                snapshot.next_game.opening_id = opening_for(i).id;
                 break;
             }
         }
@@ -1185,7 +2221,15 @@ int main(int argc, char** argv) {
             snapshot.standings.push_back(std::move(entry));
         }
 
-        if (!ijccrl::core::persist::SaveCheckpoint(checkpoint_path, snapshot)) {
+        if (!ijccrl::core::persist::SaveCheckpoint(
+                    checkpoint_path,
+                    snapshot,
+                    ijccrl::core::persist::CheckpointFormatFromString(output_config.checkpoint_format))) {
+            disk_write_errors.fetch_add(1);
+        } else if (journal.is_open()) {
+            journal.Compact(snapshot.journal_seq);
+        }
+        if (!duration_model.Save(durations_path)) {
             disk_write_errors.fetch_add(1);
         }
     };
@@ -1197,16 +2241,54 @@ int main(int argc, char** argv) {
     ijccrl::core::runtime::MatchRunner::Control control;
     control.stop = &stop_requested;
     control.paused = &paused;
+    control.drain = &sprt_drain;
     control.pause_mutex = &pause_mutex;
     control.pause_cv = &pause_cv;
+    control.latency = &broadcast_latency;
+
+    std::unique_ptr<ijccrl::core::distributed::Coordinator> coordinator;
+    if (!runner_config.distributed.listen.empty()) {
+        coordinator = std::make_unique<ijccrl::core::distributed::Coordinator>(
+            RunnerConfig::ToJsonString(runner_config),
+            on_result,
+            live_update,
+            move_update,
+            [](const std::string& line) { std::cout << "[ijccrlcli] " << line << '\n'; },
+            on_job_event,
+            progress_update);
+        std::string listen_error;
+        if (!coordinator->Start(runner_config.distributed.listen, runner_config.distributed.token, &listen_error)) {
+            std::cerr << "[ijccrlcli] " << listen_error << '\n';
+            return 1;
+        }
+    }
 
+    // The timers wait on timer_cv so that stopping them does not wait out
+    // a whole interval.
+    std::mutex timer_mutex;
+    std::condition_variable timer_cv;
     std::atomic<bool> checkpoint_running{false};
     std::thread checkpoint_thread;
     if (output_config.checkpoint_interval_seconds > 0) {
         checkpoint_running.store(true);
         checkpoint_thread = std::thread([&]() {
             while (checkpoint_running.load()) {
-                std::this_thread::sleep_for(std::chrono::seconds(output_config.checkpoint_interval_seconds));
+                {
+                    std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                    timer_cv.wait_for(timer_lock,
+                                      std::chrono::seconds(output_config.checkpoint_interval_seconds),
+                                      [&]() { return !checkpoint_running.load(); });
+                }
+                if (!checkpoint_running.load()) {
+                    break;
+                }
+                // Finished games are already in the journal; snapshots follow
+                // checkpoint_compact_records.
+                if (journal.is_open()) {
+                    journal.Flush();
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(output_mutex);
                 write_checkpoint();
             }
         });
@@ -1218,7 +2300,15 @@ int main(int argc, char** argv) {
         metrics_running.store(true);
         metrics_thread = std::thread([&]() {
             while (metrics_running.load()) {
-                std::this_thread::sleep_for(std::chrono::seconds(output_config.metrics_interval_seconds));
+                {
+                    std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                    timer_cv.wait_for(timer_lock,
+                                      std::chrono::seconds(output_config.metrics_interval_seconds),
+                                      [&]() { return !metrics_running.load(); });
+                }
+                if (!metrics_running.load()) {
+                    break;
+                }
                 nlohmann::json metrics;
                 metrics["active_games"] = active_games.load();
                 metrics["queue_remaining"] = total_games - completed_count.load();
@@ -1226,7 +2316,22 @@ int main(int argc, char** argv) {
                 metrics["engines_running"] = static_cast<int>(engine_names.size());
                 std::time_t last_time = last_game_end_time.load();
                 metrics["last_game_end_time"] = last_time == 0 ? "" : FormatUtcTimestamp(last_time);
-                metrics["disk_write_errors_count"] = disk_write_errors.load();
+                metrics["disk_write_errors_count"] =
+                    disk_write_errors.load() + live_publisher.write_errors();
+                metrics["live_pgn_writes"] = live_publisher.writes();
+                metrics["live_pgn_coalesced_updates"] = live_publisher.coalesced_updates();
+                metrics["broadcast_latency_ms"] = BroadcastLatencyJson(broadcast_latency);
+                {
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    nlohmann::json search = nlohmann::json::object();
+                    for (const auto& entry : standings.standings()) {
+                        search[entry.name] = SearchJson(entry.search);
+                    }
+                    metrics["engine_search"] = std::move(search);
+                }
+                if (sprt_mode) {
+                    metrics["sprt"] = SprtJson(sprt.snapshot());
+                }
                 if (!ijccrl::core::util::AtomicFileWriter::Write(output_config.metrics_json,
                                                                  metrics.dump(2))) {
                     disk_write_errors.fetch_add(1);
@@ -1265,19 +2370,100 @@ int main(int argc, char** argv) {
                                                     live_update,
                                                     move_update,
                                                     [](const std::string& line) { std::cout << line << '\n'; },
-                                                    on_job_event);
+                                                    on_job_event,
+                                                    progress_update);
     write_checkpoint();
-    match_runner.Run(jobs, tournament.concurrency, control, initial_game_number);
+    if (!sprt_mode && tournament.job_order == "longest_first") {
+        std::vector<double> predicted(static_cast<size_t>(total_games), 0.0);
+        std::vector<ijccrl::core::runtime::PlannedJob> planned(static_cast<size_t>(total_games));
+        std::vector<size_t> fixture_order;
+        for (int i = 0; i < total_games; ++i) {
+            if (std::binary_search(completed_fixture_indices.begin(), completed_fixture_indices.end(), i)) {
+                continue;
+            }
+            const auto fixture = schedule.At(i);
+            predicted[static_cast<size_t>(i)] =
+                duration_model.Predict(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                                       engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                                       opening_for(i).id);
+            planned[static_cast<size_t>(i)] = {predicted[static_cast<size_t>(i)],
+                                               fixture.white_engine_id,
+                                               fixture.black_engine_id};
+            fixture_order.push_back(static_cast<size_t>(i));
+        }
+        auto order = ijccrl::core::runtime::LongestFirstOrder(predicted);
+        order.erase(std::remove_if(order.begin(),
+                                   order.end(),
+                                   [&](size_t index) {
+                                       return std::binary_search(completed_fixture_indices.begin(),
+                                                                 completed_fixture_indices.end(),
+                                                                 static_cast<int>(index));
+                                   }),
+                    order.end());
+        std::vector<int> instances;
+        for (int engine_id = 0; engine_id < engine_count; ++engine_id) {
+            instances.push_back(pool.instances(engine_id));
+        }
+        const double predicted_makespan =
+            ijccrl::core::runtime::SimulateMakespan(planned, order, tournament.concurrency, instances, true);
+        const double fixture_makespan =
+            ijccrl::core::runtime::SimulateMakespan(planned, fixture_order, tournament.concurrency, instances, false);
+        std::vector<ijccrl::core::runtime::OrderedJob> ordered;
+        ordered.reserve(order.size());
+        for (size_t index : order) {
+            ordered.push_back({index, planned[index].white_id, planned[index].black_id});
+        }
+        const auto run_start = std::chrono::steady_clock::now();
+        if (coordinator) {
+            coordinator->Run(ordered, job_source, tournament.concurrency, control, initial_game_number);
+        } else {
+            match_runner.Run(ordered, job_source, tournament.concurrency, control, initial_game_number);
+        }
+        const double actual_makespan =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(1) << "[ijccrlcli] Longest-first order: predicted makespan "
+             << predicted_makespan << " s (fixture order " << fixture_makespan << " s), actual " << actual_makespan
+             << " s, history " << duration_model.games() << " games";
+        std::cout << line.str() << '\n';
+    } else {
+        if (coordinator) {
+            coordinator->Run(
+                static_cast<size_t>(total_games), job_source, tournament.concurrency, control, initial_game_number);
+        } else {
+            match_runner.Run(
+                static_cast<size_t>(total_games), job_source, tournament.concurrency, control, initial_game_number);
+        }
+    }
+    if (sprt_mode) {
+        std::cout << "[ijccrlcli] " << ijccrl::core::stats::Sprt::Describe(sprt.snapshot()) << '\n';
+    }
+    if (simulator) {
+        simulator->Wait();
+        std::lock_guard<std::mutex> lock(output_mutex);
+        if (!write_results_json(simulator->Latest())) {
+            disk_write_errors.fetch_add(1);
+        }
+    }
+    live_publisher.Stop();
 
     write_checkpoint();
     if (checkpoint_running.load()) {
-        checkpoint_running.store(false);
+        {
+            std::lock_guard<std::mutex> timer_lock(timer_mutex);
+            checkpoint_running.store(false);
+        }
+        timer_cv.notify_all();
         if (checkpoint_thread.joinable()) {
             checkpoint_thread.join();
         }
     }
     if (metrics_running.load()) {
-        metrics_running.store(false);
+        {
+            std::lock_guard<std::mutex> timer_lock(timer_mutex);
+            metrics_running.store(false);
+        }
+        timer_cv.notify_all();
         if (metrics_thread.joinable()) {
             metrics_thread.join();
         }
@@ -21,6 +21,13 @@ struct TournamentConfig {
     int concurrency = 1;
     bool avoid_repeats = true;
     double bye_points = 1.0;
+    std::vector<std::string> gauntlet_engines;
+    bool paired_openings = false;
+    bool swiss_overlap = false;
+    std::string job_order = "fixture";
+    // Applied in order after points: "buchholz", "sonneborn_berger",
+    // "direct_encounter", "koya".
+    std::vector<std::string> tie_breaks = {"buchholz", "sonneborn_berger", "direct_encounter", "koya"};
 };
 
 struct OpeningConfig {
@@ -28,23 +35,44 @@ struct OpeningConfig {
     std::string path;
     std::string policy = "round_robin";
     int seed = 0;
+    // Off by default: dropping duplicate positions renumbers the suite, so
+    // fixtures get different openings than with the plain suite.
+    bool dedupe = false;
+    bool position_ids = false;
+    int book_lines = 1000;
+    int book_depth = 16;
+    double max_bias = 0.0;
+    int bias_min_games = 20;
 };
 
 struct OutputConfig {
     std::string tournament_pgn = "out/tournament.pgn";
     std::string live_pgn = "out/live.pgn";
+    bool live_board_files = true;
+    double live_max_rate_hz = 5.0;
     std::string results_json = "out/results.json";
     std::string pairings_csv = "out/pairings.csv";
     std::string progress_log;
     std::string checkpoint_json = "out/checkpoint.json";
     std::string standings_csv = "out/standings.csv";
     std::string standings_html = "out/standings.html";
+    std::string crosstable_json = "out/crosstable.json";
+    std::string crosstable_html = "out/crosstable.html";
     std::string summary_json = "out/summary.json";
     std::string metrics_json = "out/metrics.json";
+    std::string opening_stats = "out/opening_stats.bin";
     std::string games_dir = "out/games";
     bool write_game_files = false;
     int checkpoint_interval_seconds = 120;
+    bool checkpoint_journal = true;
+    int checkpoint_compact_records = 500;
+    std::string checkpoint_format = "json";
     int metrics_interval_seconds = 5;
+    // Monte-Carlo runs of the remaining fixtures behind results.json
+    // "place_probability"; 0 disables it. 0 threads means the hardware
+    // threads left over by tournament.concurrency (or by the shared core budget).
+    int simulations = 100000;
+    int simulation_threads = 0;
 };
 
 struct BroadcastConfig {
@@ -96,6 +124,13 @@ struct ResignConfig {
     int min_depth = 12;
 };
 
+struct SprtConfig {
+    double elo0 = 0.0;
+    double elo1 = 5.0;
+    double alpha = 0.05;
+    double beta = 0.05;
+};
+
 struct WatchdogConfig {
     bool enabled = true;
     int handshake_timeout_ms = 10000;
@@ -105,6 +140,12 @@ struct WatchdogConfig {
     bool pause_on_unhealthy = true;
 };
 
+struct DistributedConfig {
+    std::string listen;
+    // Shared secret workers must present before they get the config or jobs.
+    std::string token;
+};
+
 struct RunnerConfig {
     std::vector<EngineConfig> engines;
     TimeControlConfig time_control;
@@ -116,11 +157,19 @@ struct RunnerConfig {
     AdjudicationConfig adjudication;
     TablebaseConfig tablebases;
     ResignConfig resign;
+    SprtConfig sprt;
     WatchdogConfig watchdog;
+    DistributedConfig distributed;
 
     static bool LoadFromFile(const std::string& path, RunnerConfig& config, std::string* error);
+    static bool LoadFromString(const std::string& payload, RunnerConfig& config, std::string* error);
     static bool SaveToFile(const std::string& path, const RunnerConfig& config, std::string* error);
     static std::string ToJsonString(const RunnerConfig& config);
 };
 
+// Engine ids of tournament.gauntlet_engines; names not in the config go to
+// unknown. Falls back to engine 0, as FixtureGenerator::Gauntlet does, when
+// no name resolves.
+std::vector<int> ResolveGauntletEngines(const RunnerConfig& config, std::vector<std::string>* unknown);
+
 }  // namespace ijccrl::core::api
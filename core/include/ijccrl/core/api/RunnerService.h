@@ -1,6 +1,9 @@
 #pragma once
 
 #include "ijccrl/core/api/RunnerConfig.h"
+#include "ijccrl/core/runtime/CoreBudget.h"
+#include "ijccrl/core/stats/SearchStats.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -30,6 +33,11 @@ struct RunnerState {
     int concurrency = 1;
     int activeGames = 0;
     std::vector<std::string> currentRoundPairings;
+    bool sprtEnabled = false;
+    double sprtLlr = 0.0;
+    double sprtLowerBound = 0.0;
+    double sprtUpperBound = 0.0;
+    std::string sprtStatus;
 };
 
 struct StandingRow {
@@ -40,6 +48,38 @@ struct StandingRow {
     int losses = 0;
     double points = 0.0;
     double scorePercent = 0.0;
+    double elo = 0.0;
+    double eloError = 0.0;
+    int rank = 0;
+    double buchholz = 0.0;
+    double sonnebornBerger = 0.0;
+    double koya = 0.0;
+    ijccrl::core::stats::SearchSummary search{};
+};
+
+struct CrosstableCell {
+    int wins = 0;
+    int draws = 0;
+    int losses = 0;
+};
+
+// Engines in the same order as getStandingsSnapshot(); cells is row-major
+// and cell (i, j) holds names[i]'s results against names[j].
+struct CrosstableSnapshot {
+    std::vector<std::string> names;
+    std::vector<CrosstableCell> cells;
+};
+
+// Monte-Carlo final places (stats::StandingsSimulator), engines in the same
+// order as getStandingsSnapshot(); placeProbability is row-major engine x
+// place. Empty for Swiss and SPRT events and before the first run finishes.
+struct SimulationSnapshot {
+    int simulations = 0;
+    int gamesPlayed = 0;
+    int remainingGames = 0;
+    std::vector<std::string> names;
+    std::vector<double> placeProbability;
+    std::vector<double> expectedPoints;
 };
 
 class RunnerService {
@@ -58,10 +98,16 @@ public:
     void requestStop();
     void pause();
     void resume();
+    // Blocks until the current run has returned.
+    void waitForFinish();
     bool exportResults(const std::string& directory, std::string* error);
+    // Games then take slots from a budget shared with other runners; set before start().
+    void setCoreBudget(ijccrl::core::runtime::CoreBudget* budget, int client);
 
     RunnerState getStateSnapshot() const;
     std::vector<StandingRow> getStandingsSnapshot() const;
+    CrosstableSnapshot getCrosstableSnapshot() const;
+    SimulationSnapshot getSimulationSnapshot() const;
     std::string getLastLogLines(int n) const;
 
 private:
@@ -81,13 +127,20 @@ private:
 
     mutable std::mutex standings_mutex_;
     std::vector<StandingRow> standings_{};
+    CrosstableSnapshot crosstable_{};
+    SimulationSnapshot simulation_{};
 
     mutable std::mutex log_mutex_;
     std::deque<std::string> log_lines_{};
     size_t max_log_lines_ = 2000;
 
+    ijccrl::core::util::BroadcastLatency broadcast_latency_{};
+
     std::mutex pause_mutex_{};
     std::condition_variable pause_cv_{};
+
+    ijccrl::core::runtime::CoreBudget* core_budget_ = nullptr;
+    int core_budget_client_ = -1;
 };
 
 }  // namespace ijccrl::core::api
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ijccrl/core/api/RunnerConfig.h"
+#include "ijccrl/core/api/RunnerService.h"
+#include "ijccrl/core/runtime/CoreBudget.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ijccrl::core::api {
+
+// Runs several tournaments in one process, each on its own RunnerService, with
+// their games drawn from one weighted CoreBudget. Events must not share any
+// output, checkpoint or listen address.
+class TournamentHost {
+public:
+    struct EventInfo {
+        std::string name;
+        double weight = 1.0;
+        int slots_in_use = 0;
+        RunnerState state;
+    };
+
+    explicit TournamentHost(int cores);
+    ~TournamentHost();
+
+    // Returns the event index, or -1 with error set if the config clashes with an admitted event.
+    int admit(const std::string& name, const RunnerConfig& config, double weight, std::string* error);
+    bool start(int index, bool resume);
+    bool startAll(bool resume);
+    void requestStop();
+    void waitForFinish();
+
+    size_t eventCount() const;
+    RunnerService& event(int index);
+    std::vector<EventInfo> getEventsSnapshot() const;
+    int cores() const { return budget_.capacity(); }
+
+private:
+    struct Event {
+        std::string name;
+        double weight = 1.0;
+        int client = -1;
+        std::vector<std::string> claimed_paths;
+        std::unique_ptr<RunnerService> service;
+    };
+
+    ijccrl::core::runtime::CoreBudget budget_;
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Event>> events_;
+};
+
+}  // namespace ijccrl::core::api
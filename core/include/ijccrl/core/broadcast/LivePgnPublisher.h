@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ijccrl/core/pgn/PgnGame.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ijccrl::core::broadcast {
+
+class LivePgnPublisher {
+public:
+    using FeaturedSink = std::function<void(const std::string&)>;
+
+    struct Config {
+        std::string live_pgn_path;
+        bool board_files = true;
+        double max_rate_hz = 5.0;
+        ijccrl::core::util::BroadcastLatency* latency = nullptr;
+    };
+
+    explicit LivePgnPublisher(Config config, FeaturedSink featured_sink = {});
+    ~LivePgnPublisher();
+
+    void Start();
+    void Stop();
+
+    void Update(int board, const ijccrl::core::pgn::PgnGame& game);
+    void Flush();
+
+    std::string BoardPath(int board) const;
+    int write_errors() const { return write_errors_.load(); }
+    std::uint64_t writes() const { return writes_.load(); }
+    std::uint64_t coalesced_updates() const { return coalesced_.load(); }
+
+private:
+    struct Board {
+        ijccrl::core::pgn::PgnGame game;
+        std::uint64_t version = 0;
+        std::uint64_t flushed_version = 0;
+        bool finished = false;
+        bool has_mark = false;
+        std::chrono::steady_clock::time_point mark{};
+    };
+
+    bool WriteFile(const std::string& path, const std::string& contents);
+    void FlushLoop();
+
+    Config config_;
+    FeaturedSink featured_sink_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<int, Board> boards_;
+    int featured_board_ = -1;
+    bool dirty_ = false;
+
+    std::mutex flush_mutex_;
+    std::string last_featured_text_;
+    std::map<int, std::string> last_board_text_;
+
+    std::thread thread_;
+    bool running_ = false;
+    std::atomic<int> write_errors_{0};
+    std::atomic<std::uint64_t> writes_{0};
+    std::atomic<std::uint64_t> coalesced_{0};
+};
+
+}  // namespace ijccrl::core::broadcast
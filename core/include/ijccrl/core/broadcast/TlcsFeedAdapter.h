@@ -24,6 +24,7 @@ public:
     void OnMove(const std::string& uci_move, const std::string& fen_after_move);
     void OnGameEnd(const GameResult& r, const std::string& final_fen);
 
+    void set_broadcast_latency(ijccrl::core::util::BroadcastLatency* latency);
     const std::string& site() const { return site_; }
 
 private:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ijccrl/core/api/RunnerConfig.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 
 #include <string>
 #include <vector>
@@ -35,6 +36,7 @@ public:
     void OnGameEnd(const GameResult& r, const std::string& final_fen);
     void Flush();
 
+    void set_broadcast_latency(ijccrl::core::util::BroadcastLatency* latency) { latency_ = latency; }
     const std::string& feed_path() const { return feed_path_; }
 
 private:
@@ -65,6 +67,7 @@ private:
     bool open_ = false;
     Format format_ = Format::Tlcv;
     std::string last_fen_;
+    ijccrl::core::util::BroadcastLatency* latency_ = nullptr;
 };
 
 }  // namespace ijccrl::core::broadcast
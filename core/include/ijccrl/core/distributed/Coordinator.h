@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ijccrl/core/distributed/Socket.h"
+#include "ijccrl/core/runtime/MatchRunner.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ijccrl::core::distributed {
+
+// Drop-in replacement for MatchRunner::Run that plays the games on worker
+// processes (`ijccrlcli --worker`). The caller keeps scheduling, standings,
+// checkpoints and outputs; the callbacks fire exactly as they do for a local
+// MatchRunner. A game whose worker disconnects is requeued and resumed from its
+// last reported position on another worker.
+class Coordinator {
+public:
+    using LogFn = std::function<void(const std::string&)>;
+
+    Coordinator(std::string config_payload,
+                ijccrl::core::runtime::MatchRunner::ResultCallback result_callback,
+                ijccrl::core::runtime::MatchRunner::LiveUpdateFn live_update,
+                ijccrl::core::runtime::MatchRunner::MoveUpdateFn move_update,
+                LogFn log,
+                ijccrl::core::runtime::MatchRunner::JobEventFn job_event = {},
+                ijccrl::core::runtime::MatchRunner::ProgressFn progress_update = {});
+    ~Coordinator();
+
+    Coordinator(const Coordinator&) = delete;
+    Coordinator& operator=(const Coordinator&) = delete;
+
+    // Workers whose Hello does not carry token are dropped before they see
+    // the config; an empty token accepts any worker.
+    bool Start(const std::string& listen_address, const std::string& token, std::string* error);
+    void Shutdown();
+
+    // Parallelism comes from the slots announced by connected workers; the
+    // concurrency argument is accepted for symmetry with MatchRunner.
+    void Run(size_t job_count,
+             const ijccrl::core::runtime::MatchRunner::JobSource& source,
+             int concurrency,
+             const ijccrl::core::runtime::MatchRunner::Control& control,
+             int initial_game_number = 0);
+    void Run(const std::vector<ijccrl::core::runtime::OrderedJob>& order,
+             const ijccrl::core::runtime::MatchRunner::JobSource& source,
+             int concurrency,
+             const ijccrl::core::runtime::MatchRunner::Control& control,
+             int initial_game_number = 0);
+
+private:
+    struct WorkerConnection {
+        int id = 0;
+        SocketHandle socket = kInvalidSocket;
+        std::string peer;
+        std::string name;
+        int slots = 0;
+        int busy = 0;
+        bool ready = false;
+        bool alive = true;
+        std::chrono::steady_clock::time_point connected_at;
+        std::mutex write_mutex;
+        std::thread reader;
+    };
+
+    struct InFlightGame {
+        ijccrl::core::runtime::MatchJob job;
+        int game_number = 0;
+        int board = 0;
+        int worker_id = 0;
+    };
+
+    struct PendingGame {
+        ijccrl::core::runtime::MatchJob job;
+        int game_number = 0;
+        bool started = false;
+    };
+
+    void AcceptLoop();
+    void ReadLoop(const std::shared_ptr<WorkerConnection>& worker);
+    void DropWorker(const std::shared_ptr<WorkerConnection>& worker);
+    void ReapWorkers();
+    std::shared_ptr<WorkerConnection> PickWorker();
+    int AcquireBoard();
+    bool Send(WorkerConnection& worker, const std::string& line);
+
+    std::string config_payload_;
+    ijccrl::core::runtime::MatchRunner::ResultCallback result_callback_;
+    ijccrl::core::runtime::MatchRunner::LiveUpdateFn live_update_;
+    ijccrl::core::runtime::MatchRunner::MoveUpdateFn move_update_;
+    LogFn log_;
+    ijccrl::core::runtime::MatchRunner::JobEventFn job_event_;
+    ijccrl::core::runtime::MatchRunner::ProgressFn progress_update_;
+
+    SocketHandle listener_ = kInvalidSocket;
+    std::string listen_address_;
+    std::string token_;
+    std::atomic<bool> shutting_down_{false};
+    std::thread accept_thread_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int next_worker_id_ = 0;
+    std::map<int, std::shared_ptr<WorkerConnection>> workers_;
+    std::vector<std::shared_ptr<WorkerConnection>> retired_;
+    std::map<int, InFlightGame> in_flight_;
+    std::deque<PendingGame> requeued_;
+    std::vector<bool> boards_;
+};
+
+}  // namespace ijccrl::core::distributed
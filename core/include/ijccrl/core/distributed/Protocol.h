@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ijccrl/core/game/GameRunner.h"
+#include "ijccrl/core/runtime/MatchRunner.h"
+
+#include <cstddef>
+#include <string>
+
+namespace ijccrl::core::distributed {
+
+// One JSON object per line. Workers send Hello, Progress, Move, Live, Log and
+// Result; the coordinator sends Welcome, Job, Stop and Bye. Games are keyed by
+// fixture index, which is unique among the games in flight.
+enum class MessageType {
+    Unknown,
+    Hello,
+    Welcome,
+    Job,
+    Progress,
+    Move,
+    Live,
+    Log,
+    Result,
+    Stop,
+    Bye
+};
+
+struct Message {
+    MessageType type = MessageType::Unknown;
+    int slots = 0;
+    bool live = false;
+    std::string text;
+    std::string token;
+    int fixture_index = 0;
+    ijccrl::core::runtime::MatchJob job;
+    ijccrl::core::game::GameProgress progress;
+    std::string move_uci;
+    std::string fen;
+    ijccrl::core::pgn::PgnGame pgn;
+    ijccrl::core::game::GameRunner::Result result;
+    double duration_seconds = 0.0;
+};
+
+// Longest line either side accepts; anything longer closes the connection.
+// Live messages carry a whole PGN, Hello only a name and a token.
+constexpr size_t kMaxMessageBytes = 8 * 1024 * 1024;
+constexpr size_t kMaxHelloBytes = 4096;
+
+std::string EncodeMessage(const Message& message);
+bool DecodeMessage(const std::string& line, Message& message, std::string* error);
+
+}  // namespace ijccrl::core::distributed
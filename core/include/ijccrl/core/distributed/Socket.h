@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ijccrl::core::distributed {
+
+using SocketHandle = std::intptr_t;
+constexpr SocketHandle kInvalidSocket = -1;
+
+// Addresses are "host:port" for TCP (an empty host listens on every interface)
+// or "unix:/path/to/socket" for a Unix domain socket.
+SocketHandle ListenSocket(const std::string& address, std::string* error);
+// Waits up to timeout_ms for a connection; returns kInvalidSocket on timeout.
+SocketHandle AcceptSocket(SocketHandle listener, int timeout_ms, std::string* peer);
+SocketHandle ConnectSocket(const std::string& address, std::string* error);
+bool SendLine(SocketHandle socket, const std::string& line);
+// Wakes up a thread blocked reading the socket without releasing the handle.
+void ShutdownSocket(SocketHandle socket);
+void CloseSocket(SocketHandle socket);
+
+class LineReader {
+public:
+    LineReader(SocketHandle socket, size_t max_line) : socket_(socket), max_line_(max_line) {}
+
+    // Returns false once the peer has closed the connection or sent a line
+    // longer than max_line bytes (overflowed() tells the two apart).
+    bool ReadLine(std::string& line);
+    void set_max_line(size_t max_line) { max_line_ = max_line; }
+    bool overflowed() const { return overflowed_; }
+
+private:
+    SocketHandle socket_ = kInvalidSocket;
+    size_t max_line_ = 0;
+    bool overflowed_ = false;
+    std::string buffer_;
+    size_t scanned_ = 0;
+};
+
+}  // namespace ijccrl::core::distributed
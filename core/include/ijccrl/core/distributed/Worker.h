@@ -0,0 +1,35 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace ijccrl::core::distributed {
+
+// Connects to a coordinator, receives its runner config and plays the jobs it
+// is sent with a local EnginePool and MatchRunner, streaming progress, moves
+// and results back over the connection.
+class Worker {
+public:
+    using LogFn = std::function<void(const std::string&)>;
+
+    struct Options {
+        std::string address;
+        std::string name;
+        std::string token;
+        int slots = 1;
+        int connect_timeout_seconds = 30;
+    };
+
+    Worker(Options options, LogFn log);
+
+    // Returns once the coordinator says goodbye, the connection drops or stop
+    // is raised.
+    bool Run(std::atomic<bool>& stop, std::string* error);
+
+private:
+    Options options_;
+    LogFn log_;
+};
+
+}  // namespace ijccrl::core::distributed
@@ -7,6 +7,7 @@
 
 namespace ijccrl::core::exporter {
 
+// Engines are listed by EngineStats::rank when ranked, by points otherwise.
 bool WriteStandingsCsv(const std::string& path, const std::vector<ijccrl::core::stats::EngineStats>& standings);
 bool WriteStandingsHtml(const std::string& path,
                         const std::string& event_name,
@@ -17,5 +18,15 @@ bool WriteSummaryJson(const std::string& path,
                       const std::string& mode,
                       int total_games,
                       const std::vector<ijccrl::core::stats::EngineStats>& standings);
+// crosstable is StandingsTable::crosstable(): row-major, in standings order.
+// Engines are listed in rank order in both files.
+bool WriteCrosstableJson(const std::string& path,
+                         const std::string& event_name,
+                         const std::vector<ijccrl::core::stats::EngineStats>& standings,
+                         const std::vector<ijccrl::core::stats::HeadToHead>& crosstable);
+bool WriteCrosstableHtml(const std::string& path,
+                         const std::string& event_name,
+                         const std::vector<ijccrl::core::stats::EngineStats>& standings,
+                         const std::vector<ijccrl::core::stats::HeadToHead>& crosstable);
 
 }  // namespace ijccrl::core::exporter
@@ -4,7 +4,9 @@
 #include "ijccrl/core/game/TimeControl.h"
 #include "ijccrl/core/pgn/PgnGame.h"
 #include "ijccrl/core/rules/Termination.h"
+#include "ijccrl/core/stats/SearchStats.h"
 #include "ijccrl/core/uci/UciEngine.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 
 #include <atomic>
 #include <functional>
@@ -17,11 +19,14 @@ class GameRunner {
 public:
     using LiveUpdateFn = std::function<void(const ijccrl::core::pgn::PgnGame&)>;
     using MoveUpdateFn = std::function<void(const std::string&, const std::string&)>;
+    using ProgressFn = std::function<void(const GameProgress&)>;
 
     struct Result {
         GameState state;
         ijccrl::core::pgn::PgnGame pgn;
         std::string final_fen;
+        ijccrl::core::stats::GameSearchStats white_search;
+        ijccrl::core::stats::GameSearchStats black_search;
     };
 
     Result PlayGame(ijccrl::core::uci::UciEngine& white,
@@ -34,7 +39,14 @@ public:
                     const std::string& initial_fen,
                     const std::vector<std::string>& opening_moves,
                     const LiveUpdateFn& live_update,
-                    const MoveUpdateFn& move_update);
+                    const MoveUpdateFn& move_update,
+                    const GameProgress* resume_from = nullptr,
+                    const ProgressFn& progress_update = {});
+
+    void set_broadcast_latency(ijccrl::core::util::BroadcastLatency* latency) { latency_ = latency; }
+
+private:
+    ijccrl::core::util::BroadcastLatency* latency_ = nullptr;
 };
 
 }  // namespace ijccrl::core::game
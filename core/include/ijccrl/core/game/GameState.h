@@ -33,4 +33,17 @@ struct GameState {
     bool tablebase_used = false;
 };
 
+struct GameProgress {
+    std::vector<std::string> moves_uci;
+    int wtime_ms = 0;
+    int btime_ms = 0;
+    int draw_score_streak = 0;
+    int win_score_streak_white = 0;
+    int win_score_streak_black = 0;
+    int resign_streak_white = 0;
+    int resign_streak_black = 0;
+    GameState::EvalInfo last_eval_white;
+    GameState::EvalInfo last_eval_black;
+};
+
 }  // namespace ijccrl::core::game
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -11,4 +12,10 @@ struct Opening {
     std::vector<std::string> moves;
 };
 
+// Byte range of one opening record inside a suite file.
+struct OpeningSpan {
+    std::uint64_t begin = 0;
+    std::uint64_t end = 0;
+};
+
 }  // namespace ijccrl::core::openings
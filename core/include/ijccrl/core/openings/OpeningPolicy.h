@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ijccrl/core/openings/Opening.h"
+#include "ijccrl/core/openings/OpeningSource.h"
 #include "ijccrl/core/tournament/TournamentTypes.h"
 
 #include <vector>
@@ -12,8 +13,11 @@ public:
     static std::vector<Opening> AssignRoundRobin(const std::vector<ijccrl::core::tournament::Fixture>& fixtures,
                                                  const std::vector<Opening>& openings,
                                                  int games_per_pairing);
+    static Opening AssignRoundRobinForIndex(int fixture_index,
+                                            const OpeningSource& openings,
+                                            int games_per_pairing);
     static Opening AssignSwissForIndex(int global_game_index,
-                                       const std::vector<Opening>& openings,
+                                       const OpeningSource& openings,
                                        int games_per_pairing);
 };
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ijccrl/core/openings/Opening.h"
+#include "ijccrl/core/util/MappedFile.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ijccrl::core::openings {
+
+// Random access to an opening suite without loading it. The suite is mapped
+// and an offset index is kept next to it ("<suite>.idx", rebuilt when the
+// suite's size, modification time or dedupe setting changes); At() decodes a
+// single record.
+// Safe to call At() from several threads.
+class OpeningSource {
+public:
+    OpeningSource() = default;
+    OpeningSource(const OpeningSource&) = delete;
+    OpeningSource& operator=(const OpeningSource&) = delete;
+
+    struct Options {
+        // Keep only the first record of each canonical position (rules::CanonicalPositionHash).
+        bool dedupe = false;
+        // Replace suite ids with "pos:<hash>", stable across suite versions and formats.
+        bool position_ids = false;
+        // Polyglot books: how many lines to draw, their length in plies and the generator seed.
+        size_t book_lines = 1000;
+        int book_depth = 16;
+        std::uint32_t book_seed = 0;
+    };
+
+    // type is "epd", "pgn" or "polyglot". An unreadable suite leaves the source empty.
+    // A Polyglot book is expanded into book_lines weighted random lines when opened;
+    // with dedupe, lines ending in a position already drawn are skipped and redrawn.
+    bool Open(const std::string& path, const std::string& type, const Options& options, std::string* error);
+    void Assign(std::vector<Opening> openings);
+    // Same order as std::shuffle over the loaded openings with mt19937(seed).
+    void Shuffle(std::uint32_t seed);
+    // Leaves out every opening for which drop() returns true, decoding each
+    // record once. Call before Shuffle/Permute. Returns the number left out;
+    // nothing is left out when drop() would empty the source.
+    size_t Exclude(const std::function<bool(const Opening&)>& drop);
+    // Makes Draw() walk a seeded pseudo-random permutation of the suite instead
+    // of file order. The permutation is a keyed Feistel network over the index
+    // range (cycle-walked down to size()), so it takes no memory and draw n is a
+    // pure function of (seed, n). Every pass over the suite uses a fresh key.
+    void Permute(std::uint64_t seed);
+
+    size_t size() const;
+    size_t duplicates_removed() const { return duplicates_removed_; }
+    bool empty() const { return size() == 0; }
+    Opening At(size_t index) const;
+    // n-th opening handed out: each pass over the suite visits every opening once.
+    Opening Draw(std::uint64_t n) const;
+
+    static std::string IndexPath(const std::string& suite_path);
+
+private:
+    Opening Record(size_t record) const;
+    size_t RecordCount() const { return spans_ ? span_count_ : memory_.size(); }
+    bool OpenBook(const std::string& path, const Options& options, std::string* error);
+    OpeningSpan SpanAt(size_t record) const;
+
+    bool pgn_ = false;
+    bool position_ids_ = false;
+    size_t duplicates_removed_ = 0;
+    ijccrl::core::util::MappedFile suite_;
+    ijccrl::core::util::MappedFile index_;
+    const char* spans_ = nullptr;
+    size_t span_count_ = 0;
+    std::vector<OpeningSpan> built_spans_;
+    std::vector<Opening> memory_;
+    std::vector<std::uint32_t> order_;
+    std::vector<std::uint32_t> kept_;
+    bool filtered_ = false;
+    bool permuted_ = false;
+    std::uint64_t permute_seed_ = 0;
+};
+
+}  // namespace ijccrl::core::openings
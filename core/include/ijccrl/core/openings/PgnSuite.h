@@ -3,13 +3,18 @@
 #include "ijccrl/core/openings/Opening.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ijccrl::core::openings {
 
 class PgnSuite {
 public:
-    static std::vector<Opening> LoadFile(const std::string& path);
+    // Parses the file in parallel chunks split between games; threads <= 0 uses every core.
+    static std::vector<Opening> LoadFile(const std::string& path, int threads = 0);
+    // Spans of the games in the text, in file order.
+    static std::vector<OpeningSpan> IndexText(std::string_view text, int threads = 0);
+    static bool ParseGame(std::string_view text, Opening& opening);
 };
 
 }  // namespace ijccrl::core::openings
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ijccrl/core/openings/Opening.h"
+#include "ijccrl/core/util/MappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ijccrl::core::openings {
+
+// Polyglot opening book (.bin): 16-byte big-endian entries (key, move, weight,
+// learn) sorted by Zobrist key. The book is mapped and probed with a binary
+// search; nothing is loaded.
+class PolyglotBook {
+public:
+    struct Entry {
+        std::string move;
+        std::uint16_t weight = 0;
+    };
+
+    bool Open(const std::string& path, std::string* error);
+    size_t size() const { return book_.view().size() / kEntrySize; }
+
+    // Polyglot key of the position reached from fen (the start position when
+    // empty) after the UCI moves. Returns false when a move is not UCI.
+    static bool Key(const std::string& fen, const std::vector<std::string>& moves_uci, std::uint64_t* key);
+
+    // Book moves for the position in UCI notation (castling as e1g1, not e1h1).
+    std::vector<Entry> Probe(const std::string& fen, const std::vector<std::string>& moves_uci) const;
+
+    // Line of up to depth plies from the start position. Each move is drawn in
+    // proportion to its weight from a generator seeded with (seed, index), so a
+    // line depends only on the book, the seed and its index. The line ends early
+    // when the book has no move with a non-zero weight.
+    Opening Line(std::uint64_t index, int depth, std::uint32_t seed) const;
+
+private:
+    static constexpr size_t kEntrySize = 16;
+
+    ijccrl::core::util::MappedFile book_;
+};
+
+}  // namespace ijccrl::core::openings
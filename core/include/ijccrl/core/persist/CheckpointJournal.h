@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ijccrl/core/persist/CheckpointState.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ijccrl::core::persist {
+
+std::string JournalPathFor(const std::string& checkpoint_path);
+
+class CheckpointJournal {
+public:
+    bool Open(const std::string& path, std::uint64_t last_seq, bool truncate);
+    void Close();
+    bool is_open() const;
+
+    bool AppendStarted(const ActiveGameMeta& game);
+    bool AppendProgress(int game_no, int fixture_index, const ijccrl::core::game::GameProgress& progress);
+    bool AppendCompleted(const CompletedGameMeta& game,
+                         int white_engine_id,
+                         int black_engine_id,
+                         const std::string& end_time);
+
+    // Move records are buffered until this, the next start or end record,
+    // Compact or Close.
+    void Flush();
+
+    std::uint64_t last_seq() const;
+    // Only finished games count toward compaction; move records never trigger it.
+    std::size_t completed_since_compaction() const;
+    bool Compact(std::uint64_t snapshot_seq);
+
+private:
+    enum class Record { Start, Move, End };
+
+    bool AppendLine(const std::string& line, Record kind);
+
+    mutable std::mutex mutex_;
+    std::string path_;
+    std::ofstream out_;
+    std::uint64_t seq_ = 0;
+    std::size_t completed_since_compaction_ = 0;
+    std::unordered_map<int, std::size_t> journaled_plies_;
+};
+
+bool ReplayJournal(const std::string& path, CheckpointState& state, std::string* error);
+
+}  // namespace ijccrl::core::persist
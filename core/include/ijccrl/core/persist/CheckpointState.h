@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "ijccrl/core/game/GameState.h"
 #include "ijccrl/core/tournament/TournamentTypes.h"
 
 namespace ijccrl::core::persist {
@@ -26,6 +27,7 @@ struct ActiveGameMeta {
     std::string white;
     std::string black;
     std::string opening_id;
+    ijccrl::core::game::GameProgress progress;
 };
 
 struct StandingsSnapshot {
@@ -58,6 +60,10 @@ struct CheckpointState {
     std::uint64_t rng_seed = 0;
     int last_game_no = 0;
     std::string last_game_end_time;
+    std::uint64_t journal_seq = 0;
+    // Opening ids the bias check dropped when the event started; a resume
+    // drops exactly these so every fixture keeps its opening.
+    std::vector<std::string> excluded_openings;
 
     struct SwissPairing {
         int white_engine_id = -1;
@@ -85,8 +91,24 @@ struct CheckpointState {
     SwissCheckpointState swiss;
 };
 
+enum class CheckpointFormat {
+    Json,
+    Binary,
+};
+
+CheckpointFormat CheckpointFormatFromString(const std::string& name);
+
 std::string ComputeConfigHash(const std::string& payload);
-bool SaveCheckpoint(const std::string& path, const CheckpointState& state);
+bool SaveCheckpoint(const std::string& path,
+                    const CheckpointState& state,
+                    CheckpointFormat format = CheckpointFormat::Json);
 bool LoadCheckpoint(const std::string& path, CheckpointState& state, std::string* error);
+const ActiveGameMeta* FindActiveGame(const CheckpointState& state, int fixture_index);
+
+std::string EncodeCheckpointJson(const CheckpointState& state);
+bool DecodeCheckpointJson(const std::string& data, CheckpointState& state, std::string* error);
+std::string EncodeCheckpointBinary(const CheckpointState& state);
+bool DecodeCheckpointBinary(const std::string& data, CheckpointState& state, std::string* error);
+bool IsBinaryCheckpoint(const std::string& data);
 
 }  // namespace ijccrl::core::persist
@@ -2,6 +2,7 @@
 
 #include "ijccrl/core/game/GameState.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -105,6 +106,9 @@ public:
                                  const ProbeInfo& probe,
                                  bool manual_stop);
 
+    void CaptureStreaks(ijccrl::core::game::GameProgress& progress) const;
+    void RestoreStreaks(const ijccrl::core::game::GameProgress& progress);
+
     static std::string ReasonToString(TerminationReason reason);
     static std::string TerminationTag(TerminationReason reason);
 
@@ -122,4 +126,13 @@ private:
     int resign_streak_black_ = 0;
 };
 
+// Position reached from fen (the start position when empty) after the UCI
+// moves, as "placement side castling ep" without move clocks. The en passant
+// square is kept only when a pawn can capture onto it. Returns false when a move
+// is not in UCI notation.
+bool CanonicalPositionKey(const std::string& fen, const std::vector<std::string>& moves_uci, std::string* key);
+// FNV-1a of the canonical key, stable across platforms and builds. Move lists
+// that are not UCI hash the starting key followed by the move text.
+std::uint64_t CanonicalPositionHash(const std::string& fen, const std::vector<std::string>& moves_uci);
+
 }  // namespace ijccrl::core::rules
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace ijccrl::core::runtime {
+
+// Concurrent-game budget shared by several tournaments in one process. Each
+// client registers with a weight; a freed slot goes to the waiting client with
+// the lowest slots-in-use to weight ratio, so idle clients never hold back busy
+// ones and busy clients converge to their weighted share.
+class CoreBudget {
+public:
+    struct Usage {
+        double weight = 1.0;
+        int in_use = 0;
+        int waiting = 0;
+        bool active = false;
+    };
+
+    explicit CoreBudget(int capacity);
+
+    int AddClient(double weight);
+    void RemoveClient(int client);
+
+    // Blocks until the client is granted a slot; returns false if stop is raised first.
+    bool Acquire(int client, const std::atomic<bool>* stop);
+    void Release(int client);
+
+    int capacity() const { return capacity_; }
+    std::vector<Usage> usage() const;
+
+private:
+    bool NextInLine(size_t client) const;
+
+    const int capacity_;
+    int in_use_ = 0;
+    std::vector<Usage> clients_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+}  // namespace ijccrl::core::runtime
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ijccrl::core::runtime {
+
+// Historical game lengths per engine pair and per opening, used to predict how
+// long a job will take. Predicted plies come from the pair average scaled by
+// how long the opening runs relative to all games; seconds per ply come from
+// the pair (or the global average when the pair has not played yet).
+class DurationModel {
+public:
+    explicit DurationModel(double default_seconds = 60.0);
+
+    bool Load(const std::string& path, std::string* error);
+    bool Save(const std::string& path) const;
+
+    void Record(const std::string& white,
+                const std::string& black,
+                const std::string& opening_id,
+                int plies,
+                double seconds);
+    double Predict(const std::string& white, const std::string& black, const std::string& opening_id) const;
+    int games() const;
+
+    static std::string PathFor(const std::string& checkpoint_path);
+
+private:
+    struct Totals {
+        int games = 0;
+        double plies = 0.0;
+        double seconds = 0.0;
+    };
+
+    static std::string PairKey(const std::string& white, const std::string& black);
+
+    mutable std::mutex mutex_;
+    double default_seconds_;
+    Totals global_;
+    std::unordered_map<std::string, Totals> pairs_;
+    std::unordered_map<std::string, Totals> openings_;
+};
+
+// Job indices sorted by decreasing predicted duration (ties keep index order).
+std::vector<size_t> LongestFirstOrder(const std::vector<double>& predicted);
+
+struct PlannedJob {
+    double seconds = 0.0;
+    int white_id = -1;
+    int black_id = -1;
+};
+
+// Makespan of `workers` boards playing the jobs in the given order, with each
+// engine in at most instances[engine] games at once (1 when not listed).
+// With pick_free a free board takes the first job whose engines are free, as
+// MatchRunner does with an order; otherwise boards take jobs strictly in
+// order and wait for the engines, as with fixture order.
+double SimulateMakespan(const std::vector<PlannedJob>& jobs,
+                        const std::vector<size_t>& order,
+                        int workers,
+                        const std::vector<int>& instances,
+                        bool pick_free);
+
+}  // namespace ijccrl::core::runtime
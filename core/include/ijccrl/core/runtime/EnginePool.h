@@ -24,7 +24,7 @@ class EnginePool;
 class EngineLease {
 public:
     EngineLease() = default;
-    EngineLease(EnginePool* pool, int white_id, int black_id);
+    EngineLease(EnginePool* pool, int white_id, int white_instance, int black_id, int black_instance);
     EngineLease(const EngineLease&) = delete;
     EngineLease& operator=(const EngineLease&) = delete;
     EngineLease(EngineLease&& other) noexcept;
@@ -35,6 +35,8 @@ public:
     ijccrl::core::uci::UciEngine& black();
     int white_id() const { return white_id_; }
     int black_id() const { return black_id_; }
+    int white_instance() const { return white_instance_; }
+    int black_instance() const { return black_instance_; }
     bool valid() const { return pool_ != nullptr; }
 
 private:
@@ -42,7 +44,9 @@ private:
 
     EnginePool* pool_ = nullptr;
     int white_id_ = -1;
+    int white_instance_ = 0;
     int black_id_ = -1;
+    int black_instance_ = 0;
 };
 
 class EnginePool {
@@ -50,22 +54,32 @@ public:
     explicit EnginePool(std::vector<EngineSpec> specs,
                         std::function<void(const std::string&)> log_fn = {});
 
+    // Runs count processes of engine_id so it can play that many games at
+    // once (gauntlet engines meet every opponent). Call before StartAll.
+    void set_instances(int engine_id, int count);
+    int instances(int engine_id) const { return static_cast<int>(engines_[static_cast<size_t>(engine_id)].size()); }
     bool StartAll(const std::string& working_dir);
+    // Blocks until a free instance of each engine is available.
     EngineLease AcquirePair(int white_id, int black_id);
-    void ReleasePair(int white_id, int black_id);
-    bool RestartEngine(int engine_id);
+    // Returns an invalid lease when either engine has no free instance.
+    EngineLease TryAcquirePair(int white_id, int black_id);
+    void ReleasePair(int white_id, int white_instance, int black_id, int black_instance);
+    bool RestartEngine(int engine_id, int instance = 0);
+    void StopAll();
     void set_handshake_timeout_ms(int timeout_ms) { handshake_timeout_ms_ = timeout_ms; }
     void set_watchdog_enabled(bool enabled) { watchdog_enabled_ = enabled; }
 
-    ijccrl::core::uci::UciEngine& engine(int engine_id);
+    ijccrl::core::uci::UciEngine& engine(int engine_id, int instance = 0);
     const std::vector<EngineSpec>& specs() const { return specs_; }
 
 private:
-    bool InitializeEngine(int engine_id);
+    bool InitializeEngine(int engine_id, int instance);
+    // Free instance of engine_id, or -1. Caller holds mutex_.
+    int FreeInstance(int engine_id) const;
 
     std::vector<EngineSpec> specs_;
-    std::vector<std::unique_ptr<ijccrl::core::uci::UciEngine>> engines_;
-    std::vector<bool> busy_;
+    std::vector<std::vector<std::unique_ptr<ijccrl::core::uci::UciEngine>>> engines_;
+    std::vector<std::vector<bool>> busy_;
     std::string working_dir_;
     int handshake_timeout_ms_ = 10000;
     bool watchdog_enabled_ = true;
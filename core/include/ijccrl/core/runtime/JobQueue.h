@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ijccrl/core/runtime/MatchRunner.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace ijccrl::core::runtime {
+
+// Job feed for runs whose jobs are produced while games are in flight.
+// Workers block in Pop() until a job is pushed or the queue is closed; the time
+// they spend waiting is accumulated as idle worker time.
+class JobQueue {
+public:
+    void Push(MatchJob job);
+    void Close();
+    bool Pop(MatchJob& job, const std::atomic<bool>* stop);
+
+    // Suitable for MatchRunner::Control::drain.
+    std::atomic<bool>* closed_flag() { return &closed_; }
+    double idle_seconds() const;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<MatchJob> jobs_;
+    std::atomic<bool> closed_{false};
+    std::atomic<long long> idle_us_{0};
+};
+
+}  // namespace ijccrl::core::runtime
@@ -2,6 +2,7 @@
 
 #include "ijccrl/core/game/GameRunner.h"
 #include "ijccrl/core/openings/Opening.h"
+#include "ijccrl/core/runtime/CoreBudget.h"
 #include "ijccrl/core/runtime/EnginePool.h"
 #include "ijccrl/core/tournament/TournamentTypes.h"
 
@@ -22,30 +23,52 @@ struct MatchJob {
     std::string site_tag;
     std::string round_label;
     int fixture_index = 0;
+    ijccrl::core::game::GameProgress resume;
 };
 
 struct MatchResult {
     MatchJob job;
     ijccrl::core::game::GameRunner::Result result;
     int game_number = 0;
+    double duration_seconds = 0.0;
+};
+
+// A job of an ordered run, known by its source index and engines so that it
+// can be picked by engine availability before the source builds it.
+struct OrderedJob {
+    size_t index = 0;
+    int white_engine_id = -1;
+    int black_engine_id = -1;
 };
 
 class MatchRunner {
 public:
     using ResultCallback = std::function<void(const MatchResult&)>;
-    using LiveUpdateFn = ijccrl::core::game::GameRunner::LiveUpdateFn;
+    using LiveUpdateFn = std::function<void(const MatchJob&,
+                                            int game_number,
+                                            int board,
+                                            const ijccrl::core::pgn::PgnGame&)>;
     using MoveUpdateFn = std::function<void(const MatchJob&,
                                             int game_number,
                                             const std::string&,
                                             const std::string&)>;
     using JobEventFn = std::function<void(const MatchJob&, int game_number, bool started)>;
+    using ProgressFn = std::function<void(const MatchJob&,
+                                          int game_number,
+                                          const ijccrl::core::game::GameProgress&)>;
     using WatchdogLogFn = std::function<void(const std::string&)>;
+    using JobSource = std::function<bool(size_t index, MatchJob& job)>;
 
     struct Control {
         std::atomic<bool>* stop = nullptr;
         std::atomic<bool>* paused = nullptr;
         std::mutex* pause_mutex = nullptr;
         std::condition_variable* pause_cv = nullptr;
+        std::atomic<bool>* drain = nullptr;
+        // Shared with other tournaments in the process; each game holds one slot.
+        CoreBudget* budget = nullptr;
+        int budget_client = -1;
+        ijccrl::core::util::BroadcastLatency* latency = nullptr;
     };
 
     MatchRunner(EnginePool& pool,
@@ -61,7 +84,8 @@ public:
                 LiveUpdateFn live_update,
                 MoveUpdateFn move_update,
                 WatchdogLogFn watchdog_log,
-                JobEventFn job_event = {});
+                JobEventFn job_event = {},
+                ProgressFn progress_update = {});
 
     void Run(const std::vector<MatchJob>& jobs,
              int concurrency,
@@ -70,10 +94,33 @@ public:
     void Run(const std::vector<MatchJob>& jobs,
              int concurrency,
              int initial_game_number = 0);
+    void Run(size_t job_count,
+             const JobSource& source,
+             int concurrency,
+             const Control& control,
+             int initial_game_number = 0);
+    // Jobs are taken by priority in the given order: a free board takes the
+    // first pending job whose engines are both free, so boards do not queue
+    // behind a busy engine while other engines sit idle. source() is only
+    // called for the job a board takes.
+    void Run(const std::vector<OrderedJob>& order,
+             const JobSource& source,
+             int concurrency,
+             const Control& control,
+             int initial_game_number = 0);
 
 private:
-    void RunWorker(const std::vector<MatchJob>& jobs,
-                   std::atomic<size_t>& next_job,
+    // Fills the next job and leases its engines; false when none is left.
+    using ClaimFn = std::function<bool(MatchJob& job, EngineLease& lease)>;
+
+    void RunClaims(const ClaimFn& claim,
+                   const std::function<void()>& released,
+                   int concurrency,
+                   const Control& control,
+                   int initial_game_number);
+    void RunWorker(int board,
+                   const ClaimFn& claim,
+                   const std::function<void()>& released,
                    std::atomic<int>& game_counter,
                    const Control& control);
 
@@ -91,6 +138,7 @@ private:
     MoveUpdateFn move_update_;
     WatchdogLogFn watchdog_log_;
     JobEventFn job_event_;
+    ProgressFn progress_update_;
     std::vector<std::deque<int>> failure_history_{};
     std::mutex failure_mutex_{};
 };
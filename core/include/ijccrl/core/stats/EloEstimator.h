@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ijccrl::core::stats {
+
+class EloEstimator {
+public:
+    struct Rating {
+        double elo = 0.0;
+        double error = 0.0;
+        int games = 0;
+    };
+
+    explicit EloEstimator(size_t engine_count, double prior_games = 2.0);
+
+    void AddResult(int white_id, int black_id, double white_score);
+    int Solve();
+    const std::vector<Rating>& ratings() const { return ratings_; }
+
+private:
+    void UpdateRange(size_t begin, size_t end, std::vector<double>& next) const;
+    void UpdateRatings();
+
+    size_t engine_count_ = 0;
+    double prior_games_ = 2.0;
+    std::vector<double> games_;
+    std::vector<double> scores_;
+    std::vector<double> strength_;
+    std::vector<Rating> ratings_;
+    bool dirty_ = false;
+};
+
+}  // namespace ijccrl::core::stats
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace ijccrl::core::stats {
+
+struct OpeningGame {
+    std::string opening_id;
+    // Absolute checkpoint path of the event that played the game.
+    std::string event;
+    int fixture_index = 0;
+    std::string result;
+    int plies = 0;
+    std::string termination;
+};
+
+struct OpeningTotals {
+    int white_wins = 0;
+    int draws = 0;
+    int black_wins = 0;
+    long long plies = 0;
+    std::map<std::string, int> terminations;
+
+    int games() const { return white_wins + draws + black_wins; }
+    double white_score() const;
+    // Distance of the white score from 0.5, between 0 and 0.5.
+    double bias() const { return white_score() > 0.5 ? white_score() - 0.5 : 0.5 - white_score(); }
+    double average_plies() const { return games() > 0 ? static_cast<double>(plies) / games() : 0.0; }
+};
+
+// Per-opening results accumulated across events. The file is an append-only
+// log of binary game records; a fixture played again by the same event
+// (resume or restart) replaces its earlier record. Open() compacts the log
+// when most of it is superseded or its tail is torn.
+// Record() is thread-safe.
+class OpeningStats {
+public:
+    // A missing file is an empty log.
+    bool Open(const std::string& path, std::string* error);
+    bool is_open() const { return !path_.empty(); }
+
+    // Ignores unfinished games ("*").
+    bool Record(const OpeningGame& game);
+
+    // Totals by opening id, leaving out games of exclude_event so that a
+    // resumed event sees the same history it started with.
+    std::map<std::string, OpeningTotals> Totals(const std::string& exclude_event = {}) const;
+    size_t games() const;
+
+    // One row per opening: games, W/D/L by colour, white score, average plies
+    // and "termination:count" pairs.
+    static std::string FormatCsv(const std::map<std::string, OpeningTotals>& totals);
+
+private:
+    using GameKey = std::pair<std::string, int>;
+
+    std::string path_;
+    std::map<GameKey, OpeningGame> games_;
+    mutable std::mutex mutex_;
+};
+
+}  // namespace ijccrl::core::stats
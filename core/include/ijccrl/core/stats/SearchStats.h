@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ijccrl::core::stats {
+
+// One engine's searches in one game, taken from the last UCI info line of
+// each move. Margin is how far a search stayed below the go timeout, the
+// point at which the runner scores a time loss.
+struct GameSearchStats {
+    int searches = 0;
+    int depth_searches = 0;
+    long long depth_total = 0;
+    int min_depth = 0;
+    long long nodes = 0;
+    std::vector<long long> nps;
+    long long time_used_ms = 0;
+    long long time_allotted_ms = 0;
+    long long min_margin_ms = 0;
+
+    // depth, nodes and nps are 0 when the engine did not report them.
+    void AddSearch(int depth,
+                   long long search_nodes,
+                   long long search_nps,
+                   long long used_ms,
+                   long long allotted_ms,
+                   long long margin_ms);
+};
+
+struct SearchSummary {
+    int games = 0;
+    int searches = 0;
+    double average_depth = 0.0;
+    int min_depth = 0;
+    long long nps_p10 = 0;
+    long long nps_p50 = 0;
+    long long nps_p90 = 0;
+    double time_used_seconds = 0.0;
+    double time_allotted_seconds = 0.0;
+    long long min_margin_ms = 0;
+
+    double time_usage() const { return time_allotted_seconds > 0.0 ? time_used_seconds / time_allotted_seconds : 0.0; }
+};
+
+// Per-engine totals over games. nps samples are kept in quarter-octave
+// buckets, so percentiles are within about 10%.
+class SearchAggregate {
+public:
+    void Add(const GameSearchStats& game);
+    SearchSummary Summarize() const;
+
+private:
+    static constexpr std::size_t kNpsBuckets = 4 * 48;
+
+    static std::size_t NpsBucket(long long nps);
+    long long NpsPercentile(double fraction) const;
+
+    int games_ = 0;
+    int searches_ = 0;
+    int depth_searches_ = 0;
+    long long depth_total_ = 0;
+    int min_depth_ = 0;
+    long long time_used_ms_ = 0;
+    long long time_allotted_ms_ = 0;
+    bool has_margin_ = false;
+    long long min_margin_ms_ = 0;
+    std::array<std::uint32_t, kNpsBuckets> nps_buckets_{};
+    std::uint64_t nps_samples_ = 0;
+};
+
+}  // namespace ijccrl::core::stats
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace ijccrl::core::stats {
+
+class Sprt {
+public:
+    enum class Status {
+        Continue,
+        AcceptH0,
+        AcceptH1
+    };
+
+    struct Snapshot {
+        double elo0 = 0.0;
+        double elo1 = 0.0;
+        double alpha = 0.0;
+        double beta = 0.0;
+        double llr = 0.0;
+        double lower_bound = 0.0;
+        double upper_bound = 0.0;
+        Status status = Status::Continue;
+        int pairs = 0;
+        std::array<int, 5> pentanomial{};
+    };
+
+    Sprt(double elo0, double elo1, double alpha, double beta);
+
+    Status RecordGame(int pair_index, double score);
+    Status status() const;
+    Snapshot snapshot() const;
+
+    static const char* StatusName(Status status);
+    static std::string Describe(const Snapshot& snapshot);
+    static double GameScore(const std::string& result, bool candidate_is_white);
+
+private:
+    double LlrLocked() const;
+
+    mutable std::mutex mutex_;
+    double elo0_;
+    double elo1_;
+    double alpha_;
+    double beta_;
+    double lower_bound_;
+    double upper_bound_;
+    std::map<int, double> open_pairs_;
+    std::array<int, 5> pentanomial_{};
+    Status status_ = Status::Continue;
+};
+
+}  // namespace ijccrl::core::stats
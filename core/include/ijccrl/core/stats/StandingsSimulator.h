@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ijccrl/core/stats/StandingsTable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ijccrl::core::stats {
+
+struct SimulatedGame {
+    int fixture_index = -1;
+    int white_id = -1;
+    int black_id = -1;
+};
+
+// Place distribution after simulating the remaining games from the
+// standings as they were after games_played games.
+struct SimulationResult {
+    int simulations = 0;
+    int games_played = 0;
+    int remaining_games = 0;
+    // Row-major engine x place; place 0 is first.
+    std::vector<double> place_probability;
+    std::vector<double> expected_points;
+
+    bool empty() const { return simulations == 0; }
+    size_t engine_count() const { return expected_points.size(); }
+    double probability(int engine_id, int place) const {
+        return place_probability[static_cast<size_t>(engine_id) * engine_count() + static_cast<size_t>(place)];
+    }
+};
+
+// Monte-Carlo estimate of the final standings. Each remaining game is won,
+// drawn or lost with probabilities taken from the Elo difference and the
+// event draw rate, shrunk towards the pair's own head-to-head results.
+// Simulated ties keep the current ranking order, since tie-breaks of
+// unplayed games are unknown.
+//
+// Runs on a background thread: Update() hands over the latest standings and
+// returns at once; a run in progress finishes first and updates arriving
+// meanwhile collapse into the next run.
+class StandingsSimulator {
+public:
+    StandingsSimulator(std::vector<SimulatedGame> remaining, int simulations, int threads, std::uint64_t seed);
+    ~StandingsSimulator();
+
+    StandingsSimulator(const StandingsSimulator&) = delete;
+    StandingsSimulator& operator=(const StandingsSimulator&) = delete;
+
+    // standings must be ranked (UpdateRanks). completed_fixture is dropped
+    // from the remaining games; -1 keeps them as they are.
+    void Update(const StandingsTable& standings, int completed_fixture = -1);
+    SimulationResult Latest() const;
+    // Blocks until the last Update() has been simulated.
+    void Wait();
+
+private:
+    struct Input {
+        std::vector<int> half_points;
+        std::vector<int> ranking;
+        std::vector<double> elo;
+        std::vector<HeadToHead> crosstable;
+        double draw_rate = 0.0;
+        int games_played = 0;
+        std::vector<SimulatedGame> remaining;
+    };
+
+    void Loop();
+    SimulationResult Simulate(const Input& input) const;
+
+    int simulations_;
+    int threads_;
+    std::uint64_t seed_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<SimulatedGame> remaining_;
+    Input pending_;
+    bool dirty_ = false;
+    bool busy_ = false;
+    SimulationResult latest_;
+    std::atomic<bool> stop_{false};
+    std::thread worker_;
+};
+
+}  // namespace ijccrl::core::stats
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "ijccrl/core/stats/EloEstimator.h"
+#include "ijccrl/core/stats/SearchStats.h"
+#include "ijccrl/core/stats/TieBreaks.h"
+
+#include <array>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -12,6 +18,24 @@ struct EngineStats {
     int draws = 0;
     int losses = 0;
     double points = 0.0;
+    std::array<int, 5> pentanomial{};
+    double elo = 0.0;
+    double elo_error = 0.0;
+    // Filled by StandingsTable::UpdateRanks; rank 0 means not ranked.
+    int rank = 0;
+    double buchholz = 0.0;
+    double sonneborn_berger = 0.0;
+    double koya = 0.0;
+    // Games played since the runner started; not restored on resume.
+    SearchSummary search;
+
+    int pairs() const {
+        int total = 0;
+        for (int count : pentanomial) {
+            total += count;
+        }
+        return total;
+    }
 
     double score_percent() const {
         if (games == 0) {
@@ -21,18 +45,62 @@ struct EngineStats {
     }
 };
 
+// One engine's results against one opponent.
+struct HeadToHead {
+    int wins = 0;
+    int draws = 0;
+    int losses = 0;
+
+    int games() const { return wins + draws + losses; }
+    double points() const { return wins + 0.5 * draws; }
+};
+
 class StandingsTable {
 public:
     explicit StandingsTable(std::vector<std::string> engine_names);
 
-    void RecordResult(int white_id, int black_id, const std::string& result);
+    void RecordResult(int white_id, int black_id, const std::string& result, int pair_key = -1);
+    void RestoreResult(int white_id, int black_id, const std::string& result, int pair_key = -1);
+    int UpdateRatings();
     void RecordBye(int engine_id, double points);
+    void RecordSearch(int engine_id, const GameSearchStats& search);
+    // Re-adds a bye's points to the tie-breaks after LoadSnapshot.
+    void RestoreBye(int engine_id, double points);
     void LoadSnapshot(std::vector<EngineStats> snapshot);
+    void SetTieBreakOrder(std::vector<TieBreak> order) { tie_break_order_ = std::move(order); }
+    // Re-ranks engines by points and the tie-break order and copies the
+    // tie-break values into standings().
+    void UpdateRanks();
+    // Engine ids best first, as of the last UpdateRanks.
+    const std::vector<int>& ranking() const { return ranking_; }
     const std::vector<EngineStats>& standings() const { return standings_; }
     int games_played() const { return games_played_; }
+    // Row-major engine x opponent matrix; cell (i, j) holds engine i's results
+    // against engine j. Kept up to date by RecordResult and RestoreResult.
+    const std::vector<HeadToHead>& crosstable() const { return crosstable_; }
+    const HeadToHead& head_to_head(int engine_id, int opponent_id) const {
+        return crosstable_[static_cast<size_t>(engine_id) * standings_.size() + static_cast<size_t>(opponent_id)];
+    }
 
 private:
+    struct OpenPair {
+        int white_id = -1;
+        int black_id = -1;
+        double white_score = 0.0;
+    };
+
+    void RecordPairGame(int pair_key, int white_id, int black_id, const std::string& result);
+    void RecordRating(int white_id, int black_id, const std::string& result);
+    void RecordHeadToHead(int white_id, int black_id, const std::string& result);
+
     std::vector<EngineStats> standings_;
+    EloEstimator elo_;
+    std::map<int, OpenPair> open_pairs_;
+    std::vector<HeadToHead> crosstable_;
+    TieBreaks tie_breaks_;
+    std::vector<TieBreak> tie_break_order_ = TieBreaks::DefaultOrder();
+    std::vector<int> ranking_;
+    std::vector<SearchAggregate> search_;
     int games_played_ = 0;
 };
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ijccrl::core::stats {
+
+enum class TieBreak {
+    kBuchholz,
+    kSonnebornBerger,
+    kDirectEncounter,
+    kKoya,
+};
+
+// Tie-break scores kept up to date per result. A result changes the two
+// players' points, so only their opponents' Buchholz, Sonneborn-Berger and
+// Koya values are touched; nothing is recomputed from the game history.
+// Koya counts points scored against opponents on 50% or more of their games.
+// Direct encounter depends on who is tied and is evaluated when ranking.
+class TieBreaks {
+public:
+    explicit TieBreaks(size_t engine_count);
+
+    void AddGame(int white_id, int black_id, double white_score);
+    void AddBye(int engine_id, double points);
+
+    double points(int engine_id) const { return players_[static_cast<size_t>(engine_id)].points; }
+    double buchholz(int engine_id) const { return players_[static_cast<size_t>(engine_id)].buchholz; }
+    double sonneborn_berger(int engine_id) const { return players_[static_cast<size_t>(engine_id)].sonneborn_berger; }
+    double koya(int engine_id) const { return players_[static_cast<size_t>(engine_id)].koya; }
+
+    // Engine ids best first: points, then each tie-break in order, then fewer
+    // games, then engine id.
+    std::vector<int> Rank(const std::vector<TieBreak>& order) const;
+
+    // Names are "buchholz", "sonneborn_berger", "direct_encounter" and "koya".
+    static bool Parse(const std::string& name, TieBreak* tie_break);
+    static std::vector<TieBreak> DefaultOrder();
+
+private:
+    struct Meeting {
+        int opponent = -1;
+        int games = 0;
+        double score = 0.0;
+    };
+
+    struct Player {
+        double points = 0.0;
+        int games = 0;
+        double buchholz = 0.0;
+        double sonneborn_berger = 0.0;
+        double koya = 0.0;
+        bool koya_qualified = false;
+        std::vector<Meeting> meetings;
+    };
+
+    void AddPoints(int engine_id, double points);
+    Meeting& MeetingWith(int engine_id, int opponent_id);
+
+    std::vector<Player> players_;
+};
+
+}  // namespace ijccrl::core::stats
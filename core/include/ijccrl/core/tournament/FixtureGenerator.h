@@ -0,0 +1,48 @@
+#pragma once
+
+#include "ijccrl/core/tournament/TournamentTypes.h"
+
+#include <vector>
+
+namespace ijccrl::core::tournament {
+
+class FixtureGenerator {
+public:
+    static FixtureGenerator RoundRobin(int engine_count,
+                                       bool double_round_robin,
+                                       int games_per_pairing,
+                                       int repeat_count = 1);
+    static FixtureGenerator Gauntlet(int engine_count,
+                                     const std::vector<int>& gauntlet_engine_ids,
+                                     int games_per_pairing,
+                                     int repeat_count = 1);
+
+    int size() const { return size_; }
+    int fixtures_per_round() const { return fixtures_per_round_; }
+    int round_count() const;
+    Fixture At(int index) const;
+
+private:
+    enum class Kind {
+        RoundRobin,
+        Gauntlet
+    };
+
+    FixtureGenerator() = default;
+
+    Fixture RoundRobinAt(int index) const;
+    Fixture GauntletAt(int index) const;
+    int TeamAt(int position, int round) const;
+
+    Kind kind_ = Kind::RoundRobin;
+    int engine_count_ = 0;
+    int team_count_ = 0;
+    int games_per_pairing_ = 1;
+    int rounds_per_cycle_ = 0;
+    int fixtures_per_round_ = 0;
+    int size_ = 0;
+    std::vector<int> players_;
+    std::vector<int> opponents_;
+};
+
+}  // namespace ijccrl::core::tournament
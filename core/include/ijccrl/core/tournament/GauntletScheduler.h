@@ -0,0 +1,16 @@
+#pragma once
+
+#include "ijccrl/core/tournament/TournamentScheduler.h"
+
+namespace ijccrl::core::tournament {
+
+class GauntletScheduler : public ITournamentScheduler {
+public:
+    TournamentRound BuildRound(const TournamentContext& context) override;
+    static std::vector<Fixture> BuildSchedule(int engine_count,
+                                              const std::vector<int>& gauntlet_engine_ids,
+                                              int games_per_pairing,
+                                              int repeat_count = 1);
+};
+
+}  // namespace ijccrl::core::tournament
@@ -16,16 +16,33 @@ struct SwissRound {
     std::vector<std::pair<int, int>> pairings;
 };
 
+// ranking lists engine ids best first (stats::TieBreaks::Rank); it orders
+// players inside a score group. Engines missing from it rank by id after the
+// listed ones.
 class SwissScheduler final : public ITournamentScheduler {
 public:
     SwissRound BuildSwissRound(int round_index,
                                const std::vector<double>& scores,
-                               const std::vector<std::vector<int>>& opponent_history,
+                               const std::vector<int>& ranking,
                                const std::vector<int>& bye_history,
                                const std::vector<SwissColorState>& color_history,
                                const std::unordered_set<long long>& pairings_played,
                                int games_per_pairing,
-                               bool avoid_repeats);
+                               bool avoid_repeats,
+                               const std::vector<bool>& excluded = {});
+
+    // Pairs the next round for score groups that can no longer change while
+    // the current round finishes. pending_points holds the points each engine
+    // can still gain in the current round; excluded engines are skipped.
+    SwissRound BuildEarlyPairings(int round_index,
+                                  const std::vector<double>& scores,
+                                  const std::vector<double>& pending_points,
+                                  const std::vector<bool>& excluded,
+                                  const std::vector<int>& ranking,
+                                  const std::vector<SwissColorState>& color_history,
+                                  const std::unordered_set<long long>& pairings_played,
+                                  int games_per_pairing,
+                                  bool avoid_repeats);
 
     TournamentRound BuildRound(const TournamentContext& context) override;
 };
@@ -18,6 +18,7 @@ struct TournamentContext {
     std::vector<double> scores;
     std::vector<std::vector<int>> opponents;
     std::vector<int> bye_history;
+    std::vector<int> gauntlet_engine_ids;
 };
 
 struct TournamentRound {
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ijccrl::core::tournament {
+
+struct MatchingEdge {
+    int u = -1;
+    int v = -1;
+    std::int64_t weight = 0;
+};
+
+// Maximum-weight matching on a general graph (Edmonds' blossom algorithm with
+// integer dual variables, O(n^3)). Returns the mate of every vertex or -1.
+// With max_cardinality set, only maximum-cardinality matchings are considered.
+std::vector<int> MaxWeightMatching(int vertex_count,
+                                   const std::vector<MatchingEdge>& edges,
+                                   bool max_cardinality);
+
+}  // namespace ijccrl::core::tournament
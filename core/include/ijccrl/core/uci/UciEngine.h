@@ -2,6 +2,7 @@
 
 #include "ijccrl/core/process/Process.h"
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -61,6 +62,7 @@ public:
     };
 
     const Info& last_info() const { return last_info_; }
+    std::chrono::steady_clock::time_point last_bestmove_time() const { return last_bestmove_time_; }
 
 private:
     bool WaitForToken(const std::string& token, int timeout_ms);
@@ -75,6 +77,7 @@ private:
     std::string id_name_;
     std::string id_author_;
     Info last_info_{};
+    std::chrono::steady_clock::time_point last_bestmove_time_{};
 
     int handshake_timeout_ms_ = 10000;
     Failure last_failure_ = Failure::None;
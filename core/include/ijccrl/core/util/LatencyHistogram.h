@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ijccrl::core::util {
+
+class LatencyHistogram {
+public:
+    struct Summary {
+        std::uint64_t count = 0;
+        double p50_ms = 0.0;
+        double p99_ms = 0.0;
+        double max_ms = 0.0;
+    };
+
+    void Record(std::chrono::steady_clock::duration elapsed);
+    void RecordMicros(std::uint64_t micros);
+    Summary Summarize() const;
+    void Reset();
+
+private:
+    static constexpr std::size_t kLinearBuckets = 16;
+    static constexpr std::size_t kSubBuckets = 8;
+    static constexpr std::size_t kBucketCount = kLinearBuckets + 40 * kSubBuckets;
+
+    static std::size_t BucketFor(std::uint64_t micros);
+    static std::uint64_t BucketUpperBound(std::size_t index);
+
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> max_micros_{0};
+};
+
+enum class BroadcastStage {
+    Runner,
+    TlcsFeed,
+    LivePgn,
+    GuiState,
+    Count,
+};
+
+const char* BroadcastStageName(BroadcastStage stage);
+
+// Move timestamps are tracked per thread: the game worker that received the
+// bestmove is the one that drives the feed, live PGN and GUI callbacks.
+void MarkBestmoveReceived(std::chrono::steady_clock::time_point received);
+void ClearBestmoveMark();
+bool CurrentBestmoveMark(std::chrono::steady_clock::time_point* received);
+
+// One histogram per stage, owned by the tournament whose moves it measures so
+// that events hosted in the same process keep separate metrics.
+class BroadcastLatency {
+public:
+    // Measures from the current thread's mark, at most once per move.
+    void Record(BroadcastStage stage);
+    void Record(BroadcastStage stage, std::chrono::steady_clock::time_point received);
+    std::vector<std::pair<std::string, LatencyHistogram::Summary>> Snapshot() const;
+    void Reset();
+
+private:
+    std::array<LatencyHistogram, static_cast<std::size_t>(BroadcastStage::Count)> histograms_;
+};
+
+}  // namespace ijccrl::core::util
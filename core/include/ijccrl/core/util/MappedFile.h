@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace ijccrl::core::util {
+
+// Read-only view of a whole file. The file is memory-mapped where possible and
+// read into memory otherwise (pipes, special files).
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    bool Open(const std::string& path);
+    void Close();
+    std::string_view view() const { return {data_, size_}; }
+
+private:
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    void* mapping_ = nullptr;
+    std::string buffer_;
+};
+
+// Splits text into up to max_chunks pieces of at least min_chunk_bytes. Each
+// cut is moved forward to next_boundary(text, pos), which must return the
+// offset of the first record starting at or after pos (or text.size()).
+std::vector<std::string_view> SplitChunks(std::string_view text,
+                                          size_t max_chunks,
+                                          size_t min_chunk_bytes,
+                                          const std::function<size_t(std::string_view, size_t)>& next_boundary);
+
+// Parses every chunk on its own thread and concatenates the results in order.
+template <typename T, typename ParseFn>
+std::vector<T> ParseChunks(const std::vector<std::string_view>& chunks, ParseFn parse) {
+    std::vector<std::vector<T>> parts(chunks.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        threads.emplace_back([&, i]() { parts[i] = parse(chunks[i]); });
+    }
+    if (!chunks.empty()) {
+        parts[0] = parse(chunks[0]);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    size_t total = 0;
+    for (const auto& part : parts) {
+        total += part.size();
+    }
+    std::vector<T> result;
+    result.reserve(total);
+    for (auto& part : parts) {
+        std::move(part.begin(), part.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+}  // namespace ijccrl::core::util
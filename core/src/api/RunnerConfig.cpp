@@ -80,14 +80,7 @@ nlohmann::json WriteEngine(const EngineConfig& engine) {
     return node;
 }
 
-}  // namespace
-
-bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, std::string* error) {
-    nlohmann::json root;
-    if (!LoadJson(path, root, error)) {
-        return false;
-    }
-
+bool ParseConfig(const nlohmann::json& root, RunnerConfig& config, std::string* error) {
     config = RunnerConfig{};
 
     if (root.contains("engines")) {
@@ -119,6 +112,21 @@ bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, s
         config.tournament.concurrency = node.value("concurrency", config.tournament.concurrency);
         config.tournament.avoid_repeats = node.value("avoid_repeats", config.tournament.avoid_repeats);
         config.tournament.bye_points = node.value("bye_points", config.tournament.bye_points);
+        config.tournament.paired_openings = node.value("paired_openings", config.tournament.paired_openings);
+        config.tournament.swiss_overlap = node.value("swiss_overlap", config.tournament.swiss_overlap);
+        config.tournament.job_order = node.value("job_order", config.tournament.job_order);
+        if (node.contains("gauntlet_engines")) {
+            config.tournament.gauntlet_engines.clear();
+            for (const auto& name : node.at("gauntlet_engines")) {
+                config.tournament.gauntlet_engines.push_back(name.get<std::string>());
+            }
+        }
+        if (node.contains("tie_breaks")) {
+            config.tournament.tie_breaks.clear();
+            for (const auto& name : node.at("tie_breaks")) {
+                config.tournament.tie_breaks.push_back(name.get<std::string>());
+            }
+        }
     }
 
     if (root.contains("openings")) {
@@ -127,26 +135,43 @@ bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, s
         config.openings.path = node.value("path", config.openings.path);
         config.openings.policy = node.value("policy", config.openings.policy);
         config.openings.seed = node.value("seed", config.openings.seed);
+        config.openings.dedupe = node.value("dedupe", config.openings.dedupe);
+        config.openings.position_ids = node.value("position_ids", config.openings.position_ids);
+        config.openings.book_lines = node.value("book_lines", config.openings.book_lines);
+        config.openings.book_depth = node.value("book_depth", config.openings.book_depth);
+        config.openings.max_bias = node.value("max_bias", config.openings.max_bias);
+        config.openings.bias_min_games = node.value("bias_min_games", config.openings.bias_min_games);
     }
 
     if (root.contains("output")) {
         const auto& output = root.at("output");
         config.output.tournament_pgn = output.value("tournament_pgn", config.output.tournament_pgn);
         config.output.live_pgn = output.value("live_pgn", config.output.live_pgn);
+        config.output.live_board_files = output.value("live_board_files", config.output.live_board_files);
+        config.output.live_max_rate_hz = output.value("live_max_rate_hz", config.output.live_max_rate_hz);
         config.output.results_json = output.value("results_json", config.output.results_json);
         config.output.pairings_csv = output.value("pairings_csv", config.output.pairings_csv);
         config.output.progress_log = output.value("progress_log", config.output.progress_log);
         config.output.checkpoint_json = output.value("checkpoint_json", config.output.checkpoint_json);
         config.output.standings_csv = output.value("standings_csv", config.output.standings_csv);
         config.output.standings_html = output.value("standings_html", config.output.standings_html);
+        config.output.crosstable_json = output.value("crosstable_json", config.output.crosstable_json);
+        config.output.crosstable_html = output.value("crosstable_html", config.output.crosstable_html);
         config.output.summary_json = output.value("summary_json", config.output.summary_json);
         config.output.metrics_json = output.value("metrics_json", config.output.metrics_json);
+        config.output.opening_stats = output.value("opening_stats", config.output.opening_stats);
         config.output.games_dir = output.value("games_dir", config.output.games_dir);
         config.output.write_game_files = output.value("write_game_files", config.output.write_game_files);
         config.output.checkpoint_interval_seconds =
             output.value("checkpoint_interval_seconds", config.output.checkpoint_interval_seconds);
+        config.output.checkpoint_journal = output.value("checkpoint_journal", config.output.checkpoint_journal);
+        config.output.checkpoint_compact_records =
+            output.value("checkpoint_compact_records", config.output.checkpoint_compact_records);
+        config.output.checkpoint_format = output.value("checkpoint_format", config.output.checkpoint_format);
         config.output.metrics_interval_seconds =
             output.value("metrics_interval_seconds", config.output.metrics_interval_seconds);
+        config.output.simulations = output.value("simulations", config.output.simulations);
+        config.output.simulation_threads = output.value("simulation_threads", config.output.simulation_threads);
     }
 
     if (root.contains("broadcast")) {
@@ -209,6 +234,14 @@ bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, s
         config.resign.min_depth = node.value("min_depth", config.resign.min_depth);
     }
 
+    if (root.contains("sprt")) {
+        const auto& node = root.at("sprt");
+        config.sprt.elo0 = node.value("elo0", config.sprt.elo0);
+        config.sprt.elo1 = node.value("elo1", config.sprt.elo1);
+        config.sprt.alpha = node.value("alpha", config.sprt.alpha);
+        config.sprt.beta = node.value("beta", config.sprt.beta);
+    }
+
     if (root.contains("watchdog")) {
         const auto& watchdog = root.at("watchdog");
         config.watchdog.enabled = watchdog.value("enabled", config.watchdog.enabled);
@@ -224,9 +257,38 @@ bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, s
             watchdog.value("pause_on_unhealthy", config.watchdog.pause_on_unhealthy);
     }
 
+    if (root.contains("distributed")) {
+        const auto& node = root.at("distributed");
+        config.distributed.listen = node.value("listen", config.distributed.listen);
+        config.distributed.token = node.value("token", config.distributed.token);
+    }
+
     return true;
 }
 
+}  // namespace
+
+bool RunnerConfig::LoadFromFile(const std::string& path, RunnerConfig& config, std::string* error) {
+    nlohmann::json root;
+    if (!LoadJson(path, root, error)) {
+        return false;
+    }
+    return ParseConfig(root, config, error);
+}
+
+bool RunnerConfig::LoadFromString(const std::string& payload, RunnerConfig& config, std::string* error) {
+    nlohmann::json root;
+    try {
+        root = nlohmann::json::parse(payload);
+    } catch (const std::exception& ex) {
+        if (error) {
+            *error = std::string("Failed to parse JSON: ") + ex.what();
+        }
+        return false;
+    }
+    return ParseConfig(root, config, error);
+}
+
 bool RunnerConfig::SaveToFile(const std::string& path, const RunnerConfig& config, std::string* error) {
     nlohmann::json root;
     root["engines"] = nlohmann::json::array();
@@ -248,6 +310,11 @@ bool RunnerConfig::SaveToFile(const std::string& path, const RunnerConfig& confi
         {"concurrency", config.tournament.concurrency},
         {"avoid_repeats", config.tournament.avoid_repeats},
         {"bye_points", config.tournament.bye_points},
+        {"gauntlet_engines", config.tournament.gauntlet_engines},
+        {"paired_openings", config.tournament.paired_openings},
+        {"swiss_overlap", config.tournament.swiss_overlap},
+        {"job_order", config.tournament.job_order},
+        {"tie_breaks", config.tournament.tie_breaks},
     };
 
     root["openings"] = {
@@ -255,23 +322,39 @@ bool RunnerConfig::SaveToFile(const std::string& path, const RunnerConfig& confi
         {"path", config.openings.path},
         {"policy", config.openings.policy},
         {"seed", config.openings.seed},
+        {"dedupe", config.openings.dedupe},
+        {"position_ids", config.openings.position_ids},
+        {"book_lines", config.openings.book_lines},
+        {"book_depth", config.openings.book_depth},
+        {"max_bias", config.openings.max_bias},
+        {"bias_min_games", config.openings.bias_min_games},
     };
 
     root["output"] = {
         {"tournament_pgn", config.output.tournament_pgn},
         {"live_pgn", config.output.live_pgn},
+        {"live_board_files", config.output.live_board_files},
+        {"live_max_rate_hz", config.output.live_max_rate_hz},
         {"results_json", config.output.results_json},
         {"pairings_csv", config.output.pairings_csv},
         {"progress_log", config.output.progress_log},
         {"checkpoint_json", config.output.checkpoint_json},
         {"standings_csv", config.output.standings_csv},
         {"standings_html", config.output.standings_html},
+        {"crosstable_json", config.output.crosstable_json},
+        {"crosstable_html", config.output.crosstable_html},
         {"summary_json", config.output.summary_json},
         {"metrics_json", config.output.metrics_json},
+        {"opening_stats", config.output.opening_stats},
         {"games_dir", config.output.games_dir},
         {"write_game_files", config.output.write_game_files},
         {"checkpoint_interval_seconds", config.output.checkpoint_interval_seconds},
+        {"checkpoint_journal", config.output.checkpoint_journal},
+        {"checkpoint_compact_records", config.output.checkpoint_compact_records},
+        {"checkpoint_format", config.output.checkpoint_format},
         {"metrics_interval_seconds", config.output.metrics_interval_seconds},
+        {"simulations", config.output.simulations},
+        {"simulation_threads", config.output.simulation_threads},
     };
 
     root["broadcast"] = {
@@ -318,6 +401,13 @@ bool RunnerConfig::SaveToFile(const std::string& path, const RunnerConfig& confi
         {"min_depth", config.resign.min_depth},
     };
 
+    root["sprt"] = {
+        {"elo0", config.sprt.elo0},
+        {"elo1", config.sprt.elo1},
+        {"alpha", config.sprt.alpha},
+        {"beta", config.sprt.beta},
+    };
+
     root["watchdog"] = {
         {"enabled", config.watchdog.enabled},
         {"handshake_timeout_ms", config.watchdog.handshake_timeout_ms},
@@ -327,6 +417,11 @@ bool RunnerConfig::SaveToFile(const std::string& path, const RunnerConfig& confi
         {"pause_on_unhealthy", config.watchdog.pause_on_unhealthy},
     };
 
+    root["distributed"] = {
+        {"listen", config.distributed.listen},
+        {"token", config.distributed.token},
+    };
+
     const std::filesystem::path fs_path(path);
     if (!fs_path.parent_path().empty()) {
         std::filesystem::create_directories(fs_path.parent_path());
@@ -363,28 +458,49 @@ std::string RunnerConfig::ToJsonString(const RunnerConfig& config) {
         {"concurrency", config.tournament.concurrency},
         {"avoid_repeats", config.tournament.avoid_repeats},
         {"bye_points", config.tournament.bye_points},
+        {"gauntlet_engines", config.tournament.gauntlet_engines},
+        {"paired_openings", config.tournament.paired_openings},
+        {"swiss_overlap", config.tournament.swiss_overlap},
+        {"job_order", config.tournament.job_order},
+        {"tie_breaks", config.tournament.tie_breaks},
     };
     root["openings"] = {
         {"type", config.openings.type},
         {"path", config.openings.path},
         {"policy", config.openings.policy},
         {"seed", config.openings.seed},
+        {"dedupe", config.openings.dedupe},
+        {"position_ids", config.openings.position_ids},
+        {"book_lines", config.openings.book_lines},
+        {"book_depth", config.openings.book_depth},
+        {"max_bias", config.openings.max_bias},
+        {"bias_min_games", config.openings.bias_min_games},
     };
     root["output"] = {
         {"tournament_pgn", config.output.tournament_pgn},
         {"live_pgn", config.output.live_pgn},
+        {"live_board_files", config.output.live_board_files},
+        {"live_max_rate_hz", config.output.live_max_rate_hz},
         {"results_json", config.output.results_json},
         {"pairings_csv", config.output.pairings_csv},
         {"progress_log", config.output.progress_log},
         {"checkpoint_json", config.output.checkpoint_json},
         {"standings_csv", config.output.standings_csv},
         {"standings_html", config.output.standings_html},
+        {"crosstable_json", config.output.crosstable_json},
+        {"crosstable_html", config.output.crosstable_html},
         {"summary_json", config.output.summary_json},
         {"metrics_json", config.output.metrics_json},
+        {"opening_stats", config.output.opening_stats},
         {"games_dir", config.output.games_dir},
         {"write_game_files", config.output.write_game_files},
         {"checkpoint_interval_seconds", config.output.checkpoint_interval_seconds},
+        {"checkpoint_journal", config.output.checkpoint_journal},
+        {"checkpoint_compact_records", config.output.checkpoint_compact_records},
+        {"checkpoint_format", config.output.checkpoint_format},
         {"metrics_interval_seconds", config.output.metrics_interval_seconds},
+        {"simulations", config.output.simulations},
+        {"simulation_threads", config.output.simulation_threads},
     };
     root["broadcast"] = {
         {"adapter", config.broadcast.adapter},
@@ -425,6 +541,12 @@ std::string RunnerConfig::ToJsonString(const RunnerConfig& config) {
         {"moves", config.resign.moves},
         {"min_depth", config.resign.min_depth},
     };
+    root["sprt"] = {
+        {"elo0", config.sprt.elo0},
+        {"elo1", config.sprt.elo1},
+        {"alpha", config.sprt.alpha},
+        {"beta", config.sprt.beta},
+    };
     root["watchdog"] = {
         {"enabled", config.watchdog.enabled},
         {"handshake_timeout_ms", config.watchdog.handshake_timeout_ms},
@@ -436,4 +558,25 @@ std::string RunnerConfig::ToJsonString(const RunnerConfig& config) {
     return root.dump();
 }
 
+std::vector<int> ResolveGauntletEngines(const RunnerConfig& config, std::vector<std::string>* unknown) {
+    std::vector<int> ids;
+    for (const auto& name : config.tournament.gauntlet_engines) {
+        bool found = false;
+        for (size_t i = 0; i < config.engines.size(); ++i) {
+            if (config.engines[i].name == name) {
+                ids.push_back(static_cast<int>(i));
+                found = true;
+                break;
+            }
+        }
+        if (!found && unknown) {
+            unknown->push_back(name);
+        }
+    }
+    if (ids.empty() && !config.engines.empty()) {
+        ids.push_back(0);
+    }
+    return ids;
+}
+
 }  // namespace ijccrl::core::api
@@ -1,19 +1,27 @@
 #include "ijccrl/core/api/RunnerService.h"
 
+#include "ijccrl/core/broadcast/LivePgnPublisher.h"
 #include "ijccrl/core/broadcast/TlcsFeedAdapter.h"
 #include "ijccrl/core/broadcast/TlcsIniAdapter.h"
+#include "ijccrl/core/distributed/Coordinator.h"
 #include "ijccrl/core/export/ExportWriter.h"
-#include "ijccrl/core/openings/EpdParser.h"
 #include "ijccrl/core/openings/OpeningPolicy.h"
-#include "ijccrl/core/openings/PgnSuite.h"
+#include "ijccrl/core/openings/OpeningSource.h"
+#include "ijccrl/core/persist/CheckpointJournal.h"
 #include "ijccrl/core/persist/CheckpointState.h"
 #include "ijccrl/core/pgn/PgnWriter.h"
+#include "ijccrl/core/runtime/DurationModel.h"
 #include "ijccrl/core/runtime/EnginePool.h"
+#include "ijccrl/core/runtime/JobQueue.h"
 #include "ijccrl/core/runtime/MatchRunner.h"
+#include "ijccrl/core/stats/OpeningStats.h"
+#include "ijccrl/core/stats/Sprt.h"
+#include "ijccrl/core/stats/StandingsSimulator.h"
 #include "ijccrl/core/stats/StandingsTable.h"
-#include "ijccrl/core/tournament/RoundRobinScheduler.h"
+#include "ijccrl/core/tournament/FixtureGenerator.h"
 #include "ijccrl/core/tournament/SwissScheduler.h"
 #include "ijccrl/core/util/AtomicFileWriter.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 #include "ijccrl/core/rules/Termination.h"
 
 #include <nlohmann/json.hpp>
@@ -21,12 +29,15 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <thread>
@@ -57,12 +68,48 @@ bool AppendTournamentPgn(const std::string& path, const std::string& pgn) {
     return static_cast<bool>(output);
 }
 
-bool WriteLivePgn(const std::string& path, const std::string& pgn) {
-    const std::filesystem::path fs_path(path);
-    if (!fs_path.parent_path().empty()) {
-        std::filesystem::create_directories(fs_path.parent_path());
+nlohmann::json SprtJson(const ijccrl::core::stats::Sprt::Snapshot& snapshot) {
+    return {
+        {"elo0", snapshot.elo0},
+        {"elo1", snapshot.elo1},
+        {"alpha", snapshot.alpha},
+        {"beta", snapshot.beta},
+        {"llr", snapshot.llr},
+        {"lower_bound", snapshot.lower_bound},
+        {"upper_bound", snapshot.upper_bound},
+        {"status", ijccrl::core::stats::Sprt::StatusName(snapshot.status)},
+        {"pairs", snapshot.pairs},
+        {"pentanomial", snapshot.pentanomial},
+    };
+}
+
+nlohmann::json SearchJson(const ijccrl::core::stats::SearchSummary& search) {
+    return {
+        {"games", search.games},
+        {"searches", search.searches},
+        {"average_depth", search.average_depth},
+        {"min_depth", search.min_depth},
+        {"nps_p10", search.nps_p10},
+        {"nps_p50", search.nps_p50},
+        {"nps_p90", search.nps_p90},
+        {"time_used_seconds", search.time_used_seconds},
+        {"time_allotted_seconds", search.time_allotted_seconds},
+        {"time_usage", search.time_usage()},
+        {"min_margin_ms", search.min_margin_ms},
+    };
+}
+
+nlohmann::json BroadcastLatencyJson(const ijccrl::core::util::BroadcastLatency& broadcast_latency) {
+    nlohmann::json latency = nlohmann::json::object();
+    for (const auto& [stage, summary] : broadcast_latency.Snapshot()) {
+        latency[stage] = {
+            {"count", summary.count},
+            {"p50", summary.p50_ms},
+            {"p99", summary.p99_ms},
+            {"max", summary.max_ms},
+        };
     }
-    return ijccrl::core::util::AtomicFileWriter::Write(path, pgn);
+    return latency;
 }
 
 bool AppendCsvLine(const std::string& path, const std::string& line, bool write_header) {
@@ -88,23 +135,52 @@ void WriteResultsJson(const std::string& path,
                       const std::string& tc_desc,
                       const std::string& mode,
                       const ijccrl::core::stats::StandingsTable& standings,
-                      const std::unordered_map<std::string, int>& termination_counts) {
+                      const std::unordered_map<std::string, int>& termination_counts,
+                      const ijccrl::core::stats::SimulationResult& simulation = {}) {
     nlohmann::json results_json;
     results_json["event"] = event_name;
     results_json["tc"] = tc_desc;
     results_json["mode"] = mode;
     results_json["games_played"] = standings.games_played();
     results_json["termination_counts"] = termination_counts;
+    if (!simulation.empty()) {
+        results_json["simulation"] = {
+            {"simulations", simulation.simulations},
+            {"games_played", simulation.games_played},
+            {"remaining_games", simulation.remaining_games},
+        };
+    }
     results_json["standings"] = nlohmann::json::array();
-    for (const auto& entry : standings.standings()) {
-        results_json["standings"].push_back({
+    const auto& engines = standings.standings();
+    for (size_t i = 0; i < engines.size(); ++i) {
+        const auto& entry = engines[i];
+        nlohmann::json row = {
             {"name", entry.name},
             {"pts", entry.points},
             {"g", entry.games},
             {"w", entry.wins},
             {"d", entry.draws},
             {"l", entry.losses},
-        });
+            {"elo", entry.elo},
+            {"elo_error", entry.elo_error},
+            {"rank", entry.rank},
+            {"buchholz", entry.buchholz},
+            {"sonneborn_berger", entry.sonneborn_berger},
+            {"koya", entry.koya},
+        };
+        if (entry.pairs() > 0) {
+            row["pentanomial"] = entry.pentanomial;
+        }
+        if (entry.search.games > 0) {
+            row["search"] = SearchJson(entry.search);
+        }
+        if (simulation.engine_count() == engines.size()) {
+            const auto first = simulation.place_probability.begin() + static_cast<std::ptrdiff_t>(i * engines.size());
+            row["expected_points"] = simulation.expected_points[i];
+            row["place_probability"] =
+                std::vector<double>(first, first + static_cast<std::ptrdiff_t>(engines.size()));
+        }
+        results_json["standings"].push_back(std::move(row));
     }
 
     const std::filesystem::path results_path(path);
@@ -129,6 +205,80 @@ std::string FormatUtcTimestamp(std::time_t timestamp) {
     return out.str();
 }
 
+int EngineIdByName(const std::vector<std::string>& engine_names, const std::string& name) {
+    for (size_t i = 0; i < engine_names.size(); ++i) {
+        if (engine_names[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+std::vector<ijccrl::core::stats::TieBreak> ResolveTieBreaks(const RunnerConfig& config,
+                                                           std::vector<std::string>* unknown) {
+    std::vector<ijccrl::core::stats::TieBreak> order;
+    for (const auto& name : config.tournament.tie_breaks) {
+        ijccrl::core::stats::TieBreak tie_break;
+        if (ijccrl::core::stats::TieBreaks::Parse(name, &tie_break)) {
+            order.push_back(tie_break);
+        } else if (unknown) {
+            unknown->push_back(name);
+        }
+    }
+    return order;
+}
+
+double DefaultGameSeconds(const RunnerConfig& config) {
+    constexpr double kTypicalPlies = 80.0;
+    if (config.time_control.move_time_ms > 0) {
+        return kTypicalPlies * config.time_control.move_time_ms / 1000.0;
+    }
+    return 2.0 * config.time_control.base_seconds + kTypicalPlies * config.time_control.increment_seconds;
+}
+
+// Opening stats key an event by its checkpoint file, which stays the same
+// when the config is edited between runs.
+std::string OpeningStatsEvent(const RunnerConfig& config) {
+    if (config.output.checkpoint_json.empty()) {
+        return ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(config));
+    }
+    std::error_code ec;
+    const auto path = std::filesystem::absolute(config.output.checkpoint_json, ec);
+    return (ec ? std::filesystem::path(config.output.checkpoint_json) : path).lexically_normal().generic_string();
+}
+
+int PairedGamesPerPairing(int games_per_pairing) {
+    return std::max(2, games_per_pairing + games_per_pairing % 2);
+}
+
+CrosstableSnapshot MakeCrosstableSnapshot(const ijccrl::core::stats::StandingsTable& standings) {
+    CrosstableSnapshot snapshot;
+    for (const auto& entry : standings.standings()) {
+        snapshot.names.push_back(entry.name);
+    }
+    for (const auto& cell : standings.crosstable()) {
+        snapshot.cells.push_back({cell.wins, cell.draws, cell.losses});
+    }
+    return snapshot;
+}
+
+SimulationSnapshot MakeSimulationSnapshot(const ijccrl::core::stats::StandingsTable& standings,
+                                          const ijccrl::core::stats::SimulationResult& simulation) {
+    SimulationSnapshot snapshot;
+    if (simulation.engine_count() != standings.standings().size()) {
+        return snapshot;
+    }
+    snapshot.simulations = simulation.simulations;
+    snapshot.gamesPlayed = simulation.games_played;
+    snapshot.remainingGames = simulation.remaining_games;
+    for (const auto& entry : standings.standings()) {
+        snapshot.names.push_back(entry.name);
+    }
+    snapshot.placeProbability = simulation.place_probability;
+    snapshot.expectedPoints = simulation.expected_points;
+    return snapshot;
+}
+
 }  // namespace
 
 RunnerService::RunnerService() {
@@ -166,6 +316,11 @@ void RunnerService::setConfig(const RunnerConfig& config) {
     config_ = config;
 }
 
+void RunnerService::setCoreBudget(ijccrl::core::runtime::CoreBudget* budget, int client) {
+    core_budget_ = budget;
+    core_budget_client_ = client;
+}
+
 RunnerConfig RunnerService::getConfigSnapshot() const {
     std::lock_guard<std::mutex> lock(config_mutex_);
     return config_;
@@ -216,6 +371,12 @@ void RunnerService::resume() {
     pause_cv_.notify_all();
 }
 
+void RunnerService::waitForFinish() {
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
 RunnerState RunnerService::getStateSnapshot() const {
     std::lock_guard<std::mutex> lock(state_mutex_);
     return state_;
@@ -226,6 +387,16 @@ std::vector<StandingRow> RunnerService::getStandingsSnapshot() const {
     return standings_;
 }
 
+CrosstableSnapshot RunnerService::getCrosstableSnapshot() const {
+    std::lock_guard<std::mutex> lock(standings_mutex_);
+    return crosstable_;
+}
+
+SimulationSnapshot RunnerService::getSimulationSnapshot() const {
+    std::lock_guard<std::mutex> lock(standings_mutex_);
+    return simulation_;
+}
+
 std::string RunnerService::getLastLogLines(int n) const {
     std::lock_guard<std::mutex> lock(log_mutex_);
     const int start = std::max(0, static_cast<int>(log_lines_.size()) - n);
@@ -249,11 +420,14 @@ void RunnerService::AppendLogLine(const std::string& line) {
 
 bool RunnerService::exportResults(const std::string& directory, std::string* error) {
     const auto config = getConfigSnapshot();
-    const std::string event_name = config.tournament.mode == "swiss" ? "ijccrl swiss" : "ijccrl round robin";
+    const std::string event_name = config.tournament.mode == "swiss"      ? "ijccrl swiss"
+                                   : config.tournament.mode == "gauntlet" ? "ijccrl gauntlet"
+                                                                          : "ijccrl round robin";
     std::ostringstream tc_desc;
     tc_desc << config.time_control.base_seconds << "+" << config.time_control.increment_seconds;
 
     std::vector<ijccrl::core::stats::EngineStats> standings_snapshot;
+    std::vector<ijccrl::core::stats::HeadToHead> crosstable_snapshot;
     {
         std::lock_guard<std::mutex> lock(standings_mutex_);
         standings_snapshot.reserve(standings_.size());
@@ -265,8 +439,18 @@ bool RunnerService::exportResults(const std::string& directory, std::string* err
             row.draws = entry.draws;
             row.losses = entry.losses;
             row.points = entry.points;
+            row.elo = entry.elo;
+            row.elo_error = entry.eloError;
+            row.rank = entry.rank;
+            row.buchholz = entry.buchholz;
+            row.sonneborn_berger = entry.sonnebornBerger;
+            row.koya = entry.koya;
+            row.search = entry.search;
             standings_snapshot.push_back(std::move(row));
         }
+        for (const auto& cell : crosstable_.cells) {
+            crosstable_snapshot.push_back({cell.wins, cell.draws, cell.losses});
+        }
     }
 
     const std::string standings_csv = directory + "/standings.csv";
@@ -285,6 +469,17 @@ bool RunnerService::exportResults(const std::string& directory, std::string* err
         }
         return false;
     }
+    if (!crosstable_snapshot.empty()) {
+        if (!ijccrl::core::exporter::WriteCrosstableJson(
+                directory + "/crosstable.json", event_name, standings_snapshot, crosstable_snapshot) ||
+            !ijccrl::core::exporter::WriteCrosstableHtml(
+                directory + "/crosstable.html", event_name, standings_snapshot, crosstable_snapshot)) {
+            if (error) {
+                *error = "Failed to write crosstable";
+            }
+            return false;
+        }
+    }
     int total_games = 0;
     for (const auto& row : standings_snapshot) {
         total_games += row.games;
@@ -317,6 +512,11 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
     }
 
     AppendLogLine("[ijccrl] Runner starting");
+    // Under a shared budget the slots bound parallelism, so enough threads are
+    // kept to take over whatever cores other tournaments free.
+    const int runner_threads = core_budget_ ? std::max(config.tournament.concurrency, core_budget_->capacity())
+                                            : config.tournament.concurrency;
+    broadcast_latency_.Reset();
 
     std::unique_ptr<ijccrl::core::broadcast::IBroadcastAdapter> pgn_adapter;
     std::unique_ptr<ijccrl::core::broadcast::TlcsFeedAdapter> feed_adapter;
@@ -337,6 +537,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         }
     } else if (config.broadcast.adapter == "tlcs_feed") {
         auto tlcs = std::make_unique<ijccrl::core::broadcast::TlcsFeedAdapter>();
+        tlcs->set_broadcast_latency(&broadcast_latency_);
         ijccrl::core::broadcast::TlcsFeedAdapter::Config tlcs_config;
         tlcs_config.server_ini = config.broadcast.tlcs.server_ini;
         tlcs_config.feed_path = config.broadcast.tlcs.feed_path;
@@ -352,6 +553,20 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         }
     }
 
+    ijccrl::core::broadcast::LivePgnPublisher::Config live_config;
+    live_config.live_pgn_path = config.output.live_pgn;
+    live_config.board_files = config.output.live_board_files;
+    live_config.max_rate_hz = config.output.live_max_rate_hz;
+    live_config.latency = &broadcast_latency_;
+    ijccrl::core::broadcast::LivePgnPublisher live_publisher(
+        live_config,
+        [&pgn_adapter](const std::string& live_pgn) {
+            if (pgn_adapter) {
+                pgn_adapter->PublishLivePgn(live_pgn);
+            }
+        });
+    live_publisher.Start();
+
     std::vector<ijccrl::core::runtime::EngineSpec> specs;
     std::vector<std::string> engine_names;
     specs.reserve(config.engines.size());
@@ -371,6 +586,24 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         [this](const std::string& line) { AppendLogLine(line); });
     pool.set_handshake_timeout_ms(config.watchdog.handshake_timeout_ms);
     pool.set_watchdog_enabled(config.watchdog.enabled);
+    // Every gauntlet fixture includes a gauntlet engine and every SPRT game
+    // pairs the first two engines; with one process each they would cap the
+    // event at one game per such engine.
+    std::vector<int> gauntlet_ids;
+    if (config.tournament.mode == "gauntlet") {
+        std::vector<std::string> unknown_engines;
+        gauntlet_ids = ResolveGauntletEngines(config, &unknown_engines);
+        for (const auto& name : unknown_engines) {
+            AppendLogLine("[ijccrl] Unknown gauntlet engine: " + name);
+        }
+        const int opponents = static_cast<int>(config.engines.size() - gauntlet_ids.size());
+        for (const int engine_id : gauntlet_ids) {
+            pool.set_instances(engine_id, std::max(1, std::min(config.tournament.concurrency, opponents)));
+        }
+    } else if (config.tournament.mode == "sprt" && config.engines.size() >= 2) {
+        pool.set_instances(0, std::max(1, config.tournament.concurrency));
+        pool.set_instances(1, std::max(1, config.tournament.concurrency));
+    }
     {
         std::ostringstream message;
         message << "[watchdog] enabled=" << std::boolalpha << config.watchdog.enabled
@@ -378,7 +611,8 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 << " go_timeout_ms=" << config.watchdog.go_timeout_ms;
         AppendLogLine(message.str());
     }
-    if (!pool.StartAll("")) {
+    // With a coordinator the workers start their own engines.
+    if (config.distributed.listen.empty() && !pool.StartAll("")) {
         AppendLogLine("[ijccrl] Failed to start engine pool");
         running_.store(false);
         {
@@ -388,28 +622,104 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         return;
     }
 
-    std::vector<ijccrl::core::openings::Opening> openings;
-    if (!config.openings.path.empty()) {
-        if (config.openings.type == "epd") {
-            openings = ijccrl::core::openings::EpdParser::LoadFile(config.openings.path);
-        } else if (config.openings.type == "pgn") {
-            openings = ijccrl::core::openings::PgnSuite::LoadFile(config.openings.path);
+    ijccrl::core::persist::CheckpointState checkpoint_state;
+    const std::string checkpoint_path = config.output.checkpoint_json;
+    ijccrl::core::runtime::DurationModel duration_model(DefaultGameSeconds(config));
+    const std::string durations_path = ijccrl::core::runtime::DurationModel::PathFor(checkpoint_path);
+    if (std::filesystem::exists(durations_path)) {
+        std::string error;
+        if (!duration_model.Load(durations_path, &error)) {
+            AppendLogLine("[ijccrl] " + error);
+        }
+    }
+    const std::string config_hash =
+        ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(config));
+    bool has_checkpoint = false;
+    if (resume && std::filesystem::exists(checkpoint_path)) {
+        std::string error;
+        if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
+            if (checkpoint_state.config_hash == config_hash) {
+                has_checkpoint = true;
+                AppendLogLine("[ijccrl] Resuming from checkpoint");
+                if (!checkpoint_state.active_games.empty()) {
+                    AppendLogLine("[ijccrl] Active games will continue from their last journaled move");
+                }
+            } else {
+                AppendLogLine("[ijccrl] Checkpoint config mismatch; starting fresh");
+            }
+        } else {
+            AppendLogLine("[ijccrl] Failed to load checkpoint: " + error);
+        }
+    }
+
+    // Openings are decoded on demand through the suite's offset index.
+    ijccrl::core::openings::OpeningSource openings;
+    if (!config.openings.path.empty() &&
+        (config.openings.type == "epd" || config.openings.type == "pgn" || config.openings.type == "polyglot")) {
+        ijccrl::core::openings::OpeningSource::Options opening_options;
+        opening_options.dedupe = config.openings.dedupe;
+        opening_options.position_ids = config.openings.position_ids;
+        opening_options.book_lines = static_cast<size_t>(std::max(1, config.openings.book_lines));
+        opening_options.book_depth = std::max(1, config.openings.book_depth);
+        opening_options.book_seed = static_cast<uint32_t>(config.openings.seed);
+        std::string opening_error;
+        if (openings.Open(config.openings.path, config.openings.type, opening_options, &opening_error)) {
+            AppendLogLine("[ijccrl] " + std::to_string(openings.size()) + " openings loaded, " +
+                          std::to_string(openings.duplicates_removed()) + " duplicate positions removed");
+        } else {
+            AppendLogLine("[ijccrl] " + opening_error);
         }
     }
     if (openings.empty()) {
         ijccrl::core::openings::Opening startpos;
         startpos.id = "startpos";
-        openings.push_back(startpos);
+        openings.Assign({startpos});
+    }
+    // Results per opening accumulate across events. The openings the bias check
+    // skips are saved in the checkpoint and skipped again on resume, whatever
+    // the shared stats have recorded since.
+    const std::string stats_event = OpeningStatsEvent(config);
+    std::vector<std::string> excluded_openings;
+    ijccrl::core::stats::OpeningStats opening_stats;
+    if (!config.output.opening_stats.empty()) {
+        std::string stats_error;
+        if (!opening_stats.Open(config.output.opening_stats, &stats_error)) {
+            AppendLogLine("[ijccrl] " + stats_error);
+        }
+    }
+    if (has_checkpoint && !checkpoint_state.excluded_openings.empty()) {
+        excluded_openings = checkpoint_state.excluded_openings;
+        const std::unordered_set<std::string> excluded(excluded_openings.begin(), excluded_openings.end());
+        const size_t skipped = openings.Exclude([&](const ijccrl::core::openings::Opening& opening) {
+            return excluded.count(opening.id) > 0;
+        });
+        AppendLogLine("[ijccrl] " + std::to_string(skipped) + " openings skipped, as saved in the checkpoint");
+    } else if (!has_checkpoint && opening_stats.is_open() && config.openings.max_bias > 0.0) {
+        const auto totals = opening_stats.Totals(stats_event);
+        const size_t skipped = openings.Exclude([&](const ijccrl::core::openings::Opening& opening) {
+            const auto it = totals.find(opening.id);
+            const bool unbalanced = it != totals.end() && it->second.games() >= config.openings.bias_min_games &&
+                                    it->second.bias() > config.openings.max_bias;
+            if (unbalanced) {
+                excluded_openings.push_back(opening.id);
+            }
+            return unbalanced;
+        });
+        AppendLogLine("[ijccrl] " + std::to_string(skipped) + " unbalanced openings skipped");
     }
-    if (config.openings.seed != 0) {
-        std::mt19937 rng(static_cast<uint32_t>(config.openings.seed));
-        std::shuffle(openings.begin(), openings.end(), rng);
+    if (config.openings.policy == "random") {
+        openings.Permute(static_cast<std::uint64_t>(config.openings.seed));
+    } else if (config.openings.seed != 0) {
+        openings.Shuffle(static_cast<uint32_t>(config.openings.seed));
     }
 
     if (config.tournament.mode == "swiss") {
         const std::string event_name = "ijccrl swiss";
         const int engine_count = static_cast<int>(engine_names.size());
-        const int games_per_pairing = std::max(1, config.tournament.games_per_pairing);
+        const bool paired_openings = config.tournament.paired_openings;
+        const int games_per_pairing = paired_openings ? PairedGamesPerPairing(config.tournament.games_per_pairing)
+                                                      : std::max(1, config.tournament.games_per_pairing);
+        const int opening_games_per_pairing = paired_openings ? 2 : games_per_pairing;
         const int fixtures_per_round = (engine_count / 2) * games_per_pairing;
         int total_rounds = std::max(1, config.tournament.rounds);
         if (config.limits.max_games > 0 && fixtures_per_round > 0) {
@@ -425,26 +735,16 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             state_.totalRounds = total_rounds;
         }
 
-        ijccrl::core::persist::CheckpointState checkpoint_state;
-        const std::string checkpoint_path = config.output.checkpoint_json;
-        const std::string config_hash =
-            ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(config));
-        bool has_checkpoint = false;
-        if (resume && std::filesystem::exists(checkpoint_path)) {
-            std::string error;
-            if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
-                if (checkpoint_state.config_hash == config_hash) {
-                    has_checkpoint = true;
-                    AppendLogLine("[ijccrl] Resuming from checkpoint");
-                    if (!checkpoint_state.active_games.empty()) {
-                        AppendLogLine("[ijccrl] Active games will be restarted on resume");
-                    }
-                } else {
-                    AppendLogLine("[ijccrl] Checkpoint config mismatch; starting fresh");
-                }
-            } else {
-                AppendLogLine("[ijccrl] Failed to load checkpoint: " + error);
+        ijccrl::core::persist::CheckpointJournal journal;
+        if (config.output.checkpoint_journal) {
+            if (!journal.Open(ijccrl::core::persist::JournalPathFor(checkpoint_path),
+                              has_checkpoint ? checkpoint_state.journal_seq : 0,
+                              !has_checkpoint)) {
+                AppendLogLine("[ijccrl] Failed to open checkpoint journal; using full checkpoints");
             }
+        } else {
+            std::error_code journal_ec;
+            std::filesystem::remove(ijccrl::core::persist::JournalPathFor(checkpoint_path), journal_ec);
         }
 
         std::vector<int> completed_fixture_indices;
@@ -481,7 +781,6 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         std::atomic<int> completed_count{static_cast<int>(completed_set.size())};
 
         std::unordered_set<long long> pairings_played_set;
-        std::vector<std::vector<int>> opponent_history(static_cast<size_t>(engine_count));
         for (const auto& pairing : pairings_played) {
             const int white = pairing.white_engine_id;
             const int black = pairing.black_engine_id;
@@ -491,11 +790,14 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
                                   static_cast<unsigned int>(std::max(white, black));
             pairings_played_set.insert(key);
-            opponent_history[static_cast<size_t>(white)].push_back(black);
-            opponent_history[static_cast<size_t>(black)].push_back(white);
         }
 
         ijccrl::core::stats::StandingsTable standings(engine_names);
+        std::vector<std::string> unknown_tie_breaks;
+        standings.SetTieBreakOrder(ResolveTieBreaks(config, &unknown_tie_breaks));
+        for (const auto& name : unknown_tie_breaks) {
+            AppendLogLine("[ijccrl] Unknown tie-break: " + name);
+        }
         if (has_checkpoint && !checkpoint_state.standings.empty()) {
             std::vector<ijccrl::core::stats::EngineStats> snapshot;
             snapshot.reserve(engine_names.size());
@@ -518,6 +820,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
             standings.LoadSnapshot(snapshot);
         }
+        for (const auto& game : completed_games) {
+            standings.RestoreResult(EngineIdByName(engine_names, game.white),
+                                    EngineIdByName(engine_names, game.black),
+                                    game.result,
+                                    paired_openings ? game.fixture_index / 2 : -1);
+        }
+        if (config.tournament.bye_points > 0.0) {
+            for (const int bye_engine : bye_history) {
+                standings.RestoreBye(bye_engine, config.tournament.bye_points);
+            }
+        }
+        standings.UpdateRatings();
+        standings.UpdateRanks();
         {
             std::lock_guard<std::mutex> lock(standings_mutex_);
             standings_.clear();
@@ -531,8 +846,17 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                     entry.losses,
                     entry.points,
                     entry.score_percent(),
+                    entry.elo,
+                    entry.elo_error,
+                    entry.rank,
+                    entry.buchholz,
+                    entry.sonneborn_berger,
+                    entry.koya,
+                    entry.search,
                 });
             }
+            crosstable_ = MakeCrosstableSnapshot(standings);
+            simulation_ = {};
         }
 
         struct PendingFixture {
@@ -548,11 +872,29 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
         }
 
+        std::vector<bool> early_paired(static_cast<size_t>(engine_count), false);
+        std::vector<std::pair<int, int>> early_pairings;
+        bool round_paired = false;
+        for (const auto& pending : pending_fixtures) {
+            if (pending.fixture.round_index == current_round) {
+                round_paired = true;
+            } else if (pending.fixture.round_index == current_round + 1) {
+                early_paired[static_cast<size_t>(pending.fixture.white_engine_id)] = true;
+                early_paired[static_cast<size_t>(pending.fixture.black_engine_id)] = true;
+                if (pending.fixture.game_index_within_pairing == 0) {
+                    early_pairings.emplace_back(pending.fixture.white_engine_id, pending.fixture.black_engine_id);
+                }
+            }
+        }
+
         std::unordered_map<long long, int> pairing_games_completed;
         std::unordered_map<long long, int> pairing_games_total;
-        if (!pending_fixtures.empty()) {
+        {
             std::unordered_map<long long, int> pending_counts;
             for (const auto& pending : pending_fixtures) {
+                if (completed_set.count(pending.fixture_index) > 0) {
+                    continue;
+                }
                 const int white = pending.fixture.white_engine_id;
                 const int black = pending.fixture.black_engine_id;
                 const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
@@ -565,6 +907,11 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
         }
 
+        ijccrl::core::runtime::JobQueue job_queue;
+        std::mutex overlap_mutex;
+        std::unordered_map<int, std::chrono::steady_clock::time_point> early_started;
+        double overlap_seconds = 0.0;
+
         const auto update_pairings_list = [&](const std::vector<std::pair<int, int>>& pairings,
                                               int bye_engine_id) {
             std::vector<std::string> round_pairings;
@@ -601,25 +948,30 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         std::vector<ijccrl::core::persist::ActiveGameMeta> active_games_meta;
         std::unordered_map<std::string, int> termination_counts;
 
-        const auto live_update = [&](const ijccrl::core::pgn::PgnGame& live_game) {
-            const std::string live_pgn = ijccrl::core::pgn::PgnWriter::Render(live_game);
-            if (pgn_adapter) {
-                pgn_adapter->PublishLivePgn(live_pgn);
-            }
-            if (!WriteLivePgn(config.output.live_pgn, live_pgn)) {
-                disk_write_errors.fetch_add(1);
-            }
+        const auto live_update = [&](const ijccrl::core::runtime::MatchJob&,
+                                     int,
+                                     int board,
+                                     const ijccrl::core::pgn::PgnGame& live_game) {
+            live_publisher.Update(board, live_game);
 
             std::lock_guard<std::mutex> lock(state_mutex_);
             if (!live_game.moves.empty()) {
                 state_.lastMove = live_game.moves.back();
             }
+            broadcast_latency_.Record(ijccrl::core::util::BroadcastStage::GuiState);
         };
 
         const auto on_job_event = [&](const ijccrl::core::runtime::MatchJob& job,
                                       int game_number,
                                       bool started) {
             if (started) {
+                {
+                    std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                    auto it = early_started.find(job.fixture_index);
+                    if (it != early_started.end()) {
+                        it->second = std::chrono::steady_clock::now();
+                    }
+                }
                 if (feed_adapter) {
                     ijccrl::core::broadcast::GameInfo info;
                     info.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
@@ -652,6 +1004,11 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                     active.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
                     active.black = engine_names[static_cast<size_t>(job.fixture.black_engine_id)];
                     active.opening_id = job.opening.id;
+                    active.progress = job.resume;
+                    journal.AppendStarted(active);
+                    if (!job.resume.moves_uci.empty()) {
+                        journal.AppendProgress(game_number, job.fixture_index, job.resume);
+                    }
                     active_games_meta.push_back(std::move(active));
                 }
             } else {
@@ -670,6 +1027,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
         };
 
+        const auto progress_update = [&](const ijccrl::core::runtime::MatchJob& job,
+                                         int game_number,
+                                         const ijccrl::core::game::GameProgress& progress) {
+            std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+            for (auto& active : active_games_meta) {
+                if (active.game_no == game_number) {
+                    active.progress = progress;
+                    break;
+                }
+            }
+            journal.AppendProgress(game_number, job.fixture_index, progress);
+        };
+
         const auto move_update = [&](const ijccrl::core::runtime::MatchJob&,
                                      int,
                                      const std::string& move_uci,
@@ -680,6 +1050,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         };
 
         std::function<void()> write_checkpoint;
+        std::function<void()> schedule_rounds;
         const auto on_result = [&](const ijccrl::core::runtime::MatchResult& result) {
             const auto& fixture = result.job.fixture;
             const std::string final_pgn = ijccrl::core::pgn::PgnWriter::Render(result.result.pgn);
@@ -718,7 +1089,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 }
             }
 
-            standings.RecordResult(fixture.white_engine_id, fixture.black_engine_id, result.result.state.result);
+            standings.RecordResult(fixture.white_engine_id,
+                                  fixture.black_engine_id,
+                                  result.result.state.result,
+                                  paired_openings ? result.job.fixture_index / 2 : -1);
+            standings.RecordSearch(fixture.white_engine_id, result.result.white_search);
+            standings.RecordSearch(fixture.black_engine_id, result.result.black_search);
+            standings.UpdateRatings();
+            standings.UpdateRanks();
+            duration_model.Record(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                                  engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                                  result.job.opening.id,
+                                  static_cast<int>(result.result.state.moves_uci.size()),
+                                  result.duration_seconds);
             if (!result.result.state.termination.empty()) {
                 termination_counts[result.result.state.termination] += 1;
             }
@@ -747,20 +1130,22 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 entry.white_engine_id = std::min(fixture.white_engine_id, fixture.black_engine_id);
                 entry.black_engine_id = std::max(fixture.white_engine_id, fixture.black_engine_id);
                 pairings_played.push_back(entry);
-                opponent_history[static_cast<size_t>(fixture.white_engine_id)].push_back(fixture.black_engine_id);
-                opponent_history[static_cast<size_t>(fixture.black_engine_id)].push_back(fixture.white_engine_id);
             }
 
-            pending_fixtures.erase(std::remove_if(pending_fixtures.begin(),
-                                                  pending_fixtures.end(),
-                                                  [&](const auto& pending) {
-                                                      return pending.fixture_index == result.job.fixture_index;
-                                                  }),
-                                   pending_fixtures.end());
-            if (pending_fixtures.empty()) {
-                current_round += 1;
-                pairing_games_completed.clear();
-                pairing_games_total.clear();
+            if (completed >= total) {
+                pairing_games_completed.erase(pairing_key);
+                pairing_games_total.erase(pairing_key);
+            }
+            {
+                std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                auto it = early_started.find(result.job.fixture_index);
+                if (it != early_started.end()) {
+                    if (it->second != std::chrono::steady_clock::time_point{}) {
+                        overlap_seconds +=
+                            std::chrono::duration<double>(std::chrono::steady_clock::now() - it->second).count();
+                    }
+                    early_started.erase(it);
+                }
             }
 
             std::ostringstream csv_line;
@@ -777,6 +1162,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 disk_write_errors.fetch_add(1);
             }
 
+            if (opening_stats.is_open()) {
+                ijccrl::core::stats::OpeningGame stats_game;
+                stats_game.opening_id = result.job.opening.id;
+                stats_game.event = stats_event;
+                stats_game.fixture_index = result.job.fixture_index;
+                stats_game.result = result.result.state.result;
+                stats_game.plies = static_cast<int>(result.result.state.moves_uci.size());
+                stats_game.termination = result.result.state.termination;
+                if (!opening_stats.Record(stats_game)) {
+                    disk_write_errors.fetch_add(1);
+                }
+            }
+
             std::ostringstream log_line;
             log_line << "GAME END #" << result.game_number << " | "
                      << engine_names[static_cast<size_t>(fixture.white_engine_id)] << " vs "
@@ -813,6 +1211,14 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             ijccrl::core::exporter::WriteStandingsHtml(config.output.standings_html,
                                                        event_name,
                                                        standings.standings());
+            ijccrl::core::exporter::WriteCrosstableJson(config.output.crosstable_json,
+                                                       event_name,
+                                                       standings.standings(),
+                                                       standings.crosstable());
+            ijccrl::core::exporter::WriteCrosstableHtml(config.output.crosstable_html,
+                                                       event_name,
+                                                       standings.standings(),
+                                                       standings.crosstable());
             ijccrl::core::exporter::WriteSummaryJson(config.output.summary_json,
                                                      event_name,
                                                      tc_desc.str(),
@@ -832,8 +1238,16 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                         entry.losses,
                         entry.points,
                         entry.score_percent(),
+                        entry.elo,
+                        entry.elo_error,
+                        entry.rank,
+                        entry.buchholz,
+                        entry.sonneborn_berger,
+                        entry.koya,
+                        entry.search,
                     });
                 }
+                crosstable_ = MakeCrosstableSnapshot(standings);
             }
 
             {
@@ -848,13 +1262,24 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 meta.termination = result.result.state.termination;
                 meta.pgn_offset = pgn_offset;
                 meta.pgn_path = config.output.tournament_pgn;
+                if (journal.is_open() &&
+                    !journal.AppendCompleted(meta,
+                                             fixture.white_engine_id,
+                                             fixture.black_engine_id,
+                                             FormatUtcTimestamp(std::time(nullptr)))) {
+                    disk_write_errors.fetch_add(1);
+                }
                 completed_games.push_back(std::move(meta));
                 completed_set.insert(result.job.fixture_index);
                 completed_count.store(static_cast<int>(completed_set.size()));
             }
+            schedule_rounds();
             last_game_number.store(result.game_number);
             last_game_end_time.store(std::time(nullptr));
-            if (write_checkpoint) {
+            if (write_checkpoint &&
+                (!journal.is_open() ||
+                 journal.completed_since_compaction() >=
+                     static_cast<size_t>(std::max(1, config.output.checkpoint_compact_records)))) {
                 write_checkpoint();
             }
         };
@@ -869,6 +1294,9 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         control.paused = &paused_;
         control.pause_mutex = &pause_mutex_;
         control.pause_cv = &pause_cv_;
+        control.budget = core_budget_;
+        control.budget_client = core_budget_client_;
+        control.latency = &broadcast_latency_;
 
         const auto watchdog_log = [this](const std::string& line) {
             AppendLogLine(line);
@@ -878,6 +1306,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             ijccrl::core::persist::CheckpointState snapshot;
             snapshot.version = 2;
             snapshot.config_hash = config_hash;
+            snapshot.excluded_openings = excluded_openings;
             snapshot.total_games = total_games;
             snapshot.next_fixture_index = next_fixture_index;
             snapshot.opening_index = next_fixture_index;
@@ -902,13 +1331,18 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 std::lock_guard<std::mutex> lock(checkpoint_mutex);
                 snapshot.completed_games = completed_games;
                 snapshot.active_games = active_games_meta;
+                snapshot.journal_seq = journal.last_seq();
                 completed_snapshot.assign(completed_set.begin(), completed_set.end());
             }
             snapshot.completed_fixture_indices = completed_snapshot;
 
-            if (!pending_fixtures.empty()) {
+            const auto next_pending =
+                std::find_if(pending_fixtures.begin(), pending_fixtures.end(), [&](const auto& pending) {
+                    return completed_set.count(pending.fixture_index) == 0;
+                });
+            if (next_pending != pending_fixtures.end()) {
                 snapshot.next_fixture_index = next_fixture_index;
-                const auto& pending = pending_fixtures.front();
+                const auto& pending = *next_pending;
                 snapshot.next_game.fixture_index = pending.fixture_index;
                 snapshot.next_game.white =
                     engine_names[static_cast<size_t>(pending.fixture.white_engine_id)];
@@ -916,7 +1350,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                     engine_names[static_cast<size_t>(pending.fixture.black_engine_id)];
                 snapshot.next_game.opening_id =
                     ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
-                        pending.fixture_index, openings, games_per_pairing)
+                        pending.fixture_index, openings, opening_games_per_pairing)
                         .id;
             }
 
@@ -943,21 +1377,67 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 }
             }
 
-            if (!ijccrl::core::persist::SaveCheckpoint(checkpoint_path, snapshot)) {
+            if (!ijccrl::core::persist::SaveCheckpoint(
+                    checkpoint_path,
+                    snapshot,
+                    ijccrl::core::persist::CheckpointFormatFromString(config.output.checkpoint_format))) {
+                disk_write_errors.fetch_add(1);
+            } else if (journal.is_open()) {
+                journal.Compact(snapshot.journal_seq);
+            }
+            if (!duration_model.Save(durations_path)) {
                 disk_write_errors.fetch_add(1);
             }
         };
 
+        std::unique_ptr<ijccrl::core::distributed::Coordinator> coordinator;
+        if (!config.distributed.listen.empty()) {
+            coordinator = std::make_unique<ijccrl::core::distributed::Coordinator>(
+                RunnerConfig::ToJsonString(config),
+                on_result,
+                live_update,
+                move_update,
+                [this](const std::string& line) { AppendLogLine("[ijccrl] " + line); },
+                on_job_event,
+                progress_update);
+            std::string listen_error;
+            if (!coordinator->Start(config.distributed.listen, config.distributed.token, &listen_error)) {
+                AppendLogLine("[ijccrl] " + listen_error);
+                running_.store(false);
+                {
+                    std::lock_guard<std::mutex> lock(state_mutex_);
+                    state_.running = false;
+                }
+                return;
+            }
+        }
+
+        // The timers wait on timer_cv so that stopping them does not wait out
+        // a whole interval.
+        std::mutex timer_mutex;
+        std::condition_variable timer_cv;
         std::atomic<bool> checkpoint_running{false};
         std::thread checkpoint_thread;
         if (config.output.checkpoint_interval_seconds > 0) {
             checkpoint_running.store(true);
             checkpoint_thread = std::thread([&]() {
                 while (checkpoint_running.load()) {
-                    std::this_thread::sleep_for(std::chrono::seconds(config.output.checkpoint_interval_seconds));
-                    if (!running_.load()) {
+                    {
+                        std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                        timer_cv.wait_for(timer_lock,
+                                          std::chrono::seconds(config.output.checkpoint_interval_seconds),
+                                          [&]() { return !checkpoint_running.load(); });
+                    }
+                    if (!checkpoint_running.load() || !running_.load()) {
                         break;
                     }
+                    // Finished games are already in the journal; snapshots follow
+                    // checkpoint_compact_records.
+                    if (journal.is_open()) {
+                        journal.Flush();
+                        continue;
+                    }
+                    std::lock_guard<std::mutex> lock(output_mutex);
                     write_checkpoint();
                 }
             });
@@ -969,8 +1449,13 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             metrics_running.store(true);
             metrics_thread = std::thread([&]() {
                 while (metrics_running.load()) {
-                    std::this_thread::sleep_for(std::chrono::seconds(config.output.metrics_interval_seconds));
-                    if (!running_.load()) {
+                    {
+                        std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                        timer_cv.wait_for(timer_lock,
+                                          std::chrono::seconds(config.output.metrics_interval_seconds),
+                                          [&]() { return !metrics_running.load(); });
+                    }
+                    if (!metrics_running.load() || !running_.load()) {
                         break;
                     }
                     nlohmann::json metrics;
@@ -980,7 +1465,24 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                     metrics["engines_running"] = static_cast<int>(engine_names.size());
                     std::time_t last_time = last_game_end_time.load();
                     metrics["last_game_end_time"] = last_time == 0 ? "" : FormatUtcTimestamp(last_time);
-                    metrics["disk_write_errors_count"] = disk_write_errors.load();
+                    metrics["disk_write_errors_count"] =
+                        disk_write_errors.load() + live_publisher.write_errors();
+                    metrics["live_pgn_writes"] = live_publisher.writes();
+                    metrics["live_pgn_coalesced_updates"] = live_publisher.coalesced_updates();
+                    metrics["broadcast_latency_ms"] = BroadcastLatencyJson(broadcast_latency_);
+                    {
+                        std::lock_guard<std::mutex> lock(output_mutex);
+                        nlohmann::json search = nlohmann::json::object();
+                        for (const auto& entry : standings.standings()) {
+                            search[entry.name] = SearchJson(entry.search);
+                        }
+                        metrics["engine_search"] = std::move(search);
+                    }
+                    metrics["worker_idle_seconds"] = job_queue.idle_seconds();
+                    {
+                        std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                        metrics["swiss_overlap_core_seconds"] = overlap_seconds;
+                    }
                     if (!ijccrl::core::util::AtomicFileWriter::Write(config.output.metrics_json,
                                                                      metrics.dump(2))) {
                         disk_write_errors.fetch_add(1);
@@ -1019,94 +1521,245 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                                                         live_update,
                                                         move_update,
                                                         watchdog_log,
-                                                        on_job_event);
+                                                        on_job_event,
+                                                        progress_update);
 
         write_checkpoint();
 
-        while (current_round < total_rounds && !stop_requested_.load()) {
-            std::vector<ijccrl::core::runtime::MatchJob> jobs;
-            if (pending_fixtures.empty()) {
-                std::vector<double> scores;
-                scores.reserve(engine_count);
-                for (const auto& entry : standings.standings()) {
-                    scores.push_back(entry.points);
-                }
+        ijccrl::core::tournament::SwissScheduler scheduler;
+        const auto current_scores = [&]() {
+            std::vector<double> scores;
+            scores.reserve(static_cast<size_t>(engine_count));
+            for (const auto& entry : standings.standings()) {
+                scores.push_back(entry.points);
+            }
+            return scores;
+        };
 
-                ijccrl::core::tournament::SwissScheduler scheduler;
-                const auto swiss_round = scheduler.BuildSwissRound(current_round,
-                                                                   scores,
-                                                                   opponent_history,
-                                                                   bye_history,
-                                                                   color_history,
-                                                                   pairings_played_set,
-                                                                   games_per_pairing,
-                                                                   config.tournament.avoid_repeats);
-
-                const int bye_engine = swiss_round.round.bye_engine_id.value_or(-1);
-                if (bye_engine >= 0) {
-                    if (config.tournament.bye_points > 0.0) {
-                        standings.RecordBye(bye_engine, config.tournament.bye_points);
-                    }
-                    bye_history.push_back(bye_engine);
-                    AppendLogLine("[ijccrl] Swiss bye: " + engine_names[static_cast<size_t>(bye_engine)]);
+        const auto make_job = [&](const PendingFixture& pending) {
+            ijccrl::core::runtime::MatchJob job;
+            job.fixture = pending.fixture;
+            job.opening = ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
+                pending.fixture_index, openings, opening_games_per_pairing);
+            job.event_name = event_name;
+            job.site_tag = site_tag;
+            job.round_label = std::to_string(pending.fixture.round_index + 1);
+            job.fixture_index = pending.fixture_index;
+            if (has_checkpoint) {
+                const auto* active = ijccrl::core::persist::FindActiveGame(checkpoint_state, job.fixture_index);
+                if (active && active->opening_id == job.opening.id) {
+                    job.resume = active->progress;
                 }
+            }
+            return job;
+        };
 
-                update_pairings_list(swiss_round.pairings, bye_engine);
-
-                for (const auto& pairing : swiss_round.pairings) {
-                    const long long key = (static_cast<long long>(std::min(pairing.first, pairing.second)) << 32) |
-                                          static_cast<unsigned int>(std::max(pairing.first, pairing.second));
-                    pairing_games_total[key] = games_per_pairing;
+        const bool longest_first = config.tournament.job_order == "longest_first";
+        const auto add_fixtures = [&](const ijccrl::core::tournament::SwissRound& swiss_round, bool early) {
+            std::vector<ijccrl::core::runtime::MatchJob> batch;
+            batch.reserve(swiss_round.round.fixtures.size());
+            for (const auto& pairing : swiss_round.pairings) {
+                const long long key = (static_cast<long long>(std::min(pairing.first, pairing.second)) << 32) |
+                                      static_cast<unsigned int>(std::max(pairing.first, pairing.second));
+                pairing_games_total[key] = games_per_pairing;
+                if (early) {
+                    early_paired[static_cast<size_t>(pairing.first)] = true;
+                    early_paired[static_cast<size_t>(pairing.second)] = true;
+                    early_pairings.push_back(pairing);
+                }
+            }
+            for (const auto& fixture : swiss_round.round.fixtures) {
+                PendingFixture pending;
+                pending.fixture = fixture;
+                pending.fixture_index = next_fixture_index++;
+                pending_fixtures.push_back(pending);
+                if (early) {
+                    std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                    early_started.emplace(pending.fixture_index, std::chrono::steady_clock::time_point{});
+                }
+                batch.push_back(make_job(pending));
+            }
+            std::vector<size_t> order(batch.size());
+            std::iota(order.begin(), order.end(), 0);
+            if (longest_first) {
+                std::vector<double> predicted;
+                predicted.reserve(batch.size());
+                for (const auto& job : batch) {
+                    predicted.push_back(
+                        duration_model.Predict(engine_names[static_cast<size_t>(job.fixture.white_engine_id)],
+                                               engine_names[static_cast<size_t>(job.fixture.black_engine_id)],
+                                               job.opening.id));
                 }
+                order = ijccrl::core::runtime::LongestFirstOrder(predicted);
+            }
+            for (size_t index : order) {
+                job_queue.Push(std::move(batch[index]));
+            }
+        };
 
-                pending_fixtures.clear();
-                for (const auto& fixture : swiss_round.round.fixtures) {
-                    PendingFixture pending;
-                    pending.fixture = fixture;
-                    pending.fixture_index = next_fixture_index++;
-                    pending_fixtures.push_back(pending);
+        // Called with output_mutex held. Pairs the current round once the
+        // previous one is final and, in overlap mode, pairs settled score
+        // groups of the following round while the current one finishes.
+        schedule_rounds = [&]() {
+            while (!stop_requested_.load()) {
+                const bool current_open =
+                    std::any_of(pending_fixtures.begin(), pending_fixtures.end(), [&](const auto& pending) {
+                        return pending.fixture.round_index == current_round &&
+                               completed_set.count(pending.fixture_index) == 0;
+                    });
+                if (round_paired && !current_open) {
+                    pending_fixtures.erase(std::remove_if(pending_fixtures.begin(),
+                                                          pending_fixtures.end(),
+                                                          [&](const auto& pending) {
+                                                              return pending.fixture.round_index <= current_round;
+                                                          }),
+                                           pending_fixtures.end());
+                    if (config.tournament.swiss_overlap) {
+                        std::lock_guard<std::mutex> overlap_lock(overlap_mutex);
+                        const auto now = std::chrono::steady_clock::now();
+                        for (const auto& entry : early_started) {
+                            if (entry.second != std::chrono::steady_clock::time_point{}) {
+                                overlap_seconds += std::chrono::duration<double>(now - entry.second).count();
+                            }
+                        }
+                        early_started.clear();
+                        std::ostringstream line;
+                        line << std::fixed << std::setprecision(1) << "[ijccrl] Swiss round "
+                             << (current_round + 1) << " complete; early pairings used " << overlap_seconds
+                             << " core-s of round tail so far";
+                        AppendLogLine(line.str());
+                    }
+                    current_round += 1;
+                    round_paired = false;
+                    continue;
+                }
+                if (current_round >= total_rounds) {
+                    break;
+                }
+                if (!round_paired) {
+                    const auto swiss_round = scheduler.BuildSwissRound(current_round,
+                                                                       current_scores(),
+                                                                       standings.ranking(),
+                                                                       bye_history,
+                                                                       color_history,
+                                                                       pairings_played_set,
+                                                                       games_per_pairing,
+                                                                       config.tournament.avoid_repeats,
+                                                                       early_paired);
+
+                    const int bye_engine = swiss_round.round.bye_engine_id.value_or(-1);
+                    if (bye_engine >= 0) {
+                        if (config.tournament.bye_points > 0.0) {
+                            standings.RecordBye(bye_engine, config.tournament.bye_points);
+                        }
+                        bye_history.push_back(bye_engine);
+                        AppendLogLine("[ijccrl] Swiss bye: " + engine_names[static_cast<size_t>(bye_engine)]);
+                    }
+                    std::vector<std::pair<int, int>> round_pairings = early_pairings;
+                    round_pairings.insert(round_pairings.end(), swiss_round.pairings.begin(), swiss_round.pairings.end());
+                    update_pairings_list(round_pairings, bye_engine);
+
+                    add_fixtures(swiss_round, false);
+                    early_paired.assign(early_paired.size(), false);
+                    early_pairings.clear();
+                    round_paired = true;
+                    if (journal.is_open()) {
+                        write_checkpoint();
+                    }
+                    continue;
                 }
+                if (config.tournament.swiss_overlap && current_round + 1 < total_rounds) {
+                    std::vector<double> pending_points(static_cast<size_t>(engine_count), 0.0);
+                    for (const auto& pending : pending_fixtures) {
+                        if (pending.fixture.round_index == current_round &&
+                            completed_set.count(pending.fixture_index) == 0) {
+                            pending_points[static_cast<size_t>(pending.fixture.white_engine_id)] += 1.0;
+                            pending_points[static_cast<size_t>(pending.fixture.black_engine_id)] += 1.0;
+                        }
+                    }
+                    const auto early_round = scheduler.BuildEarlyPairings(current_round + 1,
+                                                                          current_scores(),
+                                                                          pending_points,
+                                                                          early_paired,
+                                                                          standings.ranking(),
+                                                                          color_history,
+                                                                          pairings_played_set,
+                                                                          games_per_pairing,
+                                                                          config.tournament.avoid_repeats);
+                    if (!early_round.pairings.empty()) {
+                        add_fixtures(early_round, true);
+                        std::ostringstream line;
+                        line << "[ijccrl] Swiss round " << (current_round + 2) << ": "
+                             << early_round.pairings.size() << " pairings started early";
+                        AppendLogLine(line.str());
+                        if (journal.is_open()) {
+                            write_checkpoint();
+                        }
+                    }
+                }
+                break;
+            }
+            if (stop_requested_.load() || current_round >= total_rounds) {
+                job_queue.Close();
             }
+        };
 
-            jobs.reserve(pending_fixtures.size());
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
             for (const auto& pending : pending_fixtures) {
-                if (completed_set.count(pending.fixture_index) > 0) {
-                    continue;
+                if (completed_set.count(pending.fixture_index) == 0) {
+                    job_queue.Push(make_job(pending));
                 }
-                ijccrl::core::runtime::MatchJob job;
-                job.fixture = pending.fixture;
-                job.opening = ijccrl::core::openings::OpeningPolicy::AssignSwissForIndex(
-                    pending.fixture_index, openings, games_per_pairing);
-                job.event_name = event_name;
-                job.site_tag = site_tag;
-                job.round_label = std::to_string(pending.fixture.round_index + 1);
-                job.fixture_index = pending.fixture_index;
-                jobs.push_back(std::move(job));
-            }
-
-            if (jobs.empty()) {
-                current_round += 1;
-                pending_fixtures.clear();
-                continue;
             }
+            schedule_rounds();
+        }
 
-            match_runner.Run(jobs, config.tournament.concurrency, control, initial_game_number);
-            initial_game_number = last_game_number.load();
+        control.drain = job_queue.closed_flag();
+        const ijccrl::core::runtime::MatchRunner::JobSource pop_job =
+            [&](size_t, ijccrl::core::runtime::MatchJob& job) { return job_queue.Pop(job, &stop_requested_); };
+        if (coordinator) {
+            coordinator->Run(
+                std::numeric_limits<size_t>::max(),
+                pop_job,
+                config.tournament.concurrency,
+                control,
+                initial_game_number);
+        } else {
+            match_runner.Run(
+                std::numeric_limits<size_t>::max(),
+                pop_job,
+                runner_threads,
+                control,
+                initial_game_number);
         }
 
-        for (size_t i = 0; i < engine_names.size(); ++i) {
-            pool.engine(static_cast<int>(i)).Stop();
+        if (config.tournament.swiss_overlap) {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << "[ijccrl] Swiss overlap: " << overlap_seconds
+                 << " core-s played during round tails, workers idle " << job_queue.idle_seconds() << " core-s";
+            AppendLogLine(line.str());
         }
 
+        pool.StopAll();
+        live_publisher.Stop();
+
         write_checkpoint();
         if (checkpoint_running.load()) {
-            checkpoint_running.store(false);
+            {
+                std::lock_guard<std::mutex> timer_lock(timer_mutex);
+                checkpoint_running.store(false);
+            }
+            timer_cv.notify_all();
             if (checkpoint_thread.joinable()) {
                 checkpoint_thread.join();
             }
         }
         if (metrics_running.load()) {
-            metrics_running.store(false);
+            {
+                std::lock_guard<std::mutex> timer_lock(timer_mutex);
+                metrics_running.store(false);
+            }
+            timer_cv.notify_all();
             if (metrics_thread.joinable()) {
                 metrics_thread.join();
             }
@@ -1123,69 +1776,65 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         return;
     }
 
-    auto fixtures = ijccrl::core::tournament::RoundRobinScheduler::BuildSchedule(
-        static_cast<int>(config.engines.size()),
-        config.tournament.double_round_robin,
-        config.tournament.games_per_pairing,
-        config.tournament.rounds);
-
-    if (config.limits.max_games > 0 && static_cast<int>(fixtures.size()) > config.limits.max_games) {
-        fixtures.resize(static_cast<size_t>(config.limits.max_games));
+    const bool sprt_mode = config.tournament.mode == "sprt";
+    const bool gauntlet_mode = config.tournament.mode == "gauntlet";
+    const bool paired_openings = sprt_mode || gauntlet_mode || config.tournament.paired_openings;
+    const int games_per_pairing = sprt_mode         ? 2
+                                  : paired_openings ? PairedGamesPerPairing(config.tournament.games_per_pairing)
+                                                    : config.tournament.games_per_pairing;
+    const std::string event_name = gauntlet_mode ? "ijccrl gauntlet" : "ijccrl round robin";
+    const int engine_count = static_cast<int>(config.engines.size());
+    const auto schedule =
+        sprt_mode       ? ijccrl::core::tournament::FixtureGenerator::RoundRobin(
+                              2, false, games_per_pairing, std::max(1, config.tournament.rounds))
+        : gauntlet_mode ? ijccrl::core::tournament::FixtureGenerator::Gauntlet(
+                              engine_count, gauntlet_ids, games_per_pairing, std::max(1, config.tournament.rounds))
+                        : ijccrl::core::tournament::FixtureGenerator::RoundRobin(
+                              engine_count, config.tournament.double_round_robin, games_per_pairing, config.tournament.rounds);
+
+    int total_games = schedule.size();
+    if (config.limits.max_games > 0 && total_games > config.limits.max_games) {
+        total_games = config.limits.max_games;
     }
 
-    auto assigned_openings = ijccrl::core::openings::OpeningPolicy::AssignRoundRobin(
-        fixtures, openings, config.tournament.games_per_pairing);
+    const int opening_games_per_pairing = paired_openings ? 2 : games_per_pairing;
+    const auto opening_for = [&](int fixture_index) {
+        return ijccrl::core::openings::OpeningPolicy::AssignRoundRobinForIndex(
+            fixture_index, openings, opening_games_per_pairing);
+    };
 
-    int total_rounds = 0;
-    for (const auto& fixture : fixtures) {
-        total_rounds = std::max(total_rounds, fixture.round_index + 1);
-    }
+    const int total_rounds = total_games > 0 ? schedule.At(total_games - 1).round_index + 1 : 0;
     {
         std::lock_guard<std::mutex> lock(state_mutex_);
         state_.totalRounds = total_rounds;
+        state_.sprtEnabled = sprt_mode;
     }
 
-    std::vector<std::vector<std::string>> round_pairings_strings(static_cast<size_t>(total_rounds));
-    std::vector<std::unordered_set<long long>> round_pairing_keys(static_cast<size_t>(total_rounds));
-    for (const auto& fixture : fixtures) {
-        if (fixture.game_index_within_pairing != 0) {
-            continue;
-        }
-        const int round_index = fixture.round_index;
-        if (round_index < 0 || round_index >= total_rounds) {
-            continue;
-        }
-        const int white = fixture.white_engine_id;
-        const int black = fixture.black_engine_id;
-        const long long key = (static_cast<long long>(std::min(white, black)) << 32) |
-                              static_cast<unsigned int>(std::max(white, black));
-        if (round_pairing_keys[static_cast<size_t>(round_index)].insert(key).second) {
-            round_pairings_strings[static_cast<size_t>(round_index)].push_back(
-                engine_names[static_cast<size_t>(white)] + " vs " +
-                engine_names[static_cast<size_t>(black)]);
+    const auto round_pairings_for = [&](int round_index) {
+        std::vector<std::string> pairings;
+        const int begin = round_index * schedule.fixtures_per_round();
+        const int end = std::min(total_games, begin + schedule.fixtures_per_round());
+        for (int i = begin; i < end; ++i) {
+            const auto fixture = schedule.At(i);
+            if (fixture.game_index_within_pairing != 0) {
+                continue;
+            }
+            pairings.push_back(engine_names[static_cast<size_t>(fixture.white_engine_id)] + " vs " +
+                               engine_names[static_cast<size_t>(fixture.black_engine_id)]);
         }
-    }
+        return pairings;
+    };
 
-    ijccrl::core::persist::CheckpointState checkpoint_state;
-    const std::string checkpoint_path = config.output.checkpoint_json;
-    const std::string config_hash =
-        ijccrl::core::persist::ComputeConfigHash(RunnerConfig::ToJsonString(config));
-    bool has_checkpoint = false;
-    if (resume && std::filesystem::exists(checkpoint_path)) {
-        std::string error;
-        if (ijccrl::core::persist::LoadCheckpoint(checkpoint_path, checkpoint_state, &error)) {
-            if (checkpoint_state.config_hash == config_hash) {
-                has_checkpoint = true;
-                AppendLogLine("[ijccrl] Resuming from checkpoint");
-                if (!checkpoint_state.active_games.empty()) {
-                    AppendLogLine("[ijccrl] Active games will be restarted on resume");
-                }
-            } else {
-                AppendLogLine("[ijccrl] Checkpoint config mismatch; starting fresh");
-            }
-        } else {
-            AppendLogLine("[ijccrl] Failed to load checkpoint: " + error);
+    ijccrl::core::persist::CheckpointJournal journal;
+    if (config.output.checkpoint_journal) {
+        if (!journal.Open(ijccrl::core::persist::JournalPathFor(checkpoint_path),
+                          has_checkpoint ? checkpoint_state.journal_seq : 0,
+                          !has_checkpoint)) {
+            AppendLogLine("[ijccrl] Failed to open checkpoint journal; using full checkpoints");
         }
+    } else {
+        std::error_code journal_ec;
+        std::filesystem::remove(ijccrl::core::persist::JournalPathFor(checkpoint_path), journal_ec);
     }
 
     std::vector<int> completed_fixture_indices;
@@ -1202,23 +1851,33 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                                           completed_fixture_indices.end());
     std::atomic<int> completed_count{static_cast<int>(completed_set.size())};
 
-    std::vector<ijccrl::core::runtime::MatchJob> jobs;
-    jobs.reserve(fixtures.size());
-    for (size_t i = 0; i < fixtures.size(); ++i) {
-        if (completed_set.count(static_cast<int>(i)) > 0) {
-            continue;
+    std::sort(completed_fixture_indices.begin(), completed_fixture_indices.end());
+    const auto job_source = [&](size_t index, ijccrl::core::runtime::MatchJob& job) {
+        const int fixture_index = static_cast<int>(index);
+        if (std::binary_search(completed_fixture_indices.begin(), completed_fixture_indices.end(), fixture_index)) {
+            return false;
         }
-        ijccrl::core::runtime::MatchJob job;
-        job.fixture = fixtures[i];
-        job.opening = assigned_openings[i];
-        job.event_name = "ijccrl round robin";
+        job.fixture = schedule.At(fixture_index);
+        job.opening = opening_for(fixture_index);
+        job.event_name = event_name;
         job.site_tag = site_tag;
-        job.round_label = std::to_string(fixtures[i].round_index + 1);
-        job.fixture_index = static_cast<int>(i);
-        jobs.push_back(std::move(job));
-    }
+        job.round_label = std::to_string(job.fixture.round_index + 1);
+        job.fixture_index = fixture_index;
+        if (has_checkpoint) {
+            const auto* active = ijccrl::core::persist::FindActiveGame(checkpoint_state, fixture_index);
+            if (active && active->opening_id == job.opening.id) {
+                job.resume = active->progress;
+            }
+        }
+        return true;
+    };
 
     ijccrl::core::stats::StandingsTable standings(engine_names);
+    std::vector<std::string> unknown_tie_breaks;
+    standings.SetTieBreakOrder(ResolveTieBreaks(config, &unknown_tie_breaks));
+    for (const auto& name : unknown_tie_breaks) {
+        AppendLogLine("[ijccrl] Unknown tie-break: " + name);
+    }
     if (has_checkpoint && !checkpoint_state.standings.empty()) {
         std::vector<ijccrl::core::stats::EngineStats> snapshot;
         snapshot.reserve(engine_names.size());
@@ -1241,6 +1900,65 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         }
         standings.LoadSnapshot(snapshot);
     }
+    for (const auto& game : completed_games) {
+        standings.RestoreResult(EngineIdByName(engine_names, game.white),
+                                EngineIdByName(engine_names, game.black),
+                                game.result,
+                                paired_openings ? game.fixture_index / 2 : -1);
+    }
+    standings.UpdateRatings();
+    standings.UpdateRanks();
+
+    ijccrl::core::stats::Sprt sprt(config.sprt.elo0, config.sprt.elo1, config.sprt.alpha, config.sprt.beta);
+    std::atomic<bool> sprt_drain{false};
+    if (sprt_mode) {
+        if (engine_names.size() > 2) {
+            AppendLogLine("[ijccrl] SPRT mode plays only the first two engines.");
+        }
+        for (const auto& game : completed_games) {
+            const double score =
+                ijccrl::core::stats::Sprt::GameScore(game.result, game.white == engine_names[0]);
+            if (score >= 0.0) {
+                sprt.RecordGame(game.fixture_index / 2, score);
+            }
+        }
+        if (sprt.status() != ijccrl::core::stats::Sprt::Status::Continue) {
+            sprt_drain.store(true);
+        }
+        AppendLogLine("[ijccrl] " + ijccrl::core::stats::Sprt::Describe(sprt.snapshot()));
+    }
+
+    // SPRT stops on its bounds, not at the end of the schedule, so only
+    // round-robin and gauntlet events are simulated.
+    std::unique_ptr<ijccrl::core::stats::StandingsSimulator> simulator;
+    if (!sprt_mode && config.output.simulations > 0) {
+        std::vector<ijccrl::core::stats::SimulatedGame> remaining;
+        for (int i = 0; i < total_games; ++i) {
+            if (completed_set.count(i) == 0) {
+                const auto fixture = schedule.At(i);
+                remaining.push_back({i, fixture.white_engine_id, fixture.black_engine_id});
+            }
+        }
+        const int hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+        int spare_threads = hardware_threads - config.tournament.concurrency;
+        if (core_budget_) {
+            // Games may fill the whole shared budget, so only the threads the
+            // host leaves outside it are spare, split between its tournaments.
+            const auto clients = core_budget_->usage();
+            const auto active = std::count_if(clients.begin(), clients.end(), [](const auto& usage) {
+                return usage.active;
+            });
+            spare_threads = (hardware_threads - core_budget_->capacity()) / std::max<int>(1, static_cast<int>(active));
+        }
+        const int simulation_threads =
+            config.output.simulation_threads > 0 ? config.output.simulation_threads : std::max(1, spare_threads);
+        simulator = std::make_unique<ijccrl::core::stats::StandingsSimulator>(
+            std::move(remaining),
+            config.output.simulations,
+            simulation_threads,
+            static_cast<std::uint64_t>(config.openings.seed));
+        simulator->Update(standings);
+    }
     {
         std::lock_guard<std::mutex> lock(standings_mutex_);
         standings_.clear();
@@ -1254,29 +1972,35 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 entry.losses,
                 entry.points,
                 entry.score_percent(),
+                entry.elo,
+                entry.elo_error,
+                entry.rank,
+                entry.buchholz,
+                entry.sonneborn_berger,
+                entry.koya,
+                entry.search,
             });
         }
+        crosstable_ = MakeCrosstableSnapshot(standings);
+        simulation_ = {};
     }
 
     std::mutex output_mutex;
     std::mutex checkpoint_mutex;
     std::vector<ijccrl::core::persist::ActiveGameMeta> active_games_meta;
     std::unordered_map<std::string, int> termination_counts;
-    int total_games = static_cast<int>(fixtures.size());
 
-    const auto live_update = [&](const ijccrl::core::pgn::PgnGame& live_game) {
-        const std::string live_pgn = ijccrl::core::pgn::PgnWriter::Render(live_game);
-        if (pgn_adapter) {
-            pgn_adapter->PublishLivePgn(live_pgn);
-        }
-        if (!WriteLivePgn(config.output.live_pgn, live_pgn)) {
-            disk_write_errors.fetch_add(1);
-        }
+    const auto live_update = [&](const ijccrl::core::runtime::MatchJob&,
+                                 int,
+                                 int board,
+                                 const ijccrl::core::pgn::PgnGame& live_game) {
+        live_publisher.Update(board, live_game);
 
         std::lock_guard<std::mutex> lock(state_mutex_);
         if (!live_game.moves.empty()) {
             state_.lastMove = live_game.moves.back();
         }
+        broadcast_latency_.Record(ijccrl::core::util::BroadcastStage::GuiState);
     };
 
     int last_pairings_round = -1;
@@ -1310,9 +2034,8 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             state_.activeGames = active_games.load();
             if (job.fixture.round_index != last_pairings_round &&
                 job.fixture.round_index >= 0 &&
-                job.fixture.round_index < static_cast<int>(round_pairings_strings.size())) {
-                state_.currentRoundPairings =
-                    round_pairings_strings[static_cast<size_t>(job.fixture.round_index)];
+                job.fixture.round_index < total_rounds) {
+                state_.currentRoundPairings = round_pairings_for(job.fixture.round_index);
                 last_pairings_round = job.fixture.round_index;
             }
             {
@@ -1323,6 +2046,11 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 active.white = engine_names[static_cast<size_t>(job.fixture.white_engine_id)];
                 active.black = engine_names[static_cast<size_t>(job.fixture.black_engine_id)];
                 active.opening_id = job.opening.id;
+                active.progress = job.resume;
+                journal.AppendStarted(active);
+                if (!job.resume.moves_uci.empty()) {
+                    journal.AppendProgress(game_number, job.fixture_index, job.resume);
+                }
                 active_games_meta.push_back(std::move(active));
             }
         } else {
@@ -1341,6 +2069,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         }
     };
 
+    const auto progress_update = [&](const ijccrl::core::runtime::MatchJob& job,
+                                     int game_number,
+                                     const ijccrl::core::game::GameProgress& progress) {
+        std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+        for (auto& active : active_games_meta) {
+            if (active.game_no == game_number) {
+                active.progress = progress;
+                break;
+            }
+        }
+        journal.AppendProgress(game_number, job.fixture_index, progress);
+    };
+
     const auto move_update = [&](const ijccrl::core::runtime::MatchJob&,
                                  int,
                                  const std::string& move_uci,
@@ -1389,7 +2130,39 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
         }
 
-        standings.RecordResult(fixture.white_engine_id, fixture.black_engine_id, result.result.state.result);
+        standings.RecordResult(fixture.white_engine_id,
+                                  fixture.black_engine_id,
+                                  result.result.state.result,
+                                  paired_openings ? result.job.fixture_index / 2 : -1);
+        standings.RecordSearch(fixture.white_engine_id, result.result.white_search);
+        standings.RecordSearch(fixture.black_engine_id, result.result.black_search);
+        standings.UpdateRatings();
+        standings.UpdateRanks();
+        if (simulator) {
+            simulator->Update(standings, result.job.fixture_index);
+        }
+        duration_model.Record(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                              engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                              result.job.opening.id,
+                              static_cast<int>(result.result.state.moves_uci.size()),
+                              result.duration_seconds);
+        if (sprt_mode) {
+            const double score = ijccrl::core::stats::Sprt::GameScore(result.result.state.result,
+                                                                      fixture.white_engine_id == 0);
+            if (score >= 0.0 &&
+                sprt.RecordGame(result.job.fixture_index / 2, score) !=
+                    ijccrl::core::stats::Sprt::Status::Continue &&
+                !sprt_drain.exchange(true)) {
+                AppendLogLine("[ijccrl] " + ijccrl::core::stats::Sprt::Describe(sprt.snapshot()) +
+                              "; finishing running games");
+            }
+            const auto snapshot = sprt.snapshot();
+            std::lock_guard<std::mutex> state_lock(state_mutex_);
+            state_.sprtLlr = snapshot.llr;
+            state_.sprtLowerBound = snapshot.lower_bound;
+            state_.sprtUpperBound = snapshot.upper_bound;
+            state_.sprtStatus = ijccrl::core::stats::Sprt::StatusName(snapshot.status);
+        }
         if (!result.result.state.termination.empty()) {
             termination_counts[result.result.state.termination] += 1;
         }
@@ -1408,6 +2181,19 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             disk_write_errors.fetch_add(1);
         }
 
+        if (opening_stats.is_open()) {
+            ijccrl::core::stats::OpeningGame stats_game;
+            stats_game.opening_id = result.job.opening.id;
+            stats_game.event = stats_event;
+            stats_game.fixture_index = result.job.fixture_index;
+            stats_game.result = result.result.state.result;
+            stats_game.plies = static_cast<int>(result.result.state.moves_uci.size());
+            stats_game.termination = result.result.state.termination;
+            if (!opening_stats.Record(stats_game)) {
+                disk_write_errors.fetch_add(1);
+            }
+        }
+
         std::ostringstream log_line;
         log_line << "GAME END #" << result.game_number << " | "
                  << engine_names[static_cast<size_t>(fixture.white_engine_id)] << " vs "
@@ -1431,21 +2217,33 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             state_.tablebaseUsed = result.result.state.tablebase_used;
         }
 
+        // The simulation of this game's standings is still running; results
+        // carry the last finished one.
+        const auto simulation = simulator ? simulator->Latest() : ijccrl::core::stats::SimulationResult{};
         std::ostringstream tc_desc;
         tc_desc << config.time_control.base_seconds << "+" << config.time_control.increment_seconds;
         WriteResultsJson(config.output.results_json,
-                         "ijccrl round robin",
+                         event_name,
                          tc_desc.str(),
                          config.tournament.mode,
                          standings,
-                         termination_counts);
+                         termination_counts,
+                         simulation);
 
         ijccrl::core::exporter::WriteStandingsCsv(config.output.standings_csv, standings.standings());
         ijccrl::core::exporter::WriteStandingsHtml(config.output.standings_html,
-                                                   "ijccrl round robin",
+                                                   event_name,
                                                    standings.standings());
+        ijccrl::core::exporter::WriteCrosstableJson(config.output.crosstable_json,
+                                                   event_name,
+                                                   standings.standings(),
+                                                   standings.crosstable());
+        ijccrl::core::exporter::WriteCrosstableHtml(config.output.crosstable_html,
+                                                   event_name,
+                                                   standings.standings(),
+                                                   standings.crosstable());
         ijccrl::core::exporter::WriteSummaryJson(config.output.summary_json,
-                                                 "ijccrl round robin",
+                                                 event_name,
                                                  tc_desc.str(),
                                                  config.tournament.mode,
                                                  total_games,
@@ -1463,8 +2261,17 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                     entry.losses,
                     entry.points,
                     entry.score_percent(),
+                    entry.elo,
+                    entry.elo_error,
+                    entry.rank,
+                    entry.buchholz,
+                    entry.sonneborn_berger,
+                    entry.koya,
+                    entry.search,
                 });
             }
+            crosstable_ = MakeCrosstableSnapshot(standings);
+            simulation_ = MakeSimulationSnapshot(standings, simulation);
         }
 
         {
@@ -1479,13 +2286,23 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             meta.termination = result.result.state.termination;
             meta.pgn_offset = pgn_offset;
             meta.pgn_path = config.output.tournament_pgn;
+            if (journal.is_open() &&
+                !journal.AppendCompleted(meta,
+                                         fixture.white_engine_id,
+                                         fixture.black_engine_id,
+                                         FormatUtcTimestamp(std::time(nullptr)))) {
+                disk_write_errors.fetch_add(1);
+            }
             completed_games.push_back(std::move(meta));
             completed_set.insert(result.job.fixture_index);
             completed_count.store(static_cast<int>(completed_set.size()));
         }
         last_game_number.store(result.game_number);
         last_game_end_time.store(std::time(nullptr));
-        if (write_checkpoint) {
+        if (write_checkpoint &&
+            (!journal.is_open() ||
+             journal.completed_since_compaction() >=
+                 static_cast<size_t>(std::max(1, config.output.checkpoint_compact_records)))) {
             write_checkpoint();
         }
     };
@@ -1498,8 +2315,12 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
     ijccrl::core::runtime::MatchRunner::Control control;
     control.stop = &stop_requested_;
     control.paused = &paused_;
+    control.drain = &sprt_drain;
     control.pause_mutex = &pause_mutex_;
     control.pause_cv = &pause_cv_;
+    control.budget = core_budget_;
+    control.budget_client = core_budget_client_;
+    control.latency = &broadcast_latency_;
 
     const auto watchdog_log = [this](const std::string& line) {
         AppendLogLine(line);
@@ -1509,6 +2330,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         ijccrl::core::persist::CheckpointState snapshot;
         snapshot.version = 1;
         snapshot.config_hash = config_hash;
+        snapshot.excluded_openings = excluded_openings;
         snapshot.total_games = total_games;
         snapshot.rng_seed = static_cast<std::uint64_t>(config.openings.seed);
         snapshot.last_game_no = last_game_number.load();
@@ -1520,6 +2342,7 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             std::lock_guard<std::mutex> lock(checkpoint_mutex);
             snapshot.completed_games = completed_games;
             snapshot.active_games = active_games_meta;
+            snapshot.journal_seq = journal.last_seq();
             completed_snapshot.assign(completed_set.begin(), completed_set.end());
         }
         snapshot.completed_fixture_indices = completed_snapshot;
@@ -1531,11 +2354,11 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             if (completed_local.count(i) == 0) {
                 snapshot.next_fixture_index = i;
                 snapshot.opening_index = i;
-                const auto& fixture = fixtures[static_cast<size_t>(i)];
+                const auto fixture = schedule.At(i);
                 snapshot.next_game.fixture_index = i;
                 snapshot.next_game.white = engine_names[static_cast<size_t>(fixture.white_engine_id)];
                 snapshot.next_game.black = engine_names[static_cast<size_t>(fixture.black_engine_id)];
-                snapshot.next_game.opening_id = assigned_openings[static_cast<size_t>(i)].id;
+                snapshot.next_game.opening_id = opening_for(i).id;
                 break;
             }
         }
@@ -1555,21 +2378,67 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
             }
         }
 
-        if (!ijccrl::core::persist::SaveCheckpoint(checkpoint_path, snapshot)) {
+        if (!ijccrl::core::persist::SaveCheckpoint(
+                    checkpoint_path,
+                    snapshot,
+                    ijccrl::core::persist::CheckpointFormatFromString(config.output.checkpoint_format))) {
+            disk_write_errors.fetch_add(1);
+        } else if (journal.is_open()) {
+            journal.Compact(snapshot.journal_seq);
+        }
+        if (!duration_model.Save(durations_path)) {
             disk_write_errors.fetch_add(1);
         }
     };
 
+    std::unique_ptr<ijccrl::core::distributed::Coordinator> coordinator;
+    if (!config.distributed.listen.empty()) {
+        coordinator = std::make_unique<ijccrl::core::distributed::Coordinator>(
+            RunnerConfig::ToJsonString(config),
+            on_result,
+            live_update,
+            move_update,
+            [this](const std::string& line) { AppendLogLine("[ijccrl] " + line); },
+            on_job_event,
+            progress_update);
+        std::string listen_error;
+        if (!coordinator->Start(config.distributed.listen, config.distributed.token, &listen_error)) {
+            AppendLogLine("[ijccrl] " + listen_error);
+            running_.store(false);
+            {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                state_.running = false;
+            }
+            return;
+        }
+    }
+
+    // The timers wait on timer_cv so that stopping them does not wait out
+    // a whole interval.
+    std::mutex timer_mutex;
+    std::condition_variable timer_cv;
     std::atomic<bool> checkpoint_running{false};
     std::thread checkpoint_thread;
     if (config.output.checkpoint_interval_seconds > 0) {
         checkpoint_running.store(true);
         checkpoint_thread = std::thread([&]() {
             while (checkpoint_running.load()) {
-                std::this_thread::sleep_for(std::chrono::seconds(config.output.checkpoint_interval_seconds));
-                if (!running_.load()) {
+                {
+                    std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                    timer_cv.wait_for(timer_lock,
+                                      std::chrono::seconds(config.output.checkpoint_interval_seconds),
+                                      [&]() { return !checkpoint_running.load(); });
+                }
+                if (!checkpoint_running.load() || !running_.load()) {
                     break;
                 }
+                // Finished games are already in the journal; snapshots follow
+                // checkpoint_compact_records.
+                if (journal.is_open()) {
+                    journal.Flush();
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(output_mutex);
                 write_checkpoint();
             }
         });
@@ -1581,8 +2450,13 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
         metrics_running.store(true);
         metrics_thread = std::thread([&]() {
             while (metrics_running.load()) {
-                std::this_thread::sleep_for(std::chrono::seconds(config.output.metrics_interval_seconds));
-                if (!running_.load()) {
+                {
+                    std::unique_lock<std::mutex> timer_lock(timer_mutex);
+                    timer_cv.wait_for(timer_lock,
+                                      std::chrono::seconds(config.output.metrics_interval_seconds),
+                                      [&]() { return !metrics_running.load(); });
+                }
+                if (!metrics_running.load() || !running_.load()) {
                     break;
                 }
                 nlohmann::json metrics;
@@ -1592,7 +2466,22 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                 metrics["engines_running"] = static_cast<int>(engine_names.size());
                 std::time_t last_time = last_game_end_time.load();
                 metrics["last_game_end_time"] = last_time == 0 ? "" : FormatUtcTimestamp(last_time);
-                metrics["disk_write_errors_count"] = disk_write_errors.load();
+                metrics["disk_write_errors_count"] =
+                    disk_write_errors.load() + live_publisher.write_errors();
+                metrics["live_pgn_writes"] = live_publisher.writes();
+                metrics["live_pgn_coalesced_updates"] = live_publisher.coalesced_updates();
+                metrics["broadcast_latency_ms"] = BroadcastLatencyJson(broadcast_latency_);
+                {
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    nlohmann::json search = nlohmann::json::object();
+                    for (const auto& entry : standings.standings()) {
+                        search[entry.name] = SearchJson(entry.search);
+                    }
+                    metrics["engine_search"] = std::move(search);
+                }
+                if (sprt_mode) {
+                    metrics["sprt"] = SprtJson(sprt.snapshot());
+                }
                 if (!ijccrl::core::util::AtomicFileWriter::Write(config.output.metrics_json,
                                                                  metrics.dump(2))) {
                     disk_write_errors.fetch_add(1);
@@ -1631,24 +2520,112 @@ void RunnerService::Run(RunnerConfig config, bool resume) {
                                                     live_update,
                                                     move_update,
                                                     watchdog_log,
-                                                    on_job_event);
+                                                    on_job_event,
+                                                    progress_update);
 
     write_checkpoint();
-    match_runner.Run(jobs, config.tournament.concurrency, control, initial_game_number);
-
-    for (size_t i = 0; i < engine_names.size(); ++i) {
-        pool.engine(static_cast<int>(i)).Stop();
+    if (!sprt_mode && config.tournament.job_order == "longest_first") {
+        std::vector<double> predicted(static_cast<size_t>(total_games), 0.0);
+        std::vector<ijccrl::core::runtime::PlannedJob> planned(static_cast<size_t>(total_games));
+        std::vector<size_t> fixture_order;
+        for (int i = 0; i < total_games; ++i) {
+            if (std::binary_search(completed_fixture_indices.begin(), completed_fixture_indices.end(), i)) {
+                continue;
+            }
+            const auto fixture = schedule.At(i);
+            predicted[static_cast<size_t>(i)] =
+                duration_model.Predict(engine_names[static_cast<size_t>(fixture.white_engine_id)],
+                                       engine_names[static_cast<size_t>(fixture.black_engine_id)],
+                                       opening_for(i).id);
+            planned[static_cast<size_t>(i)] = {predicted[static_cast<size_t>(i)],
+                                               fixture.white_engine_id,
+                                               fixture.black_engine_id};
+            fixture_order.push_back(static_cast<size_t>(i));
+        }
+        auto order = ijccrl::core::runtime::LongestFirstOrder(predicted);
+        order.erase(std::remove_if(order.begin(),
+                                   order.end(),
+                                   [&](size_t index) {
+                                       return std::binary_search(completed_fixture_indices.begin(),
+                                                                 completed_fixture_indices.end(),
+                                                                 static_cast<int>(index));
+                                   }),
+                    order.end());
+        std::vector<int> instances;
+        for (int engine_id = 0; engine_id < engine_count; ++engine_id) {
+            instances.push_back(pool.instances(engine_id));
+        }
+        const double predicted_makespan =
+            ijccrl::core::runtime::SimulateMakespan(planned, order, config.tournament.concurrency, instances, true);
+        const double fixture_makespan =
+            ijccrl::core::runtime::SimulateMakespan(planned, fixture_order, config.tournament.concurrency, instances, false);
+        std::vector<ijccrl::core::runtime::OrderedJob> ordered;
+        ordered.reserve(order.size());
+        for (size_t index : order) {
+            ordered.push_back({index, planned[index].white_id, planned[index].black_id});
+        }
+        const auto run_start = std::chrono::steady_clock::now();
+        if (coordinator) {
+            coordinator->Run(ordered, job_source, config.tournament.concurrency, control, initial_game_number);
+        } else {
+            match_runner.Run(ordered, job_source, runner_threads, control, initial_game_number);
+        }
+        const double actual_makespan =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(1) << "[ijccrl] Longest-first order: predicted makespan "
+             << predicted_makespan << " s (fixture order " << fixture_makespan << " s), actual " << actual_makespan
+             << " s, history " << duration_model.games() << " games";
+        AppendLogLine(line.str());
+    } else {
+        if (coordinator) {
+            coordinator->Run(
+                static_cast<size_t>(total_games), job_source, config.tournament.concurrency, control, initial_game_number);
+        } else {
+            match_runner.Run(
+                static_cast<size_t>(total_games), job_source, runner_threads, control, initial_game_number);
+        }
+    }
+    if (sprt_mode) {
+        AppendLogLine("[ijccrl] " + ijccrl::core::stats::Sprt::Describe(sprt.snapshot()));
+    }
+    if (simulator) {
+        simulator->Wait();
+        const auto simulation = simulator->Latest();
+        std::ostringstream tc_desc;
+        tc_desc << config.time_control.base_seconds << "+" << config.time_control.increment_seconds;
+        std::lock_guard<std::mutex> lock(output_mutex);
+        WriteResultsJson(config.output.results_json,
+                         event_name,
+                         tc_desc.str(),
+                         config.tournament.mode,
+                         standings,
+                         termination_counts,
+                         simulation);
+        std::lock_guard<std::mutex> standings_lock(standings_mutex_);
+        simulation_ = MakeSimulationSnapshot(standings, simulation);
     }
 
+    pool.StopAll();
+    live_publisher.Stop();
+
     write_checkpoint();
     if (checkpoint_running.load()) {
-        checkpoint_running.store(false);
+        {
+            std::lock_guard<std::mutex> timer_lock(timer_mutex);
+            checkpoint_running.store(false);
+        }
+        timer_cv.notify_all();
         if (checkpoint_thread.joinable()) {
             checkpoint_thread.join();
         }
     }
     if (metrics_running.load()) {
-        metrics_running.store(false);
+        {
+            std::lock_guard<std::mutex> timer_lock(timer_mutex);
+            metrics_running.store(false);
+        }
+        timer_cv.notify_all();
         if (metrics_thread.joinable()) {
             metrics_thread.join();
         }
@@ -0,0 +1,151 @@
+#include "ijccrl/core/api/TournamentHost.h"
+
+#include <filesystem>
+#include <system_error>
+
+namespace ijccrl::core::api {
+
+namespace {
+
+std::string NormalizePath(const std::string& path) {
+    std::error_code ec;
+    auto absolute = std::filesystem::absolute(path, ec);
+    if (ec) {
+        return std::filesystem::path(path).lexically_normal().generic_string();
+    }
+    return absolute.lexically_normal().generic_string();
+}
+
+std::vector<std::string> ClaimedPaths(const RunnerConfig& config) {
+    const auto& output = config.output;
+    std::vector<std::string> paths;
+    for (const auto* path : {&output.tournament_pgn,
+                             &output.live_pgn,
+                             &output.results_json,
+                             &output.pairings_csv,
+                             &output.progress_log,
+                             &output.checkpoint_json,
+                             &output.standings_csv,
+                             &output.standings_html,
+                             &output.crosstable_json,
+                             &output.crosstable_html,
+                             &output.summary_json,
+                             &output.metrics_json}) {
+        if (!path->empty()) {
+            paths.push_back(NormalizePath(*path));
+        }
+    }
+    if (config.broadcast.adapter == "tlcs_feed" && !config.broadcast.tlcs.feed_path.empty()) {
+        paths.push_back(NormalizePath(config.broadcast.tlcs.feed_path));
+    }
+    if (output.write_game_files && !output.games_dir.empty()) {
+        paths.push_back(NormalizePath(output.games_dir));
+    }
+    if (!config.distributed.listen.empty()) {
+        paths.push_back("listen:" + config.distributed.listen);
+    }
+    return paths;
+}
+
+}  // namespace
+
+TournamentHost::TournamentHost(int cores) : budget_(cores) {}
+
+TournamentHost::~TournamentHost() {
+    requestStop();
+    waitForFinish();
+}
+
+int TournamentHost::admit(const std::string& name, const RunnerConfig& config, double weight, std::string* error) {
+    auto event = std::make_unique<Event>();
+    event->name = name;
+    event->weight = weight > 0.0 ? weight : 1.0;
+    event->claimed_paths = ClaimedPaths(config);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& other : events_) {
+        for (const auto& path : event->claimed_paths) {
+            for (const auto& taken : other->claimed_paths) {
+                if (path == taken) {
+                    if (error) {
+                        *error = "Event \"" + name + "\" shares " + path + " with event \"" + other->name + "\"";
+                    }
+                    return -1;
+                }
+            }
+        }
+    }
+    event->client = budget_.AddClient(event->weight);
+    event->service = std::make_unique<RunnerService>();
+    event->service->setConfig(config);
+    event->service->setCoreBudget(&budget_, event->client);
+    events_.push_back(std::move(event));
+    return static_cast<int>(events_.size() - 1);
+}
+
+bool TournamentHost::start(int index, bool resume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index < 0 || index >= static_cast<int>(events_.size())) {
+        return false;
+    }
+    return events_[static_cast<size_t>(index)]->service->startWithResume(resume);
+}
+
+bool TournamentHost::startAll(bool resume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool ok = true;
+    for (const auto& event : events_) {
+        ok = event->service->startWithResume(resume) && ok;
+    }
+    return ok;
+}
+
+void TournamentHost::requestStop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& event : events_) {
+        event->service->requestStop();
+    }
+}
+
+void TournamentHost::waitForFinish() {
+    std::vector<RunnerService*> services;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& event : events_) {
+            services.push_back(event->service.get());
+        }
+    }
+    for (auto* service : services) {
+        service->waitForFinish();
+    }
+}
+
+size_t TournamentHost::eventCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+}
+
+RunnerService& TournamentHost::event(int index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return *events_.at(static_cast<size_t>(index))->service;
+}
+
+std::vector<TournamentHost::EventInfo> TournamentHost::getEventsSnapshot() const {
+    const auto usage = budget_.usage();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<EventInfo> infos;
+    infos.reserve(events_.size());
+    for (const auto& event : events_) {
+        EventInfo info;
+        info.name = event->name;
+        info.weight = event->weight;
+        if (event->client >= 0 && event->client < static_cast<int>(usage.size())) {
+            info.slots_in_use = usage[static_cast<size_t>(event->client)].in_use;
+        }
+        info.state = event->service->getStateSnapshot();
+        infos.push_back(std::move(info));
+    }
+    return infos;
+}
+
+}  // namespace ijccrl::core::api
@@ -0,0 +1,176 @@
+#include "ijccrl/core/broadcast/LivePgnPublisher.h"
+
+#include "ijccrl/core/pgn/PgnWriter.h"
+#include "ijccrl/core/util/AtomicFileWriter.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace ijccrl::core::broadcast {
+
+LivePgnPublisher::LivePgnPublisher(Config config, FeaturedSink featured_sink)
+    : config_(std::move(config)), featured_sink_(std::move(featured_sink)) {}
+
+LivePgnPublisher::~LivePgnPublisher() {
+    Stop();
+}
+
+void LivePgnPublisher::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_ || config_.max_rate_hz <= 0.0) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread([this]() { FlushLoop(); });
+}
+
+void LivePgnPublisher::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    Flush();
+}
+
+void LivePgnPublisher::Update(int board, const ijccrl::core::pgn::PgnGame& game) {
+    bool flush_now = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = boards_[board];
+        if (slot.version != slot.flushed_version) {
+            coalesced_.fetch_add(1);
+        }
+        slot.game = game;
+        slot.version += 1;
+        slot.finished = game.result != "*";
+        slot.has_mark = ijccrl::core::util::CurrentBestmoveMark(&slot.mark);
+        dirty_ = true;
+        flush_now = !running_;
+    }
+    if (flush_now) {
+        Flush();
+    } else {
+        cv_.notify_one();
+    }
+}
+
+void LivePgnPublisher::Flush() {
+    struct Pending {
+        int board = 0;
+        ijccrl::core::pgn::PgnGame game;
+        bool has_mark = false;
+        std::chrono::steady_clock::time_point mark{};
+    };
+
+    std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+    std::vector<Pending> pending;
+    ijccrl::core::pgn::PgnGame featured_game;
+    bool has_featured = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!dirty_) {
+            return;
+        }
+        dirty_ = false;
+
+        auto featured = boards_.find(featured_board_);
+        const bool featured_done = featured == boards_.end() ||
+                                   (featured->second.finished &&
+                                    featured->second.version == featured->second.flushed_version);
+        if (featured_done) {
+            for (const auto& [id, board] : boards_) {
+                if (!board.finished) {
+                    featured_board_ = id;
+                    break;
+                }
+            }
+            if (boards_.find(featured_board_) == boards_.end() && !boards_.empty()) {
+                featured_board_ = boards_.begin()->first;
+            }
+        }
+
+        for (auto& [id, board] : boards_) {
+            if (id == featured_board_) {
+                featured_game = board.game;
+                has_featured = true;
+            }
+            if (board.version == board.flushed_version) {
+                continue;
+            }
+            board.flushed_version = board.version;
+            pending.push_back({id, board.game, board.has_mark, board.mark});
+            board.has_mark = false;
+        }
+    }
+
+    if (has_featured) {
+        std::string text = ijccrl::core::pgn::PgnWriter::Render(featured_game);
+        if (text != last_featured_text_) {
+            if (featured_sink_) {
+                featured_sink_(text);
+            }
+            if (!config_.live_pgn_path.empty()) {
+                WriteFile(config_.live_pgn_path, text);
+            }
+            last_featured_text_ = std::move(text);
+        }
+    }
+
+    for (const auto& entry : pending) {
+        if (config_.board_files && !config_.live_pgn_path.empty()) {
+            std::string text = ijccrl::core::pgn::PgnWriter::Render(entry.game);
+            auto& last_text = last_board_text_[entry.board];
+            if (text != last_text) {
+                WriteFile(BoardPath(entry.board), text);
+                last_text = std::move(text);
+            }
+        }
+        if (entry.has_mark && config_.latency) {
+            config_.latency->Record(ijccrl::core::util::BroadcastStage::LivePgn, entry.mark);
+        }
+    }
+}
+
+std::string LivePgnPublisher::BoardPath(int board) const {
+    const std::filesystem::path live_path(config_.live_pgn_path);
+    const std::string name = live_path.stem().string() + "_board" + std::to_string(board + 1) +
+                             live_path.extension().string();
+    return (live_path.parent_path() / name).string();
+}
+
+bool LivePgnPublisher::WriteFile(const std::string& path, const std::string& contents) {
+    const std::filesystem::path fs_path(path);
+    if (!fs_path.parent_path().empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(fs_path.parent_path(), ec);
+    }
+    if (!ijccrl::core::util::AtomicFileWriter::Write(path, contents)) {
+        write_errors_.fetch_add(1);
+        return false;
+    }
+    writes_.fetch_add(1);
+    return true;
+}
+
+void LivePgnPublisher::FlushLoop() {
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / config_.max_rate_hz));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        cv_.wait(lock, [&]() { return dirty_ || !running_; });
+        if (!running_) {
+            break;
+        }
+        lock.unlock();
+        Flush();
+        lock.lock();
+        cv_.wait_for(lock, interval, [&]() { return !running_; });
+    }
+}
+
+}  // namespace ijccrl::core::broadcast
@@ -93,6 +93,11 @@ const char* FormatName(TlcsFeedWriter::Format format) {
 
 }  // namespace
 
+void TlcsFeedAdapter::set_broadcast_latency(ijccrl::core::util::BroadcastLatency* latency) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    writer_.set_broadcast_latency(latency);
+}
+
 bool TlcsFeedAdapter::Configure(const Config& config) {
     server_ini_path_ = config.server_ini;
     feed_path_ = config.feed_path;
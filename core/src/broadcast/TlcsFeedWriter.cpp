@@ -1,5 +1,7 @@
 #include "ijccrl/core/broadcast/TlcsFeedWriter.h"
 
+#include "ijccrl/core/util/LatencyHistogram.h"
+
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
@@ -236,6 +238,9 @@ void TlcsFeedWriter::AppendWinboardFen(const std::string& fen) {
     if (!WriteFileContents(feed_path_, line, true)) {
         return;
     }
+    if (latency_) {
+        latency_->Record(ijccrl::core::util::BroadcastStage::TlcsFeed);
+    }
     LogWrite(line.size());
 }
 
@@ -259,6 +264,9 @@ void TlcsFeedWriter::WriteSnapshot() {
     if (!WriteFileContents(feed_path_, content, false)) {
         return;
     }
+    if (latency_) {
+        latency_->Record(ijccrl::core::util::BroadcastStage::TlcsFeed);
+    }
 
     LogWrite(content.size());
 }
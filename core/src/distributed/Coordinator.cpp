@@ -0,0 +1,464 @@
+#include "ijccrl/core/distributed/Coordinator.h"
+
+#include "ijccrl/core/distributed/Protocol.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <utility>
+
+namespace ijccrl::core::distributed {
+
+namespace {
+
+bool IsLoopbackAddress(const std::string& address) {
+    if (address.rfind("unix:", 0) == 0) {
+        return true;
+    }
+    const auto colon = address.rfind(':');
+    std::string host = colon == std::string::npos ? address : address.substr(0, colon);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    return host == "localhost" || host == "::1" || host.rfind("127.", 0) == 0;
+}
+
+// A connection that has not sent Hello by then is closed.
+constexpr auto kHandshakeTimeout = std::chrono::seconds(10);
+
+// Compares every byte so the time taken does not reveal the matching prefix.
+bool TokenMatches(const std::string& expected, const std::string& actual) {
+    if (expected.empty()) {
+        return true;
+    }
+    if (expected.size() != actual.size()) {
+        return false;
+    }
+    unsigned char diff = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        diff |= static_cast<unsigned char>(expected[i] ^ actual[i]);
+    }
+    return diff == 0;
+}
+
+}  // namespace
+
+Coordinator::Coordinator(std::string config_payload,
+                         ijccrl::core::runtime::MatchRunner::ResultCallback result_callback,
+                         ijccrl::core::runtime::MatchRunner::LiveUpdateFn live_update,
+                         ijccrl::core::runtime::MatchRunner::MoveUpdateFn move_update,
+                         LogFn log,
+                         ijccrl::core::runtime::MatchRunner::JobEventFn job_event,
+                         ijccrl::core::runtime::MatchRunner::ProgressFn progress_update)
+    : config_payload_(std::move(config_payload)),
+      result_callback_(std::move(result_callback)),
+      live_update_(std::move(live_update)),
+      move_update_(std::move(move_update)),
+      log_(std::move(log)),
+      job_event_(std::move(job_event)),
+      progress_update_(std::move(progress_update)) {}
+
+Coordinator::~Coordinator() {
+    Shutdown();
+}
+
+bool Coordinator::Start(const std::string& listen_address, const std::string& token, std::string* error) {
+    listener_ = ListenSocket(listen_address, error);
+    if (listener_ == kInvalidSocket) {
+        return false;
+    }
+    listen_address_ = listen_address;
+    token_ = token;
+    accept_thread_ = std::thread([this]() { AcceptLoop(); });
+    if (log_) {
+        log_("Coordinator listening on " + listen_address);
+        if (!IsLoopbackAddress(listen_address)) {
+            log_(token_.empty()
+                     ? "Warning: listening beyond loopback without distributed.token; any host that can connect "
+                       "receives the config (engine paths and options) and can submit results"
+                     : "Warning: listening beyond loopback; the protocol is not encrypted, so the token and games "
+                       "are readable on the network");
+        }
+    }
+    return true;
+}
+
+void Coordinator::Shutdown() {
+    if (listener_ == kInvalidSocket || shutting_down_.exchange(true)) {
+        return;
+    }
+    if (accept_thread_.joinable()) {
+        accept_thread_.join();
+    }
+    CloseSocket(listener_);
+
+    std::vector<std::shared_ptr<WorkerConnection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Message bye;
+        bye.type = MessageType::Bye;
+        const std::string line = EncodeMessage(bye);
+        for (const auto& entry : workers_) {
+            Send(*entry.second, line);
+            connections.push_back(entry.second);
+        }
+        connections.insert(connections.end(), retired_.begin(), retired_.end());
+    }
+    for (const auto& worker : connections) {
+        {
+            std::lock_guard<std::mutex> write_lock(worker->write_mutex);
+            ShutdownSocket(worker->socket);
+        }
+        if (worker->reader.joinable()) {
+            worker->reader.join();
+        }
+    }
+}
+
+void Coordinator::Run(const std::vector<ijccrl::core::runtime::OrderedJob>& order,
+                      const ijccrl::core::runtime::MatchRunner::JobSource& source,
+                      int concurrency,
+                      const ijccrl::core::runtime::MatchRunner::Control& control,
+                      int initial_game_number) {
+    Run(
+        order.size(),
+        [&order, &source](size_t index, ijccrl::core::runtime::MatchJob& job) {
+            return source(order[index].index, job);
+        },
+        concurrency,
+        control,
+        initial_game_number);
+}
+
+void Coordinator::Run(size_t job_count,
+                      const ijccrl::core::runtime::MatchRunner::JobSource& source,
+                      int /*concurrency*/,
+                      const ijccrl::core::runtime::MatchRunner::Control& control,
+                      int initial_game_number) {
+    if (job_count == 0) {
+        return;
+    }
+
+    // Claiming happens on its own thread: a blocking source (the Swiss job
+    // queue waiting for a round to finish) must not hold up requeued games.
+    std::deque<PendingGame> claimed;
+    bool claiming_done = false;
+    std::thread feeder([&]() {
+        size_t next_job = 0;
+        int game_counter = initial_game_number;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (next_job < job_count) {
+            if ((control.stop && control.stop->load()) || (control.drain && control.drain->load())) {
+                break;
+            }
+            const bool paused = control.paused && control.paused->load();
+            if (paused || !claimed.empty() || !requeued_.empty() || !PickWorker()) {
+                cv_.wait_for(lock, std::chrono::milliseconds(100));
+                continue;
+            }
+            const size_t index = next_job++;
+            PendingGame game;
+            lock.unlock();
+            const bool ok = source(index, game.job);
+            lock.lock();
+            if (ok) {
+                game.game_number = ++game_counter;
+                claimed.push_back(std::move(game));
+                cv_.notify_all();
+            }
+        }
+        claiming_done = true;
+        cv_.notify_all();
+    });
+
+    bool stop_sent = false;
+    bool waiting_logged = false;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        const bool stopping = control.stop && control.stop->load();
+        if (stopping && !stop_sent) {
+            stop_sent = true;
+            Message stop;
+            stop.type = MessageType::Stop;
+            const std::string line = EncodeMessage(stop);
+            for (const auto& entry : workers_) {
+                Send(*entry.second, line);
+            }
+        }
+        const bool paused = control.paused && control.paused->load();
+        const bool has_work = !requeued_.empty() || !claimed.empty();
+        if (stopping || paused || !has_work) {
+            if (!paused && claiming_done && in_flight_.empty() && (stopping || !has_work)) {
+                break;
+            }
+            cv_.wait_for(lock, std::chrono::milliseconds(100));
+            continue;
+        }
+
+        auto worker = PickWorker();
+        if (!worker) {
+            if (workers_.empty() && !waiting_logged && log_) {
+                waiting_logged = true;
+                log_("Waiting for workers on " + listen_address_);
+            }
+            cv_.wait_for(lock, std::chrono::milliseconds(100));
+            continue;
+        }
+
+        auto& queue = requeued_.empty() ? claimed : requeued_;
+        PendingGame game = std::move(queue.front());
+        queue.pop_front();
+
+        InFlightGame entry;
+        entry.job = game.job;
+        entry.game_number = game.game_number;
+        entry.board = AcquireBoard();
+        entry.worker_id = worker->id;
+        in_flight_[game.job.fixture_index] = entry;
+        worker->busy += 1;
+        lock.unlock();
+
+        if (!game.started && job_event_) {
+            job_event_(game.job, game.game_number, true);
+        }
+        Message message;
+        message.type = MessageType::Job;
+        message.job = game.job;
+        // A failed send surfaces as a disconnect in the reader, which requeues.
+        Send(*worker, EncodeMessage(message));
+        lock.lock();
+    }
+    lock.unlock();
+    feeder.join();
+}
+
+void Coordinator::AcceptLoop() {
+    while (!shutting_down_.load()) {
+        ReapWorkers();
+        std::string peer;
+        const SocketHandle socket = AcceptSocket(listener_, 200, &peer);
+        if (socket == kInvalidSocket) {
+            continue;
+        }
+        auto worker = std::make_shared<WorkerConnection>();
+        worker->socket = socket;
+        worker->peer = peer;
+        worker->connected_at = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        worker->id = ++next_worker_id_;
+        workers_[worker->id] = worker;
+        worker->reader = std::thread([this, worker]() { ReadLoop(worker); });
+    }
+}
+
+// Joins the readers of dropped workers and closes connections that are still
+// silent past the handshake timeout; their readers then drop them.
+void Coordinator::ReapWorkers() {
+    std::vector<std::shared_ptr<WorkerConnection>> finished;
+    std::vector<std::string> timed_out;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished.swap(retired_);
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& entry : workers_) {
+            auto& worker = *entry.second;
+            if (worker.ready || now - worker.connected_at < kHandshakeTimeout) {
+                continue;
+            }
+            std::lock_guard<std::mutex> write_lock(worker.write_mutex);
+            if (worker.socket != kInvalidSocket && worker.alive) {
+                worker.alive = false;
+                ShutdownSocket(worker.socket);
+                timed_out.push_back(worker.peer);
+            }
+        }
+    }
+    for (const auto& peer : timed_out) {
+        if (log_) {
+            log_("Worker " + peer + ": no Hello within " + std::to_string(kHandshakeTimeout.count()) +
+                 "s, closing the connection");
+        }
+    }
+    for (const auto& worker : finished) {
+        if (worker->reader.joinable()) {
+            worker->reader.join();
+        }
+    }
+}
+
+void Coordinator::ReadLoop(const std::shared_ptr<WorkerConnection>& worker) {
+    LineReader reader(worker->socket, kMaxHelloBytes);
+    std::string line;
+    while (reader.ReadLine(line)) {
+        Message message;
+        std::string error;
+        if (!DecodeMessage(line, message, &error)) {
+            if (log_) {
+                log_("Worker " + worker->peer + ": " + error);
+            }
+            continue;
+        }
+
+        if (message.type == MessageType::Hello) {
+            if (!TokenMatches(token_, message.token)) {
+                if (log_) {
+                    log_("Rejected worker " + worker->peer + ": wrong or missing token");
+                }
+                break;
+            }
+            reader.set_max_line(kMaxMessageBytes);
+            Message welcome;
+            welcome.type = MessageType::Welcome;
+            welcome.text = config_payload_;
+            welcome.live = static_cast<bool>(live_update_) || static_cast<bool>(move_update_);
+            Send(*worker, EncodeMessage(welcome));
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                worker->name = message.text.empty() ? worker->peer : message.text;
+                worker->slots = std::max(1, message.slots);
+                worker->ready = true;
+            }
+            cv_.notify_all();
+            if (log_) {
+                std::ostringstream text;
+                text << "Worker " << worker->name << " (" << worker->peer << ") connected with " << worker->slots
+                     << " slot(s)";
+                log_(text.str());
+            }
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!worker->ready) {
+                continue;
+            }
+        }
+        if (message.type == MessageType::Log) {
+            if (log_) {
+                log_("[" + worker->name + "] " + message.text);
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = in_flight_.find(message.fixture_index);
+        if (it == in_flight_.end() || it->second.worker_id != worker->id) {
+            continue;
+        }
+        if (message.type == MessageType::Progress) {
+            it->second.job.resume = message.progress;
+            const auto job = it->second.job;
+            const int game_number = it->second.game_number;
+            lock.unlock();
+            if (progress_update_) {
+                progress_update_(job, game_number, message.progress);
+            }
+        } else if (message.type == MessageType::Move) {
+            const auto job = it->second.job;
+            const int game_number = it->second.game_number;
+            lock.unlock();
+            if (move_update_) {
+                move_update_(job, game_number, message.move_uci, message.fen);
+            }
+        } else if (message.type == MessageType::Live) {
+            const auto job = it->second.job;
+            const int game_number = it->second.game_number;
+            const int board = it->second.board;
+            lock.unlock();
+            if (live_update_) {
+                live_update_(job, game_number, board, message.pgn);
+            }
+        } else if (message.type == MessageType::Result) {
+            InFlightGame finished = std::move(it->second);
+            in_flight_.erase(it);
+            boards_[static_cast<size_t>(finished.board)] = false;
+            worker->busy -= 1;
+            lock.unlock();
+            cv_.notify_all();
+            if (job_event_) {
+                job_event_(finished.job, finished.game_number, false);
+            }
+            ijccrl::core::runtime::MatchResult payload{finished.job, message.result, finished.game_number};
+            payload.duration_seconds = message.duration_seconds;
+            if (result_callback_) {
+                result_callback_(payload);
+            }
+        }
+    }
+    if (reader.overflowed() && log_) {
+        log_("Worker " + worker->peer + ": message too long, closing the connection");
+    }
+    DropWorker(worker);
+}
+
+void Coordinator::DropWorker(const std::shared_ptr<WorkerConnection>& worker) {
+    std::vector<InFlightGame> orphaned;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        worker->alive = false;
+        for (auto it = in_flight_.begin(); it != in_flight_.end();) {
+            if (it->second.worker_id != worker->id) {
+                ++it;
+                continue;
+            }
+            boards_[static_cast<size_t>(it->second.board)] = false;
+            orphaned.push_back(it->second);
+            // Requeued games keep their game number and stay active for the
+            // checkpoint; job.resume holds the last reported position.
+            PendingGame game;
+            game.job = std::move(it->second.job);
+            game.game_number = it->second.game_number;
+            game.started = true;
+            requeued_.push_front(std::move(game));
+            it = in_flight_.erase(it);
+        }
+        workers_.erase(worker->id);
+        retired_.push_back(worker);
+        std::lock_guard<std::mutex> write_lock(worker->write_mutex);
+        CloseSocket(worker->socket);
+        worker->socket = kInvalidSocket;
+    }
+    cv_.notify_all();
+    if (!log_ || shutting_down_.load()) {
+        return;
+    }
+    log_("Worker " + (worker->name.empty() ? worker->peer : worker->name) + " disconnected");
+    for (const auto& game : orphaned) {
+        std::ostringstream text;
+        text << "Requeued game " << game.game_number << " (fixture " << game.job.fixture_index << ") at ply "
+             << game.job.resume.moves_uci.size();
+        log_(text.str());
+    }
+}
+
+std::shared_ptr<Coordinator::WorkerConnection> Coordinator::PickWorker() {
+    std::shared_ptr<WorkerConnection> best;
+    for (const auto& entry : workers_) {
+        const auto& worker = entry.second;
+        if (!worker->ready || !worker->alive || worker->busy >= worker->slots) {
+            continue;
+        }
+        if (!best || worker->slots - worker->busy > best->slots - best->busy) {
+            best = worker;
+        }
+    }
+    return best;
+}
+
+int Coordinator::AcquireBoard() {
+    for (size_t i = 0; i < boards_.size(); ++i) {
+        if (!boards_[i]) {
+            boards_[i] = true;
+            return static_cast<int>(i);
+        }
+    }
+    boards_.push_back(true);
+    return static_cast<int>(boards_.size() - 1);
+}
+
+bool Coordinator::Send(WorkerConnection& worker, const std::string& line) {
+    std::lock_guard<std::mutex> lock(worker.write_mutex);
+    return SendLine(worker.socket, line);
+}
+
+}  // namespace ijccrl::core::distributed
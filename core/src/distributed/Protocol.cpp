@@ -0,0 +1,312 @@
+#include "ijccrl/core/distributed/Protocol.h"
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <utility>
+
+namespace ijccrl::core::distributed {
+
+namespace {
+
+constexpr std::array<std::pair<MessageType, const char*>, 10> kTypeNames = {{
+    {MessageType::Hello, "hello"},
+    {MessageType::Welcome, "welcome"},
+    {MessageType::Job, "job"},
+    {MessageType::Progress, "progress"},
+    {MessageType::Move, "move"},
+    {MessageType::Live, "live"},
+    {MessageType::Log, "log"},
+    {MessageType::Result, "result"},
+    {MessageType::Stop, "stop"},
+    {MessageType::Bye, "bye"},
+}};
+
+const char* TypeName(MessageType type) {
+    for (const auto& entry : kTypeNames) {
+        if (entry.first == type) {
+            return entry.second;
+        }
+    }
+    return "unknown";
+}
+
+MessageType TypeFromName(const std::string& name) {
+    for (const auto& entry : kTypeNames) {
+        if (name == entry.second) {
+            return entry.first;
+        }
+    }
+    return MessageType::Unknown;
+}
+
+nlohmann::json EvalToJson(const ijccrl::core::game::GameState::EvalInfo& eval) {
+    return {
+        {"has_cp", eval.has_cp},
+        {"cp", eval.cp},
+        {"has_mate", eval.has_mate},
+        {"mate", eval.mate},
+        {"depth", eval.depth},
+    };
+}
+
+ijccrl::core::game::GameState::EvalInfo EvalFromJson(const nlohmann::json& node) {
+    ijccrl::core::game::GameState::EvalInfo eval;
+    eval.has_cp = node.value("has_cp", false);
+    eval.cp = node.value("cp", 0);
+    eval.has_mate = node.value("has_mate", false);
+    eval.mate = node.value("mate", 0);
+    eval.depth = node.value("depth", 0);
+    return eval;
+}
+
+nlohmann::json ProgressToJson(const ijccrl::core::game::GameProgress& progress) {
+    return {
+        {"moves", progress.moves_uci},
+        {"wtime_ms", progress.wtime_ms},
+        {"btime_ms", progress.btime_ms},
+        {"draw_score_streak", progress.draw_score_streak},
+        {"win_score_streak_white", progress.win_score_streak_white},
+        {"win_score_streak_black", progress.win_score_streak_black},
+        {"resign_streak_white", progress.resign_streak_white},
+        {"resign_streak_black", progress.resign_streak_black},
+        {"last_eval_white", EvalToJson(progress.last_eval_white)},
+        {"last_eval_black", EvalToJson(progress.last_eval_black)},
+    };
+}
+
+ijccrl::core::game::GameProgress ProgressFromJson(const nlohmann::json& node) {
+    ijccrl::core::game::GameProgress progress;
+    progress.moves_uci = node.value("moves", std::vector<std::string>{});
+    progress.wtime_ms = node.value("wtime_ms", 0);
+    progress.btime_ms = node.value("btime_ms", 0);
+    progress.draw_score_streak = node.value("draw_score_streak", 0);
+    progress.win_score_streak_white = node.value("win_score_streak_white", 0);
+    progress.win_score_streak_black = node.value("win_score_streak_black", 0);
+    progress.resign_streak_white = node.value("resign_streak_white", 0);
+    progress.resign_streak_black = node.value("resign_streak_black", 0);
+    if (node.contains("last_eval_white")) {
+        progress.last_eval_white = EvalFromJson(node.at("last_eval_white"));
+    }
+    if (node.contains("last_eval_black")) {
+        progress.last_eval_black = EvalFromJson(node.at("last_eval_black"));
+    }
+    return progress;
+}
+
+nlohmann::json PgnToJson(const ijccrl::core::pgn::PgnGame& pgn) {
+    nlohmann::json tags = nlohmann::json::array();
+    for (const auto& tag : pgn.tags) {
+        tags.push_back({tag.key, tag.value});
+    }
+    return {
+        {"tags", tags},
+        {"moves", pgn.moves},
+        {"result", pgn.result},
+        {"termination_comment", pgn.termination_comment},
+    };
+}
+
+ijccrl::core::pgn::PgnGame PgnFromJson(const nlohmann::json& node) {
+    ijccrl::core::pgn::PgnGame pgn;
+    if (node.contains("tags")) {
+        for (const auto& tag : node.at("tags")) {
+            pgn.tags.push_back({tag.at(0).get<std::string>(), tag.at(1).get<std::string>()});
+        }
+    }
+    pgn.moves = node.value("moves", std::vector<std::string>{});
+    pgn.result = node.value("result", pgn.result);
+    pgn.termination_comment = node.value("termination_comment", std::string{});
+    return pgn;
+}
+
+nlohmann::json JobToJson(const ijccrl::core::runtime::MatchJob& job) {
+    return {
+        {"round_index", job.fixture.round_index},
+        {"white_engine_id", job.fixture.white_engine_id},
+        {"black_engine_id", job.fixture.black_engine_id},
+        {"game_index_within_pairing", job.fixture.game_index_within_pairing},
+        {"pairing_id", job.fixture.pairing_id},
+        {"opening_id", job.opening.id},
+        {"opening_fen", job.opening.fen},
+        {"opening_moves", job.opening.moves},
+        {"event_name", job.event_name},
+        {"site_tag", job.site_tag},
+        {"round_label", job.round_label},
+        {"fixture_index", job.fixture_index},
+        {"resume", ProgressToJson(job.resume)},
+    };
+}
+
+ijccrl::core::runtime::MatchJob JobFromJson(const nlohmann::json& node) {
+    ijccrl::core::runtime::MatchJob job;
+    job.fixture.round_index = node.value("round_index", 0);
+    job.fixture.white_engine_id = node.value("white_engine_id", -1);
+    job.fixture.black_engine_id = node.value("black_engine_id", -1);
+    job.fixture.game_index_within_pairing = node.value("game_index_within_pairing", 0);
+    job.fixture.pairing_id = node.value("pairing_id", std::string{});
+    job.opening.id = node.value("opening_id", std::string{});
+    job.opening.fen = node.value("opening_fen", std::string{});
+    job.opening.moves = node.value("opening_moves", std::vector<std::string>{});
+    job.event_name = node.value("event_name", std::string{});
+    job.site_tag = node.value("site_tag", std::string{});
+    job.round_label = node.value("round_label", std::string{});
+    job.fixture_index = node.value("fixture_index", 0);
+    if (node.contains("resume")) {
+        job.resume = ProgressFromJson(node.at("resume"));
+    }
+    return job;
+}
+
+nlohmann::json ResultToJson(const ijccrl::core::game::GameRunner::Result& result) {
+    const auto& state = result.state;
+    return {
+        {"moves", state.moves_uci},
+        {"side_to_move", state.side_to_move == ijccrl::core::game::Side::White ? "w" : "b"},
+        {"wtime_ms", state.wtime_ms},
+        {"btime_ms", state.btime_ms},
+        {"winc_ms", state.winc_ms},
+        {"binc_ms", state.binc_ms},
+        {"last_eval_white", EvalToJson(state.last_eval_white)},
+        {"last_eval_black", EvalToJson(state.last_eval_black)},
+        {"result", state.result},
+        {"termination", state.termination},
+        {"termination_detail", state.termination_detail},
+        {"tablebase_used", state.tablebase_used},
+        {"pgn", PgnToJson(result.pgn)},
+        {"final_fen", result.final_fen},
+    };
+}
+
+ijccrl::core::game::GameRunner::Result ResultFromJson(const nlohmann::json& node) {
+    ijccrl::core::game::GameRunner::Result result;
+    auto& state = result.state;
+    state.moves_uci = node.value("moves", std::vector<std::string>{});
+    state.side_to_move = node.value("side_to_move", std::string("w")) == "b" ? ijccrl::core::game::Side::Black
+                                                                             : ijccrl::core::game::Side::White;
+    state.wtime_ms = node.value("wtime_ms", 0);
+    state.btime_ms = node.value("btime_ms", 0);
+    state.winc_ms = node.value("winc_ms", 0);
+    state.binc_ms = node.value("binc_ms", 0);
+    if (node.contains("last_eval_white")) {
+        state.last_eval_white = EvalFromJson(node.at("last_eval_white"));
+    }
+    if (node.contains("last_eval_black")) {
+        state.last_eval_black = EvalFromJson(node.at("last_eval_black"));
+    }
+    state.result = node.value("result", state.result);
+    state.termination = node.value("termination", std::string{});
+    state.termination_detail = node.value("termination_detail", std::string{});
+    state.tablebase_used = node.value("tablebase_used", false);
+    if (node.contains("pgn")) {
+        result.pgn = PgnFromJson(node.at("pgn"));
+    }
+    result.final_fen = node.value("final_fen", std::string{});
+    return result;
+}
+
+}  // namespace
+
+std::string EncodeMessage(const Message& message) {
+    nlohmann::json root;
+    root["type"] = TypeName(message.type);
+    switch (message.type) {
+        case MessageType::Hello:
+            root["slots"] = message.slots;
+            root["name"] = message.text;
+            root["token"] = message.token;
+            break;
+        case MessageType::Welcome:
+            root["config"] = message.text;
+            root["live"] = message.live;
+            break;
+        case MessageType::Job:
+            root["job"] = JobToJson(message.job);
+            break;
+        case MessageType::Progress:
+            root["fixture_index"] = message.fixture_index;
+            root["progress"] = ProgressToJson(message.progress);
+            break;
+        case MessageType::Move:
+            root["fixture_index"] = message.fixture_index;
+            root["move"] = message.move_uci;
+            root["fen"] = message.fen;
+            break;
+        case MessageType::Live:
+            root["fixture_index"] = message.fixture_index;
+            root["pgn"] = PgnToJson(message.pgn);
+            break;
+        case MessageType::Log:
+            root["line"] = message.text;
+            break;
+        case MessageType::Result:
+            root["fixture_index"] = message.fixture_index;
+            root["result"] = ResultToJson(message.result);
+            root["duration_seconds"] = message.duration_seconds;
+            break;
+        case MessageType::Stop:
+        case MessageType::Bye:
+        case MessageType::Unknown:
+            break;
+    }
+    return root.dump();
+}
+
+bool DecodeMessage(const std::string& line, Message& message, std::string* error) {
+    try {
+        const auto root = nlohmann::json::parse(line);
+        message = Message{};
+        message.type = TypeFromName(root.value("type", std::string{}));
+        switch (message.type) {
+            case MessageType::Hello:
+                message.slots = root.value("slots", 1);
+                message.text = root.value("name", std::string{});
+                message.token = root.value("token", std::string{});
+                break;
+            case MessageType::Welcome:
+                message.text = root.value("config", std::string{});
+                message.live = root.value("live", false);
+                break;
+            case MessageType::Job:
+                message.job = JobFromJson(root.at("job"));
+                break;
+            case MessageType::Progress:
+                message.fixture_index = root.value("fixture_index", 0);
+                message.progress = ProgressFromJson(root.at("progress"));
+                break;
+            case MessageType::Move:
+                message.fixture_index = root.value("fixture_index", 0);
+                message.move_uci = root.value("move", std::string{});
+                message.fen = root.value("fen", std::string{});
+                break;
+            case MessageType::Live:
+                message.fixture_index = root.value("fixture_index", 0);
+                message.pgn = PgnFromJson(root.at("pgn"));
+                break;
+            case MessageType::Log:
+                message.text = root.value("line", std::string{});
+                break;
+            case MessageType::Result:
+                message.fixture_index = root.value("fixture_index", 0);
+                message.result = ResultFromJson(root.at("result"));
+                message.duration_seconds = root.value("duration_seconds", 0.0);
+                break;
+            case MessageType::Stop:
+            case MessageType::Bye:
+                break;
+            case MessageType::Unknown:
+                if (error) {
+                    *error = "Unknown message type.";
+                }
+                return false;
+        }
+    } catch (const std::exception& ex) {
+        if (error) {
+            *error = std::string("Malformed message: ") + ex.what();
+        }
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ijccrl::core::distributed
@@ -0,0 +1,351 @@
+#include "ijccrl/core/distributed/Socket.h"
+
+#include <cstring>
+#include <mutex>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace ijccrl::core::distributed {
+
+namespace {
+
+#ifdef _WIN32
+using NativeSocket = SOCKET;
+constexpr NativeSocket kNativeInvalid = INVALID_SOCKET;
+#else
+using NativeSocket = int;
+constexpr NativeSocket kNativeInvalid = -1;
+#endif
+
+NativeSocket Native(SocketHandle socket) {
+    return static_cast<NativeSocket>(socket);
+}
+
+SocketHandle Handle(NativeSocket socket) {
+    return socket == kNativeInvalid ? kInvalidSocket : static_cast<SocketHandle>(socket);
+}
+
+void EnsureStartup() {
+#ifdef _WIN32
+    static std::once_flag once;
+    std::call_once(once, []() {
+        WSADATA data;
+        WSAStartup(MAKEWORD(2, 2), &data);
+    });
+#endif
+}
+
+void SetError(std::string* error, const std::string& message) {
+    if (error) {
+        *error = message;
+    }
+}
+
+void CloseNative(NativeSocket socket) {
+#ifdef _WIN32
+    closesocket(socket);
+#else
+    close(socket);
+#endif
+}
+
+bool IsUnixAddress(const std::string& address) {
+    return address.rfind("unix:", 0) == 0;
+}
+
+bool SplitHostPort(const std::string& address, std::string& host, std::string& port) {
+    const auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+    host = address.substr(0, colon);
+    port = address.substr(colon + 1);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    return !port.empty();
+}
+
+// Engines are child processes of the worker; they must not inherit the
+// connection, or a killed worker would keep it open.
+void PrepareSocket(NativeSocket socket, bool tcp) {
+#ifndef _WIN32
+    fcntl(socket, F_SETFD, FD_CLOEXEC);
+#endif
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    if (tcp) {
+        int enabled = 1;
+        setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&enabled), sizeof(enabled));
+        setsockopt(socket, SOL_SOCKET, SO_KEEPALIVE, reinterpret_cast<const char*>(&enabled), sizeof(enabled));
+    }
+}
+
+#ifndef _WIN32
+bool MakeUnixAddress(const std::string& address, sockaddr_un& out, std::string* error) {
+    const std::string path = address.substr(5);
+    if (path.empty() || path.size() >= sizeof(out.sun_path)) {
+        SetError(error, "Invalid Unix socket path: " + address);
+        return false;
+    }
+    std::memset(&out, 0, sizeof(out));
+    out.sun_family = AF_UNIX;
+    std::memcpy(out.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+#endif
+
+}  // namespace
+
+SocketHandle ListenSocket(const std::string& address, std::string* error) {
+    EnsureStartup();
+    if (IsUnixAddress(address)) {
+#ifdef _WIN32
+        SetError(error, "Unix sockets are not supported on this platform.");
+        return kInvalidSocket;
+#else
+        sockaddr_un unix_address;
+        if (!MakeUnixAddress(address, unix_address, error)) {
+            return kInvalidSocket;
+        }
+        const NativeSocket socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket == kNativeInvalid) {
+            SetError(error, "Failed to create socket for " + address);
+            return kInvalidSocket;
+        }
+        PrepareSocket(socket, false);
+        unlink(unix_address.sun_path);
+        if (bind(socket, reinterpret_cast<const sockaddr*>(&unix_address), sizeof(unix_address)) != 0 ||
+            listen(socket, 16) != 0) {
+            CloseNative(socket);
+            SetError(error, "Failed to listen on " + address);
+            return kInvalidSocket;
+        }
+        return Handle(socket);
+#endif
+    }
+
+    std::string host;
+    std::string port;
+    if (!SplitHostPort(address, host, port)) {
+        SetError(error, "Invalid listen address (expected host:port): " + address);
+        return kInvalidSocket;
+    }
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo* results = nullptr;
+    if (getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &results) != 0) {
+        SetError(error, "Failed to resolve " + address);
+        return kInvalidSocket;
+    }
+    NativeSocket socket = kNativeInvalid;
+    for (auto* info = results; info; info = info->ai_next) {
+        socket = ::socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+        if (socket == kNativeInvalid) {
+            continue;
+        }
+        int reuse = 1;
+        setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+        PrepareSocket(socket, true);
+        if (bind(socket, info->ai_addr, static_cast<int>(info->ai_addrlen)) == 0 && listen(socket, 16) == 0) {
+            break;
+        }
+        CloseNative(socket);
+        socket = kNativeInvalid;
+    }
+    freeaddrinfo(results);
+    if (socket == kNativeInvalid) {
+        SetError(error, "Failed to listen on " + address);
+    }
+    return Handle(socket);
+}
+
+SocketHandle AcceptSocket(SocketHandle listener, int timeout_ms, std::string* peer) {
+#ifdef _WIN32
+    WSAPOLLFD poll_fd{};
+    poll_fd.fd = Native(listener);
+    poll_fd.events = POLLRDNORM;
+    if (WSAPoll(&poll_fd, 1, timeout_ms) <= 0) {
+        return kInvalidSocket;
+    }
+#else
+    pollfd poll_fd{};
+    poll_fd.fd = Native(listener);
+    poll_fd.events = POLLIN;
+    if (poll(&poll_fd, 1, timeout_ms) <= 0) {
+        return kInvalidSocket;
+    }
+#endif
+    sockaddr_storage address{};
+    socklen_t length = sizeof(address);
+    const NativeSocket socket = accept(Native(listener), reinterpret_cast<sockaddr*>(&address), &length);
+    if (socket == kNativeInvalid) {
+        return kInvalidSocket;
+    }
+    const bool tcp = address.ss_family == AF_INET || address.ss_family == AF_INET6;
+    PrepareSocket(socket, tcp);
+    if (peer) {
+        char host[256] = {0};
+        char service[32] = {0};
+        if (tcp && getnameinfo(reinterpret_cast<const sockaddr*>(&address),
+                               length,
+                               host,
+                               sizeof(host),
+                               service,
+                               sizeof(service),
+                               NI_NUMERICHOST | NI_NUMERICSERV) == 0) {
+            *peer = std::string(host) + ":" + service;
+        } else {
+            *peer = "local";
+        }
+    }
+    return Handle(socket);
+}
+
+SocketHandle ConnectSocket(const std::string& address, std::string* error) {
+    EnsureStartup();
+    if (IsUnixAddress(address)) {
+#ifdef _WIN32
+        SetError(error, "Unix sockets are not supported on this platform.");
+        return kInvalidSocket;
+#else
+        sockaddr_un unix_address;
+        if (!MakeUnixAddress(address, unix_address, error)) {
+            return kInvalidSocket;
+        }
+        const NativeSocket socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket == kNativeInvalid) {
+            SetError(error, "Failed to create socket for " + address);
+            return kInvalidSocket;
+        }
+        PrepareSocket(socket, false);
+        if (connect(socket, reinterpret_cast<const sockaddr*>(&unix_address), sizeof(unix_address)) != 0) {
+            CloseNative(socket);
+            SetError(error, "Failed to connect to " + address);
+            return kInvalidSocket;
+        }
+        return Handle(socket);
+#endif
+    }
+
+    std::string host;
+    std::string port;
+    if (!SplitHostPort(address, host, port) || host.empty()) {
+        SetError(error, "Invalid coordinator address (expected host:port): " + address);
+        return kInvalidSocket;
+    }
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* results = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &results) != 0) {
+        SetError(error, "Failed to resolve " + address);
+        return kInvalidSocket;
+    }
+    NativeSocket socket = kNativeInvalid;
+    for (auto* info = results; info; info = info->ai_next) {
+        socket = ::socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+        if (socket == kNativeInvalid) {
+            continue;
+        }
+        PrepareSocket(socket, true);
+        if (connect(socket, info->ai_addr, static_cast<int>(info->ai_addrlen)) == 0) {
+            break;
+        }
+        CloseNative(socket);
+        socket = kNativeInvalid;
+    }
+    freeaddrinfo(results);
+    if (socket == kNativeInvalid) {
+        SetError(error, "Failed to connect to " + address);
+    }
+    return Handle(socket);
+}
+
+bool SendLine(SocketHandle socket, const std::string& line) {
+    if (socket == kInvalidSocket) {
+        return false;
+    }
+    const std::string payload = line + '\n';
+    size_t sent = 0;
+    while (sent < payload.size()) {
+#ifdef _WIN32
+        const int written = send(Native(socket), payload.data() + sent, static_cast<int>(payload.size() - sent), 0);
+#elif defined(MSG_NOSIGNAL)
+        const auto written = send(Native(socket), payload.data() + sent, payload.size() - sent, MSG_NOSIGNAL);
+#else
+        const auto written = send(Native(socket), payload.data() + sent, payload.size() - sent, 0);
+#endif
+        if (written <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(written);
+    }
+    return true;
+}
+
+void ShutdownSocket(SocketHandle socket) {
+    if (socket == kInvalidSocket) {
+        return;
+    }
+#ifdef _WIN32
+    shutdown(Native(socket), SD_BOTH);
+#else
+    shutdown(Native(socket), SHUT_RDWR);
+#endif
+}
+
+void CloseSocket(SocketHandle socket) {
+    if (socket != kInvalidSocket) {
+        CloseNative(Native(socket));
+    }
+}
+
+bool LineReader::ReadLine(std::string& line) {
+    while (true) {
+        const auto newline = buffer_.find('\n', scanned_);
+        if (newline != std::string::npos) {
+            if (newline > max_line_) {
+                overflowed_ = true;
+                return false;
+            }
+            line = buffer_.substr(0, newline);
+            buffer_.erase(0, newline + 1);
+            scanned_ = 0;
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            return true;
+        }
+        scanned_ = buffer_.size();
+        if (scanned_ > max_line_) {
+            overflowed_ = true;
+            return false;
+        }
+        char chunk[4096];
+        const auto received = recv(Native(socket_), chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            return false;
+        }
+        buffer_.append(chunk, static_cast<size_t>(received));
+    }
+}
+
+}  // namespace ijccrl::core::distributed
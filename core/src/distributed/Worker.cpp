@@ -0,0 +1,241 @@
+#include "ijccrl/core/distributed/Worker.h"
+
+#include "ijccrl/core/api/RunnerConfig.h"
+#include "ijccrl/core/distributed/Protocol.h"
+#include "ijccrl/core/distributed/Socket.h"
+#include "ijccrl/core/runtime/EnginePool.h"
+#include "ijccrl/core/runtime/JobQueue.h"
+#include "ijccrl/core/runtime/MatchRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ijccrl::core::distributed {
+
+Worker::Worker(Options options, LogFn log) : options_(std::move(options)), log_(std::move(log)) {}
+
+bool Worker::Run(std::atomic<bool>& stop, std::string* error) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(std::max(0, options_.connect_timeout_seconds));
+    SocketHandle socket = kInvalidSocket;
+    while (true) {
+        socket = ConnectSocket(options_.address, error);
+        if (socket != kInvalidSocket) {
+            break;
+        }
+        if (stop.load() || std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+    if (error) {
+        error->clear();
+    }
+
+    std::mutex write_mutex;
+    const auto send = [&](const Message& message) {
+        const std::string line = EncodeMessage(message);
+        std::lock_guard<std::mutex> lock(write_mutex);
+        SendLine(socket, line);
+    };
+
+    Message hello;
+    hello.type = MessageType::Hello;
+    hello.slots = std::max(1, options_.slots);
+    hello.text = options_.name;
+    hello.token = options_.token;
+    send(hello);
+
+    LineReader reader(socket, kMaxMessageBytes);
+    std::string line;
+    Message welcome;
+    if (!reader.ReadLine(line) || !DecodeMessage(line, welcome, error) || welcome.type != MessageType::Welcome) {
+        if (error && error->empty()) {
+            *error = "Coordinator closed the connection during the handshake (wrong --token?).";
+        }
+        CloseSocket(socket);
+        return false;
+    }
+
+    ijccrl::core::api::RunnerConfig config;
+    if (!ijccrl::core::api::RunnerConfig::LoadFromString(welcome.text, config, error)) {
+        CloseSocket(socket);
+        return false;
+    }
+
+    std::vector<ijccrl::core::runtime::EngineSpec> specs;
+    specs.reserve(config.engines.size());
+    for (const auto& engine : config.engines) {
+        ijccrl::core::runtime::EngineSpec spec;
+        spec.name = engine.name;
+        spec.command = engine.cmd;
+        spec.args = engine.args;
+        spec.uci_options = engine.uci_options;
+        specs.push_back(std::move(spec));
+    }
+    ijccrl::core::runtime::EnginePool pool(std::move(specs), log_);
+    pool.set_handshake_timeout_ms(config.watchdog.handshake_timeout_ms);
+    pool.set_watchdog_enabled(config.watchdog.enabled);
+    // Gauntlet and SPRT engines play every game; give them one process per slot.
+    if (config.tournament.mode == "gauntlet") {
+        const auto gauntlet_ids = ijccrl::core::api::ResolveGauntletEngines(config, nullptr);
+        const int opponents = static_cast<int>(config.engines.size() - gauntlet_ids.size());
+        for (const int engine_id : gauntlet_ids) {
+            pool.set_instances(engine_id, std::max(1, std::min(hello.slots, opponents)));
+        }
+    } else if (config.tournament.mode == "sprt" && config.engines.size() >= 2) {
+        pool.set_instances(0, hello.slots);
+        pool.set_instances(1, hello.slots);
+    }
+    if (!pool.StartAll("")) {
+        if (error) {
+            *error = "Failed to start engine pool.";
+        }
+        CloseSocket(socket);
+        return false;
+    }
+
+    ijccrl::core::game::TimeControl time_control;
+    time_control.base_ms = config.time_control.base_seconds * 1000;
+    time_control.increment_ms = config.time_control.increment_seconds * 1000;
+    time_control.move_time_ms = config.time_control.move_time_ms;
+
+    ijccrl::core::rules::ConfigLimits termination_limits;
+    termination_limits.max_plies = config.limits.max_plies;
+    termination_limits.draw_by_repetition = config.limits.draw_by_repetition;
+    termination_limits.adjudication.enabled = config.adjudication.enabled;
+    termination_limits.adjudication.score_draw_cp = config.adjudication.score_draw_cp;
+    termination_limits.adjudication.score_draw_moves = config.adjudication.score_draw_moves;
+    termination_limits.adjudication.score_win_cp = config.adjudication.score_win_cp;
+    termination_limits.adjudication.score_win_moves = config.adjudication.score_win_moves;
+    termination_limits.adjudication.min_depth = config.adjudication.min_depth;
+    termination_limits.tablebases.enabled = config.tablebases.enabled;
+    termination_limits.tablebases.paths = config.tablebases.paths;
+    termination_limits.tablebases.probe_limit_pieces = config.tablebases.probe_limit_pieces;
+    termination_limits.resign.enabled = config.resign.enabled;
+    termination_limits.resign.cp = config.resign.cp;
+    termination_limits.resign.moves = config.resign.moves;
+    termination_limits.resign.min_depth = config.resign.min_depth;
+
+    const bool live = welcome.live;
+    // Pausing is the coordinator's decision, so unhealthy engines are only
+    // reported, never acted upon locally.
+    ijccrl::core::runtime::MatchRunner match_runner(
+        pool,
+        time_control,
+        termination_limits,
+        config.watchdog.go_timeout_ms,
+        config.limits.abort_on_stop,
+        config.watchdog.enabled,
+        config.watchdog.max_failures,
+        config.watchdog.failure_window_games,
+        false,
+        [&](const ijccrl::core::runtime::MatchResult& result) {
+            Message message;
+            message.type = MessageType::Result;
+            message.fixture_index = result.job.fixture_index;
+            message.result = result.result;
+            message.duration_seconds = result.duration_seconds;
+            send(message);
+        },
+        [&](const ijccrl::core::runtime::MatchJob& job, int, int, const ijccrl::core::pgn::PgnGame& pgn) {
+            if (!live) {
+                return;
+            }
+            Message message;
+            message.type = MessageType::Live;
+            message.fixture_index = job.fixture_index;
+            message.pgn = pgn;
+            send(message);
+        },
+        [&](const ijccrl::core::runtime::MatchJob& job,
+            int,
+            const std::string& move_uci,
+            const std::string& fen) {
+            if (!live) {
+                return;
+            }
+            Message message;
+            message.type = MessageType::Move;
+            message.fixture_index = job.fixture_index;
+            message.move_uci = move_uci;
+            message.fen = fen;
+            send(message);
+        },
+        [&](const std::string& text) {
+            if (log_) {
+                log_(text);
+            }
+            Message message;
+            message.type = MessageType::Log;
+            message.text = text;
+            send(message);
+        },
+        {},
+        [&](const ijccrl::core::runtime::MatchJob& job, int, const ijccrl::core::game::GameProgress& progress) {
+            Message message;
+            message.type = MessageType::Progress;
+            message.fixture_index = job.fixture_index;
+            message.progress = progress;
+            send(message);
+        });
+
+    ijccrl::core::runtime::JobQueue queue;
+    std::thread reader_thread([&]() {
+        std::string text;
+        bool said_bye = false;
+        while (reader.ReadLine(text)) {
+            Message message;
+            std::string decode_error;
+            if (!DecodeMessage(text, message, &decode_error)) {
+                if (log_) {
+                    log_(decode_error);
+                }
+                continue;
+            }
+            if (message.type == MessageType::Job) {
+                queue.Push(std::move(message.job));
+            } else if (message.type == MessageType::Stop) {
+                stop.store(true);
+            } else if (message.type == MessageType::Bye) {
+                said_bye = true;
+                break;
+            }
+        }
+        if (!said_bye) {
+            // Nobody is left to receive the results of the games in flight.
+            stop.store(true);
+        }
+        queue.Close();
+    });
+
+    if (log_) {
+        log_("Connected to coordinator " + options_.address + " with " + std::to_string(hello.slots) + " slot(s)");
+    }
+
+    ijccrl::core::runtime::MatchRunner::Control control;
+    control.stop = &stop;
+    control.drain = queue.closed_flag();
+    match_runner.Run(
+        std::numeric_limits<size_t>::max(),
+        [&](size_t, ijccrl::core::runtime::MatchJob& job) { return queue.Pop(job, &stop); },
+        hello.slots,
+        control);
+
+    {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        ShutdownSocket(socket);
+    }
+    if (reader_thread.joinable()) {
+        reader_thread.join();
+    }
+    CloseSocket(socket);
+    pool.StopAll();
+    return true;
+}
+
+}  // namespace ijccrl::core::distributed
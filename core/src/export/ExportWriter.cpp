@@ -21,18 +21,42 @@ bool EnsureParentDir(const std::string& path) {
     return true;
 }
 
+// Tie-break ranks from StandingsTable::UpdateRanks when present, points and
+// score otherwise.
+bool RanksAhead(const ijccrl::core::stats::EngineStats& a, const ijccrl::core::stats::EngineStats& b) {
+    if (a.rank > 0 && b.rank > 0) {
+        return a.rank < b.rank;
+    }
+    if (a.points != b.points) {
+        return a.points > b.points;
+    }
+    return a.score_percent() > b.score_percent();
+}
+
 std::vector<ijccrl::core::stats::EngineStats> SortedByPoints(
     const std::vector<ijccrl::core::stats::EngineStats>& standings) {
     auto sorted = standings;
-    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
-        if (a.points != b.points) {
-            return a.points > b.points;
-        }
-        return a.score_percent() > b.score_percent();
-    });
+    std::stable_sort(sorted.begin(), sorted.end(), RanksAhead);
     return sorted;
 }
 
+// Engine ids ordered like SortedByPoints, so crosstable cells can be looked up.
+std::vector<size_t> RankOrder(const std::vector<ijccrl::core::stats::EngineStats>& standings) {
+    std::vector<size_t> order(standings.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return RanksAhead(standings[a], standings[b]);
+    });
+    return order;
+}
+
+bool CrosstableMatches(const std::vector<ijccrl::core::stats::EngineStats>& standings,
+                       const std::vector<ijccrl::core::stats::HeadToHead>& crosstable) {
+    return crosstable.size() == standings.size() * standings.size();
+}
+
 }  // namespace
 
 bool WriteStandingsCsv(const std::string& path, const std::vector<ijccrl::core::stats::EngineStats>& standings) {
@@ -41,7 +65,7 @@ bool WriteStandingsCsv(const std::string& path, const std::vector<ijccrl::core::
     if (!output) {
         return false;
     }
-    output << "rank,name,pts,g,w,d,l,score_percent\n";
+    output << "rank,name,pts,g,w,d,l,score_percent,buchholz,sonneborn_berger,koya\n";
     const auto sorted = SortedByPoints(standings);
     int rank = 1;
     for (const auto& row : sorted) {
@@ -52,7 +76,10 @@ bool WriteStandingsCsv(const std::string& path, const std::vector<ijccrl::core::
                << row.wins << ','
                << row.draws << ','
                << row.losses << ','
-               << row.score_percent()
+               << row.score_percent() << ','
+               << row.buchholz << ','
+               << row.sonneborn_berger << ','
+               << row.koya
                << "\n";
     }
     return true;
@@ -71,6 +98,7 @@ bool WriteStandingsHtml(const std::string& path,
     html << "<h2>" << event_name << "</h2>\n";
     html << "<table>\n<thead><tr>"
          << "<th>Rank</th><th>Name</th><th>Pts</th><th>G</th><th>W</th><th>D</th><th>L</th><th>Score%</th>"
+         << "<th>Buchholz</th><th>SB</th><th>Koya</th>"
          << "</tr></thead>\n<tbody>\n";
     const auto sorted = SortedByPoints(standings);
     int rank = 1;
@@ -78,7 +106,9 @@ bool WriteStandingsHtml(const std::string& path,
         html << "<tr><td>" << rank++ << "</td><td>" << row.name << "</td><td>"
              << row.points << "</td><td>" << row.games << "</td><td>"
              << row.wins << "</td><td>" << row.draws << "</td><td>"
-             << row.losses << "</td><td>" << row.score_percent() << "</td></tr>\n";
+             << row.losses << "</td><td>" << row.score_percent() << "</td><td>"
+             << row.buchholz << "</td><td>" << row.sonneborn_berger << "</td><td>"
+             << row.koya << "</td></tr>\n";
     }
     html << "</tbody></table>\n</body></html>\n";
     return ijccrl::core::util::AtomicFileWriter::Write(path, html.str());
@@ -101,7 +131,7 @@ bool WriteSummaryJson(const std::string& path,
     const size_t limit = std::min<size_t>(10, sorted.size());
     for (size_t i = 0; i < limit; ++i) {
         const auto& row = sorted[i];
-        summary["top10"].push_back({
+        nlohmann::json entry = {
             {"rank", static_cast<int>(i + 1)},
             {"name", row.name},
             {"pts", row.points},
@@ -110,9 +140,112 @@ bool WriteSummaryJson(const std::string& path,
             {"d", row.draws},
             {"l", row.losses},
             {"score_percent", row.score_percent()},
-        });
+            {"elo", row.elo},
+            {"elo_error", row.elo_error},
+            {"buchholz", row.buchholz},
+            {"sonneborn_berger", row.sonneborn_berger},
+            {"koya", row.koya},
+        };
+        if (row.search.games > 0) {
+            entry["search"] = {
+                {"games", row.search.games},
+                {"searches", row.search.searches},
+                {"average_depth", row.search.average_depth},
+                {"min_depth", row.search.min_depth},
+                {"nps_p10", row.search.nps_p10},
+                {"nps_p50", row.search.nps_p50},
+                {"nps_p90", row.search.nps_p90},
+                {"time_used_seconds", row.search.time_used_seconds},
+                {"time_allotted_seconds", row.search.time_allotted_seconds},
+                {"time_usage", row.search.time_usage()},
+                {"min_margin_ms", row.search.min_margin_ms},
+            };
+        }
+        summary["top10"].push_back(std::move(entry));
     }
     return ijccrl::core::util::AtomicFileWriter::Write(path, summary.dump(2));
 }
 
+bool WriteCrosstableJson(const std::string& path,
+                         const std::string& event_name,
+                         const std::vector<ijccrl::core::stats::EngineStats>& standings,
+                         const std::vector<ijccrl::core::stats::HeadToHead>& crosstable) {
+    if (path.empty() || !CrosstableMatches(standings, crosstable)) {
+        return false;
+    }
+    EnsureParentDir(path);
+    const size_t count = standings.size();
+    const auto order = RankOrder(standings);
+    nlohmann::json output;
+    output["event"] = event_name;
+    output["engines"] = nlohmann::json::array();
+    for (const size_t row : order) {
+        nlohmann::json results = nlohmann::json::array();
+        for (const size_t column : order) {
+            if (row == column) {
+                results.push_back(nullptr);
+                continue;
+            }
+            const auto& cell = crosstable[row * count + column];
+            results.push_back({
+                {"g", cell.games()},
+                {"w", cell.wins},
+                {"d", cell.draws},
+                {"l", cell.losses},
+                {"pts", cell.points()},
+            });
+        }
+        output["engines"].push_back({
+            {"name", standings[row].name},
+            {"pts", standings[row].points},
+            {"g", standings[row].games},
+            {"results", std::move(results)},
+        });
+    }
+    return ijccrl::core::util::AtomicFileWriter::Write(path, output.dump(2));
+}
+
+bool WriteCrosstableHtml(const std::string& path,
+                         const std::string& event_name,
+                         const std::vector<ijccrl::core::stats::EngineStats>& standings,
+                         const std::vector<ijccrl::core::stats::HeadToHead>& crosstable) {
+    if (path.empty() || !CrosstableMatches(standings, crosstable)) {
+        return false;
+    }
+    EnsureParentDir(path);
+    const size_t count = standings.size();
+    const auto order = RankOrder(standings);
+    std::ostringstream html;
+    html << "<!doctype html>\n<html><head><meta charset=\"utf-8\">"
+         << "<title>Crosstable</title>"
+         << "<style>table{border-collapse:collapse;font-family:Arial,sans-serif}"
+         << "th,td{border:1px solid #ccc;padding:4px 8px;text-align:center}</style>"
+         << "</head><body>\n";
+    html << "<h2>" << event_name << "</h2>\n";
+    html << "<table>\n<thead><tr><th>Rank</th><th>Name</th><th>Pts</th>";
+    for (size_t i = 0; i < order.size(); ++i) {
+        html << "<th>" << (i + 1) << "</th>";
+    }
+    html << "</tr></thead>\n<tbody>\n";
+    for (size_t rank = 0; rank < order.size(); ++rank) {
+        const size_t row = order[rank];
+        html << "<tr><td>" << (rank + 1) << "</td><td>" << standings[row].name << "</td><td>"
+             << standings[row].points << "</td>";
+        for (const size_t column : order) {
+            const auto& cell = crosstable[row * count + column];
+            if (row == column) {
+                html << "<td>&times;</td>";
+            } else if (cell.games() == 0) {
+                html << "<td></td>";
+            } else {
+                html << "<td title=\"+" << cell.wins << " =" << cell.draws << " -" << cell.losses << "\">"
+                     << cell.points() << "/" << cell.games() << "</td>";
+            }
+        }
+        html << "</tr>\n";
+    }
+    html << "</tbody></table>\n</body></html>\n";
+    return ijccrl::core::util::AtomicFileWriter::Write(path, html.str());
+}
+
 }  // namespace ijccrl::core::exporter
@@ -1,7 +1,9 @@
 #include "ijccrl/core/game/GameRunner.h"
 
 #include "ijccrl/core/pgn/PgnWriter.h"
+#include "ijccrl/core/util/LatencyHistogram.h"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -29,6 +31,13 @@ bool IsStartposFen(const std::string& fen) {
     return fen == "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 }
 
+bool CanResume(const GameProgress* resume_from, const std::vector<std::string>& opening_moves) {
+    if (!resume_from || resume_from->moves_uci.size() <= opening_moves.size()) {
+        return false;
+    }
+    return std::equal(opening_moves.begin(), opening_moves.end(), resume_from->moves_uci.begin());
+}
+
 }  // namespace
 
 GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
@@ -41,8 +50,11 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
                                         const std::string& initial_fen,
                                         const std::vector<std::string>& opening_moves,
                                         const LiveUpdateFn& live_update,
-                                        const MoveUpdateFn& move_update) {
+                                        const MoveUpdateFn& move_update,
+                                        const GameProgress* resume_from,
+                                        const ProgressFn& progress_update) {
     Result result;
+    ijccrl::core::util::ClearBestmoveMark();
     result.state.wtime_ms = time_control.base_ms;
     result.state.btime_ms = time_control.base_ms;
     result.state.winc_ms = time_control.increment_ms;
@@ -78,12 +90,32 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
                                                    termination_limits.tablebases);
     ijccrl::core::rules::EngineInfos engine_infos;
 
-    for (const auto& move : opening_moves) {
+    const bool resuming = CanResume(resume_from, opening_moves);
+    if (resuming) {
+        result.state.moves_uci = resume_from->moves_uci;
+        result.state.wtime_ms = resume_from->wtime_ms;
+        result.state.btime_ms = resume_from->btime_ms;
+        result.state.last_eval_white = resume_from->last_eval_white;
+        result.state.last_eval_black = resume_from->last_eval_black;
+        engine_infos.white.eval = resume_from->last_eval_white;
+        engine_infos.black.eval = resume_from->last_eval_black;
+        if (result.state.moves_uci.size() % 2 == 1) {
+            result.state.side_to_move = Side::Black;
+        }
+        terminator.RestoreStreaks(*resume_from);
+    }
+
+    for (const auto& move : result.state.moves_uci) {
         terminator.ApplyMove(move);
         if (move_update) {
             move_update(move, terminator.CurrentFen());
         }
     }
+    if (resuming) {
+        publish_live("*");
+    }
+    const int white_clock_start = result.state.wtime_ms;
+    const int black_clock_start = result.state.btime_ms;
 
     auto update_eval = [&](ijccrl::core::uci::UciEngine& engine,
                            Side engine_side) {
@@ -107,6 +139,23 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
         }
     };
 
+    auto record_search = [&](const ijccrl::core::uci::UciEngine& engine,
+                             Side engine_side,
+                             std::chrono::steady_clock::time_point started,
+                             bool got_move,
+                             int movetime_ms,
+                             int timeout_ms) {
+        const auto finished = got_move ? engine.last_bestmove_time() : std::chrono::steady_clock::now();
+        const long long used_ms =
+            std::max<long long>(0, std::chrono::duration_cast<std::chrono::milliseconds>(finished - started).count());
+        const int allotted_ms = movetime_ms > 0 ? movetime_ms
+                                                : (engine_side == Side::White ? result.state.winc_ms
+                                                                              : result.state.binc_ms);
+        const auto& info = engine.last_info();
+        auto& search = engine_side == Side::White ? result.white_search : result.black_search;
+        search.AddSearch(info.depth, info.nodes, info.nps, used_ms, allotted_ms, timeout_ms - used_ms);
+    };
+
     while (true) {
         if (stop_requested && stop_requested->load()) {
             const auto outcome = terminator.ShouldEnd(result.state,
@@ -147,6 +196,7 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
         const int movetime_ms = time_control.move_time_ms;
         const int timeout_ms = go_timeout_ms > 0 ? go_timeout_ms : (movetime_ms + 5000);
         std::string bestmove;
+        const auto go_started = std::chrono::steady_clock::now();
         const bool got_move = engine.Go(result.state.wtime_ms,
                                         result.state.btime_ms,
                                         result.state.winc_ms,
@@ -154,6 +204,7 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
                                         movetime_ms,
                                         timeout_ms,
                                         bestmove);
+        record_search(engine, result.state.side_to_move, go_started, got_move, movetime_ms, timeout_ms);
         if (!got_move || bestmove.empty()) {
             if (!got_move) {
                 current_info.timeout = engine.last_failure() ==
@@ -179,9 +230,13 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
             break;
         }
 
+        ijccrl::core::util::MarkBestmoveReceived(engine.last_bestmove_time());
         result.state.moves_uci.push_back(bestmove);
         update_eval(engine, result.state.side_to_move);
         terminator.ApplyMove(bestmove);
+        if (latency_) {
+            latency_->Record(ijccrl::core::util::BroadcastStage::Runner);
+        }
         if (move_update) {
             move_update(bestmove, terminator.CurrentFen());
         }
@@ -211,6 +266,17 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
             termination_reason = outcome.reason;
             break;
         }
+
+        if (progress_update) {
+            GameProgress progress;
+            progress.moves_uci = result.state.moves_uci;
+            progress.wtime_ms = result.state.wtime_ms;
+            progress.btime_ms = result.state.btime_ms;
+            progress.last_eval_white = result.state.last_eval_white;
+            progress.last_eval_black = result.state.last_eval_black;
+            terminator.CaptureStreaks(progress);
+            progress_update(progress);
+        }
     }
 
     if (result.state.result == "*" && result.state.termination.empty()) {
@@ -219,6 +285,15 @@ GameRunner::Result GameRunner::PlayGame(ijccrl::core::uci::UciEngine& white,
         termination_reason = ijccrl::core::rules::TerminationReason::MaxPlies;
     }
 
+    if (time_control.move_time_ms <= 0) {
+        if (result.white_search.searches > 0) {
+            result.white_search.time_allotted_ms += white_clock_start;
+        }
+        if (result.black_search.searches > 0) {
+            result.black_search.time_allotted_ms += black_clock_start;
+        }
+    }
+
     result.final_fen = terminator.CurrentFen();
     result.pgn.SetTag("Result", result.state.result);
     if (termination_reason.has_value()) {
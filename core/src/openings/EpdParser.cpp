@@ -1,129 +1,175 @@
 #include "ijccrl/core/openings/EpdParser.h"
 
+#include "ijccrl/core/util/MappedFile.h"
+
 #include <algorithm>
 #include <cctype>
-#include <fstream>
 #include <functional>
-#include <sstream>
+#include <string_view>
+#include <thread>
 
 namespace ijccrl::core::openings {
 
 namespace {
 
-std::string Trim(const std::string& value) {
+constexpr size_t kMinChunkBytes = 1 << 20;
+
+std::string_view Trim(std::string_view value) {
     const auto start = value.find_first_not_of(" \t\r\n");
-    if (start == std::string::npos) {
+    if (start == std::string_view::npos) {
         return {};
     }
     const auto end = value.find_last_not_of(" \t\r\n");
     return value.substr(start, end - start + 1);
 }
 
-std::vector<std::string> SplitTokens(const std::string& value) {
-    std::istringstream iss(value);
-    std::vector<std::string> tokens;
-    std::string token;
-    while (iss >> token) {
-        tokens.push_back(token);
-    }
-    return tokens;
+bool IsSpace(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
 }
 
-std::string NormalizeFen(const std::string& fen) {
-    auto tokens = SplitTokens(fen);
-    if (tokens.size() == 4) {
-        tokens.push_back("0");
-        tokens.push_back("1");
-    } else if (tokens.size() == 5) {
-        tokens.push_back("1");
-    } else if (tokens.size() > 6) {
-        tokens.resize(6);
-    }
-    std::ostringstream out;
-    for (size_t i = 0; i < tokens.size(); ++i) {
-        if (i > 0) {
-            out << ' ';
+// Same tokens as reading the text through std::istringstream, without the copies.
+template <typename Fn>
+void ForEachToken(std::string_view value, Fn&& fn) {
+    size_t pos = 0;
+    while (pos < value.size()) {
+        while (pos < value.size() && IsSpace(value[pos])) {
+            ++pos;
+        }
+        const size_t start = pos;
+        while (pos < value.size() && !IsSpace(value[pos])) {
+            ++pos;
+        }
+        if (pos > start && !fn(value.substr(start, pos - start))) {
+            return;
         }
-        out << tokens[i];
     }
-    return out.str();
-}
-
-std::string HashLine(const std::string& line) {
-    const std::hash<std::string> hasher;
-    return std::to_string(hasher(line));
 }
 
-void ParseOperations(const std::string& line, Opening& opening) {
+void ParseOperations(std::string_view line, Opening& opening) {
     size_t start = line.find(';');
-    if (start == std::string::npos) {
-        return;
-    }
-    while (start != std::string::npos) {
-        size_t end = line.find(';', start + 1);
-        std::string op = (end == std::string::npos) ? line.substr(start + 1)
-                                                    : line.substr(start + 1, end - start - 1);
-        op = Trim(op);
-        if (op.rfind("id", 0) == 0) {
+    while (start != std::string_view::npos) {
+        const size_t end = line.find(';', start + 1);
+        const auto op = Trim(end == std::string_view::npos ? line.substr(start + 1)
+                                                           : line.substr(start + 1, end - start - 1));
+        if (op.substr(0, 2) == "id") {
             const auto first_quote = op.find('"');
             const auto last_quote = op.find_last_of('"');
-            if (first_quote != std::string::npos && last_quote != std::string::npos &&
+            if (first_quote != std::string_view::npos && last_quote != std::string_view::npos &&
                 last_quote > first_quote) {
-                opening.id = op.substr(first_quote + 1, last_quote - first_quote - 1);
+                opening.id = std::string(op.substr(first_quote + 1, last_quote - first_quote - 1));
             }
-        } else if (op.rfind("moves", 0) == 0) {
-            auto tokens = SplitTokens(op.substr(5));
-            opening.moves.insert(opening.moves.end(), tokens.begin(), tokens.end());
+        } else if (op.substr(0, 5) == "moves") {
+            ForEachToken(op.substr(5), [&](std::string_view token) {
+                opening.moves.emplace_back(token);
+                return true;
+            });
         }
         start = end;
     }
 }
 
-}  // namespace
-
-std::vector<Opening> EpdParser::LoadFile(const std::string& path) {
-    std::vector<Opening> openings;
-    std::ifstream file(path);
-    if (!file) {
-        return openings;
+bool ParseTrimmedLine(std::string_view line, Opening& opening) {
+    if (line.empty() || line[0] == '#' || line[0] == ';') {
+        return false;
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-        line = Trim(line);
-        if (line.empty()) {
-            continue;
-        }
-        if (line[0] == '#' || line[0] == ';') {
-            continue;
+    // The FEN is the first six fields before any operation; four-field EPD
+    // positions get default move counters.
+    const size_t sep = line.find(';');
+    const auto fen_part = sep == std::string_view::npos ? line : line.substr(0, sep);
+    std::string fen;
+    fen.reserve(fen_part.size() + 4);
+    int fields = 0;
+    ForEachToken(fen_part, [&](std::string_view token) {
+        if (fields > 0) {
+            fen += ' ';
         }
+        fen.append(token.data(), token.size());
+        return ++fields < 6;
+    });
+    if (fields < 4) {
+        return false;
+    }
+    if (fields == 4) {
+        fen += " 0 1";
+    } else if (fields == 5) {
+        fen += " 1";
+    }
 
-        const size_t sep = line.find(';');
-        const std::string fen_part = (sep == std::string::npos) ? line : line.substr(0, sep);
-        const auto fen_tokens = SplitTokens(fen_part);
-        if (fen_tokens.size() < 4) {
-            continue;
-        }
+    opening.fen = std::move(fen);
+    ParseOperations(line, opening);
+    if (opening.id.empty()) {
+        // std::hash of a string_view equals that of the equivalent std::string,
+        // which keeps ids stable across loaders.
+        opening.id = std::to_string(std::hash<std::string_view>{}(line));
+    }
+    return true;
+}
 
-        std::ostringstream fen_out;
-        const size_t fen_fields = std::min(static_cast<size_t>(6), fen_tokens.size());
-        for (size_t i = 0; i < fen_fields; ++i) {
-            if (i > 0) {
-                fen_out << ' ';
-            }
-            fen_out << fen_tokens[i];
+// Spans are relative to base, the start of the whole text.
+void ParseChunk(std::string_view text,
+                const char* base,
+                std::vector<Opening>* openings,
+                std::vector<OpeningSpan>* spans) {
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = text.size();
         }
-
         Opening opening;
-        opening.fen = NormalizeFen(fen_out.str());
-        ParseOperations(line, opening);
-        if (opening.id.empty()) {
-            opening.id = HashLine(line);
+        if (ParseTrimmedLine(Trim(text.substr(pos, end - pos)), opening)) {
+            if (openings) {
+                openings->push_back(std::move(opening));
+            }
+            if (spans) {
+                const auto offset = static_cast<std::uint64_t>(text.data() - base);
+                spans->push_back({offset + pos, offset + end});
+            }
         }
-        openings.push_back(std::move(opening));
+        pos = end + 1;
+    }
+}
+
+size_t NextLine(std::string_view text, size_t pos) {
+    if (pos == 0 || text[pos - 1] == '\n') {
+        return pos;
+    }
+    const auto end = text.find('\n', pos);
+    return end == std::string_view::npos ? text.size() : end + 1;
+}
+
+size_t WorkerCount(int threads) {
+    return threads > 0 ? static_cast<size_t>(threads) : std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+std::vector<Opening> EpdParser::LoadFile(const std::string& path, int threads) {
+    ijccrl::core::util::MappedFile file;
+    if (!file.Open(path)) {
+        return {};
     }
+    const auto text = file.view();
+    const auto chunks = ijccrl::core::util::SplitChunks(text, WorkerCount(threads), kMinChunkBytes, NextLine);
+    return ijccrl::core::util::ParseChunks<Opening>(chunks, [&](std::string_view chunk) {
+        std::vector<Opening> openings;
+        ParseChunk(chunk, text.data(), &openings, nullptr);
+        return openings;
+    });
+}
+
+std::vector<OpeningSpan> EpdParser::IndexText(std::string_view text, int threads) {
+    const auto chunks = ijccrl::core::util::SplitChunks(text, WorkerCount(threads), kMinChunkBytes, NextLine);
+    return ijccrl::core::util::ParseChunks<OpeningSpan>(chunks, [&](std::string_view chunk) {
+        std::vector<OpeningSpan> spans;
+        ParseChunk(chunk, text.data(), nullptr, &spans);
+        return spans;
+    });
+}
 
-    return openings;
+bool EpdParser::ParseLine(std::string_view line, Opening& opening) {
+    return ParseTrimmedLine(Trim(line), opening);
 }
 
 }  // namespace ijccrl::core::openings
@@ -30,8 +30,18 @@ std::vector<Opening> OpeningPolicy::AssignRoundRobin(
     return assigned;
 }
 
+Opening OpeningPolicy::AssignRoundRobinForIndex(int fixture_index,
+                                                const OpeningSource& openings,
+                                                int games_per_pairing) {
+    if (openings.empty()) {
+        return Opening{};
+    }
+    const int pairing_index = fixture_index / std::max(1, games_per_pairing);
+    return openings.Draw(static_cast<std::uint64_t>(pairing_index));
+}
+
 Opening OpeningPolicy::AssignSwissForIndex(int global_game_index,
-                                           const std::vector<Opening>& openings,
+                                           const OpeningSource& openings,
                                            int games_per_pairing) {
     if (openings.empty()) {
         return Opening{};
@@ -39,8 +49,7 @@ Opening OpeningPolicy::AssignSwissForIndex(int global_game_index,
     const int pairing_index = games_per_pairing <= 0
                                   ? global_game_index
                                   : (global_game_index / games_per_pairing);
-    const size_t opening_index = static_cast<size_t>(pairing_index) % openings.size();
-    return openings[opening_index];
+    return openings.Draw(static_cast<std::uint64_t>(pairing_index));
 }
 
 }  // namespace ijccrl::core::openings
@@ -0,0 +1,332 @@
+#include "ijccrl/core/openings/OpeningSource.h"
+
+#include "ijccrl/core/openings/EpdParser.h"
+#include "ijccrl/core/openings/PgnSuite.h"
+#include "ijccrl/core/openings/PolyglotBook.h"
+#include "ijccrl/core/rules/Termination.h"
+#include "ijccrl/core/util/AtomicFileWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
+
+namespace ijccrl::core::openings {
+
+namespace {
+
+constexpr char kIndexMagic[8] = {'I', 'J', 'O', 'P', 'I', 'D', 'X', '2'};
+
+struct IndexHeader {
+    char magic[8];
+    std::uint32_t byte_order = 0x01020304u;
+    std::uint32_t pgn = 0;
+    std::uint32_t dedupe = 0;
+    std::uint32_t reserved = 0;
+    std::uint64_t suite_size = 0;
+    std::int64_t suite_mtime = 0;
+    std::uint64_t count = 0;
+    std::uint64_t duplicates = 0;
+};
+
+IndexHeader DescribeSuite(const std::string& path, bool pgn, bool dedupe, size_t size) {
+    IndexHeader header{};
+    std::memcpy(header.magic, kIndexMagic, sizeof(kIndexMagic));
+    header.byte_order = 0x01020304u;
+    header.pgn = pgn ? 1u : 0u;
+    header.dedupe = dedupe ? 1u : 0u;
+    header.suite_size = size;
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (!ec) {
+        header.suite_mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+    }
+    return header;
+}
+
+bool SameSuite(const IndexHeader& a, const IndexHeader& b) {
+    return std::memcmp(a.magic, b.magic, sizeof(a.magic)) == 0 && a.byte_order == b.byte_order &&
+           a.pgn == b.pgn && a.dedupe == b.dedupe && a.suite_size == b.suite_size && a.suite_mtime == b.suite_mtime;
+}
+
+Opening Decode(std::string_view text, bool pgn) {
+    Opening opening;
+    if (pgn) {
+        PgnSuite::ParseGame(text, opening);
+    } else {
+        EpdParser::ParseLine(text, opening);
+    }
+    return opening;
+}
+
+std::uint64_t HashRecord(std::string_view suite, const OpeningSpan& span, bool pgn) {
+    const auto opening = Decode(suite.substr(static_cast<size_t>(span.begin), static_cast<size_t>(span.end - span.begin)), pgn);
+    return ijccrl::core::rules::CanonicalPositionHash(opening.fen, opening.moves);
+}
+
+// Keeps the first record of every position, in file order. Hashing runs on all cores.
+size_t RemoveDuplicates(std::string_view suite, bool pgn, std::vector<OpeningSpan>& spans) {
+    std::vector<std::uint64_t> hashes(spans.size());
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < workers; ++w) {
+        threads.emplace_back([&, w]() {
+            for (size_t i = w; i < spans.size(); i += workers) {
+                hashes[i] = HashRecord(suite, spans[i], pgn);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::unordered_set<std::uint64_t> seen;
+    seen.reserve(spans.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < spans.size(); ++i) {
+        if (seen.insert(hashes[i]).second) {
+            spans[kept++] = spans[i];
+        }
+    }
+    const size_t removed = spans.size() - kept;
+    spans.resize(kept);
+    return removed;
+}
+
+std::uint64_t Mix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Bijection on [0, size) built from a 4-round balanced Feistel network on the
+// smallest even bit width covering size; out-of-range outputs are fed back in
+// (cycle walking), which terminates because the network is a permutation and
+// takes fewer than four steps on average.
+std::uint64_t PermuteIndex(std::uint64_t index, std::uint64_t size, std::uint64_t key) {
+    int half_bits = 1;
+    while (half_bits < 32 && (std::uint64_t{1} << (2 * half_bits)) < size) {
+        ++half_bits;
+    }
+    const std::uint64_t mask = (std::uint64_t{1} << half_bits) - 1;
+    std::uint64_t value = index;
+    do {
+        std::uint64_t left = value >> half_bits;
+        std::uint64_t right = value & mask;
+        for (std::uint64_t round = 0; round < 4; ++round) {
+            const std::uint64_t next = left ^ (Mix(key ^ Mix(right + (round << 32))) & mask);
+            left = right;
+            right = next;
+        }
+        value = (left << half_bits) | right;
+    } while (value >= size);
+    return value;
+}
+
+std::string PositionId(const Opening& opening) {
+    char id[24];
+    std::snprintf(id,
+                  sizeof(id),
+                  "pos:%016llx",
+                  static_cast<unsigned long long>(
+                      ijccrl::core::rules::CanonicalPositionHash(opening.fen, opening.moves)));
+    return id;
+}
+
+}  // namespace
+
+std::string OpeningSource::IndexPath(const std::string& suite_path) {
+    return suite_path + ".idx";
+}
+
+bool OpeningSource::Open(const std::string& path,
+                         const std::string& type,
+                         const Options& options,
+                         std::string* error) {
+    pgn_ = type == "pgn";
+    position_ids_ = options.position_ids;
+    duplicates_removed_ = 0;
+    spans_ = nullptr;
+    span_count_ = 0;
+    built_spans_.clear();
+    order_.clear();
+    permuted_ = false;
+    kept_.clear();
+    filtered_ = false;
+    if (type == "polyglot") {
+        return OpenBook(path, options, error);
+    }
+    if (!suite_.Open(path)) {
+        if (error) {
+            *error = "Failed to open opening suite " + path;
+        }
+        return false;
+    }
+
+    const auto text = suite_.view();
+    const auto expected = DescribeSuite(path, pgn_, options.dedupe, text.size());
+    const std::string index_path = IndexPath(path);
+    if (index_.Open(index_path)) {
+        const auto index = index_.view();
+        IndexHeader header{};
+        if (index.size() >= sizeof(header)) {
+            std::memcpy(&header, index.data(), sizeof(header));
+            if (SameSuite(header, expected) &&
+                index.size() == sizeof(header) + header.count * sizeof(OpeningSpan)) {
+                spans_ = index.data() + sizeof(header);
+                span_count_ = static_cast<size_t>(header.count);
+                duplicates_removed_ = static_cast<size_t>(header.duplicates);
+                return true;
+            }
+        }
+    }
+
+    built_spans_ = pgn_ ? PgnSuite::IndexText(text) : EpdParser::IndexText(text);
+    if (options.dedupe) {
+        duplicates_removed_ = RemoveDuplicates(text, pgn_, built_spans_);
+    }
+    auto header = expected;
+    header.count = built_spans_.size();
+    header.duplicates = duplicates_removed_;
+    std::string contents(sizeof(header) + built_spans_.size() * sizeof(OpeningSpan), '\0');
+    std::memcpy(contents.data(), &header, sizeof(header));
+    if (!built_spans_.empty()) {
+        std::memcpy(contents.data() + sizeof(header), built_spans_.data(), built_spans_.size() * sizeof(OpeningSpan));
+    }
+    index_.Close();
+    // A read-only suite directory only costs the cache; the spans stay in memory.
+    if (ijccrl::core::util::AtomicFileWriter::Write(index_path, contents) && index_.Open(index_path) &&
+        index_.view().size() == contents.size()) {
+        built_spans_.clear();
+        built_spans_.shrink_to_fit();
+        spans_ = index_.view().data() + sizeof(header);
+    } else {
+        spans_ = reinterpret_cast<const char*>(built_spans_.data());
+    }
+    span_count_ = static_cast<size_t>(header.count);
+    return true;
+}
+
+bool OpeningSource::OpenBook(const std::string& path, const Options& options, std::string* error) {
+    PolyglotBook book;
+    if (!book.Open(path, error)) {
+        return false;
+    }
+    // Duplicate lines are redrawn, up to a bound for books with few distinct lines.
+    const std::uint64_t max_draws = options.dedupe ? options.book_lines * 8 : options.book_lines;
+    std::vector<Opening> openings;
+    openings.reserve(options.book_lines);
+    std::unordered_set<std::uint64_t> seen;
+    std::uint64_t draw = 0;
+    for (; draw < max_draws && openings.size() < options.book_lines; ++draw) {
+        auto opening = book.Line(draw, options.book_depth, options.book_seed);
+        if (opening.moves.empty()) {
+            break;
+        }
+        if (options.dedupe &&
+            !seen.insert(ijccrl::core::rules::CanonicalPositionHash(opening.fen, opening.moves)).second) {
+            continue;
+        }
+        opening.id = position_ids_ ? PositionId(opening) : "book:" + std::to_string(draw);
+        openings.push_back(std::move(opening));
+    }
+    if (openings.empty()) {
+        if (error) {
+            *error = "Opening book has no moves for the start position: " + path;
+        }
+        return false;
+    }
+    duplicates_removed_ = static_cast<size_t>(draw) - openings.size();
+    memory_ = std::move(openings);
+    return true;
+}
+
+void OpeningSource::Assign(std::vector<Opening> openings) {
+    spans_ = nullptr;
+    span_count_ = 0;
+    built_spans_.clear();
+    order_.clear();
+    permuted_ = false;
+    kept_.clear();
+    filtered_ = false;
+    memory_ = std::move(openings);
+}
+
+void OpeningSource::Permute(std::uint64_t seed) {
+    order_.clear();
+    permuted_ = true;
+    permute_seed_ = seed;
+}
+
+void OpeningSource::Shuffle(std::uint32_t seed) {
+    permuted_ = false;
+    order_.resize(size());
+    std::iota(order_.begin(), order_.end(), 0u);
+    std::mt19937 rng(seed);
+    std::shuffle(order_.begin(), order_.end(), rng);
+}
+
+size_t OpeningSource::Exclude(const std::function<bool(const Opening&)>& drop) {
+    order_.clear();
+    kept_.clear();
+    filtered_ = false;
+    const size_t count = RecordCount();
+    std::vector<std::uint32_t> kept;
+    kept.reserve(count);
+    for (size_t record = 0; record < count; ++record) {
+        if (!drop(Record(record))) {
+            kept.push_back(static_cast<std::uint32_t>(record));
+        }
+    }
+    if (kept.empty() || kept.size() == count) {
+        return 0;
+    }
+    kept_ = std::move(kept);
+    filtered_ = true;
+    return count - kept_.size();
+}
+
+size_t OpeningSource::size() const {
+    return filtered_ ? kept_.size() : RecordCount();
+}
+
+Opening OpeningSource::At(size_t index) const {
+    const size_t slot = order_.empty() ? index : order_[index];
+    return Record(filtered_ ? kept_[slot] : slot);
+}
+
+Opening OpeningSource::Record(size_t record) const {
+    if (!spans_) {
+        return memory_[record];
+    }
+    const auto span = SpanAt(record);
+    auto opening = Decode(suite_.view().substr(static_cast<size_t>(span.begin),
+                                               static_cast<size_t>(span.end - span.begin)),
+                          pgn_);
+    if (position_ids_) {
+        opening.id = PositionId(opening);
+    }
+    return opening;
+}
+
+Opening OpeningSource::Draw(std::uint64_t n) const {
+    const std::uint64_t count = size();
+    if (!permuted_) {
+        return At(static_cast<size_t>(n % count));
+    }
+    const std::uint64_t pass = n / count;
+    return At(static_cast<size_t>(PermuteIndex(n % count, count, Mix(permute_seed_ ^ Mix(pass)))));
+}
+
+OpeningSpan OpeningSource::SpanAt(size_t record) const {
+    OpeningSpan span;
+    std::memcpy(&span, spans_ + record * sizeof(OpeningSpan), sizeof(span));
+    return span;
+}
+
+}  // namespace ijccrl::core::openings
@@ -1,141 +1,232 @@
 #include "ijccrl/core/openings/PgnSuite.h"
 
+#include "ijccrl/core/util/MappedFile.h"
+
+#include <algorithm>
 #include <cctype>
-#include <fstream>
 #include <functional>
 #include <map>
-#include <sstream>
+#include <string_view>
+#include <thread>
 
 namespace ijccrl::core::openings {
 
 namespace {
 
-std::string Trim(const std::string& value) {
+constexpr size_t kMinChunkBytes = 1 << 20;
+
+std::string_view Trim(std::string_view value) {
     const auto start = value.find_first_not_of(" \t\r\n");
-    if (start == std::string::npos) {
+    if (start == std::string_view::npos) {
         return {};
     }
     const auto end = value.find_last_not_of(" \t\r\n");
     return value.substr(start, end - start + 1);
 }
 
-std::vector<std::string> SplitTokens(const std::string& value) {
-    std::istringstream iss(value);
-    std::vector<std::string> tokens;
-    std::string token;
-    while (iss >> token) {
-        tokens.push_back(token);
+bool IsSpace(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+template <typename Fn>
+void ForEachToken(std::string_view value, Fn&& fn) {
+    size_t pos = 0;
+    while (pos < value.size()) {
+        while (pos < value.size() && IsSpace(value[pos])) {
+            ++pos;
+        }
+        const size_t start = pos;
+        while (pos < value.size() && !IsSpace(value[pos])) {
+            ++pos;
+        }
+        if (pos > start) {
+            fn(value.substr(start, pos - start));
+        }
     }
-    return tokens;
 }
 
-std::string NormalizeFen(const std::string& fen) {
-    auto tokens = SplitTokens(fen);
-    if (tokens.size() == 4) {
-        tokens.push_back("0");
-        tokens.push_back("1");
-    } else if (tokens.size() == 5) {
-        tokens.push_back("1");
-    } else if (tokens.size() > 6) {
+std::string NormalizeFen(std::string_view fen) {
+    std::vector<std::string_view> tokens;
+    ForEachToken(fen, [&](std::string_view token) { tokens.push_back(token); });
+    if (tokens.size() > 6) {
         tokens.resize(6);
     }
-    std::ostringstream out;
+    std::string out;
     for (size_t i = 0; i < tokens.size(); ++i) {
         if (i > 0) {
-            out << ' ';
+            out += ' ';
         }
-        out << tokens[i];
+        out.append(tokens[i].data(), tokens[i].size());
     }
-    return out.str();
-}
-
-std::string HashText(const std::string& text) {
-    const std::hash<std::string> hasher;
-    return std::to_string(hasher(text));
+    if (tokens.size() == 4) {
+        out += " 0 1";
+    } else if (tokens.size() == 5) {
+        out += " 1";
+    }
+    return out;
 }
 
-bool IsResultToken(const std::string& token) {
+bool IsResultToken(std::string_view token) {
     return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
 }
 
-std::vector<std::string> ParseMoves(const std::string& movetext) {
+std::vector<std::string> ParseMoves(std::string_view movetext) {
     std::vector<std::string> moves;
-    auto tokens = SplitTokens(movetext);
-    for (auto& token : tokens) {
-        if (IsResultToken(token)) {
-            continue;
-        }
-        if (token.find('.') != std::string::npos) {
-            continue;
+    ForEachToken(movetext, [&](std::string_view token) {
+        if (IsResultToken(token) || token.find('.') != std::string_view::npos) {
+            return;
         }
-        moves.push_back(token);
-    }
+        moves.emplace_back(token);
+    });
     return moves;
 }
 
-}  // namespace
-
-std::vector<Opening> PgnSuite::LoadFile(const std::string& path) {
-    std::vector<Opening> openings;
-    std::ifstream file(path);
-    if (!file) {
-        return openings;
-    }
-
-    std::map<std::string, std::string> tags;
-    std::ostringstream movetext;
-    std::string line;
-
-    auto flush_game = [&]() {
-        if (tags.empty() && movetext.str().empty()) {
+// Each line is trimmed; movetext lines are joined with a trailing space, which
+// is also what the fallback id hashes. A blank line after movetext ends a game.
+// Spans run from a game's first line to the line that ends it and are relative
+// to base, the start of the whole text.
+void ParseChunk(std::string_view text,
+                const char* base,
+                std::vector<Opening>* openings,
+                std::vector<OpeningSpan>* spans) {
+    std::map<std::string, std::string, std::less<>> tags;
+    std::string movetext;
+    const auto offset = static_cast<std::uint64_t>(text.data() - base);
+    size_t game_begin = 0;
+
+    auto flush_game = [&](size_t game_end) {
+        if (tags.empty() && movetext.empty()) {
             return;
         }
-        Opening opening;
-        const auto setup_it = tags.find("SetUp");
-        const auto fen_it = tags.find("FEN");
-        if (setup_it != tags.end() && setup_it->second == "1" && fen_it != tags.end()) {
-            opening.fen = NormalizeFen(fen_it->second);
-        }
-        opening.moves = ParseMoves(movetext.str());
-        const auto event_it = tags.find("Event");
-        const auto round_it = tags.find("Round");
-        if (event_it != tags.end() && round_it != tags.end()) {
-            opening.id = event_it->second + " " + round_it->second;
+        if (openings) {
+            Opening opening;
+            const auto setup_it = tags.find("SetUp");
+            const auto fen_it = tags.find("FEN");
+            if (setup_it != tags.end() && setup_it->second == "1" && fen_it != tags.end()) {
+                opening.fen = NormalizeFen(fen_it->second);
+            }
+            opening.moves = ParseMoves(movetext);
+            const auto event_it = tags.find("Event");
+            const auto round_it = tags.find("Round");
+            if (event_it != tags.end() && round_it != tags.end()) {
+                opening.id = event_it->second + " " + round_it->second;
+            }
+            if (opening.id.empty()) {
+                opening.id = std::to_string(std::hash<std::string>{}(movetext));
+            }
+            openings->push_back(std::move(opening));
         }
-        if (opening.id.empty()) {
-            opening.id = HashText(movetext.str());
+        if (spans) {
+            spans->push_back({offset + game_begin, offset + game_end});
         }
-        openings.push_back(std::move(opening));
         tags.clear();
-        movetext.str(std::string());
         movetext.clear();
     };
 
-    while (std::getline(file, line)) {
-        line = Trim(line);
+    size_t pos = 0;
+    while (pos < text.size()) {
+        const size_t line_start = pos;
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        const auto line = Trim(text.substr(pos, end - pos));
+        pos = end + 1;
         if (line.empty()) {
-            if (!movetext.str().empty()) {
-                flush_game();
+            if (!movetext.empty()) {
+                flush_game(line_start);
             }
             continue;
         }
-        if (!line.empty() && line.front() == '[') {
+        if (tags.empty() && movetext.empty()) {
+            game_begin = line_start;
+        }
+        if (line.front() == '[') {
             const auto space_pos = line.find(' ');
             const auto quote_pos = line.find('"');
             const auto last_quote = line.find_last_of('"');
-            if (space_pos != std::string::npos && quote_pos != std::string::npos &&
-                last_quote != std::string::npos && last_quote > quote_pos) {
-                const std::string key = line.substr(1, space_pos - 1);
-                const std::string value = line.substr(quote_pos + 1, last_quote - quote_pos - 1);
-                tags[key] = value;
+            if (space_pos != std::string_view::npos && quote_pos != std::string_view::npos &&
+                last_quote != std::string_view::npos && last_quote > quote_pos) {
+                tags[std::string(line.substr(1, space_pos - 1))] =
+                    std::string(line.substr(quote_pos + 1, last_quote - quote_pos - 1));
             }
             continue;
         }
-        movetext << line << ' ';
+        movetext.append(line.data(), line.size());
+        movetext += ' ';
+    }
+
+    flush_game(text.size());
+}
+
+// A game boundary is a non-blank line that follows a blank line which itself
+// follows movetext: the parser has just flushed and holds no state there.
+size_t NextGame(std::string_view text, size_t pos) {
+    if (pos == 0) {
+        return 0;
+    }
+    size_t line_start = text.rfind('\n', pos - 1);
+    line_start = line_start == std::string_view::npos ? 0 : line_start + 1;
+    bool blank_after_movetext = false;
+    bool last_was_movetext = false;
+    while (line_start < text.size()) {
+        size_t end = text.find('\n', line_start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        const auto line = Trim(text.substr(line_start, end - line_start));
+        if (line.empty()) {
+            blank_after_movetext = blank_after_movetext || last_was_movetext;
+            last_was_movetext = false;
+        } else {
+            if (blank_after_movetext && line_start >= pos) {
+                return line_start;
+            }
+            blank_after_movetext = false;
+            last_was_movetext = line.front() != '[';
+        }
+        line_start = end + 1;
     }
+    return text.size();
+}
 
-    flush_game();
-    return openings;
+size_t WorkerCount(int threads) {
+    return threads > 0 ? static_cast<size_t>(threads) : std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+std::vector<Opening> PgnSuite::LoadFile(const std::string& path, int threads) {
+    ijccrl::core::util::MappedFile file;
+    if (!file.Open(path)) {
+        return {};
+    }
+    const auto text = file.view();
+    const auto chunks = ijccrl::core::util::SplitChunks(text, WorkerCount(threads), kMinChunkBytes, NextGame);
+    return ijccrl::core::util::ParseChunks<Opening>(chunks, [&](std::string_view chunk) {
+        std::vector<Opening> openings;
+        ParseChunk(chunk, text.data(), &openings, nullptr);
+        return openings;
+    });
+}
+
+std::vector<OpeningSpan> PgnSuite::IndexText(std::string_view text, int threads) {
+    const auto chunks = ijccrl::core::util::SplitChunks(text, WorkerCount(threads), kMinChunkBytes, NextGame);
+    return ijccrl::core::util::ParseChunks<OpeningSpan>(chunks, [&](std::string_view chunk) {
+        std::vector<OpeningSpan> spans;
+        ParseChunk(chunk, text.data(), nullptr, &spans);
+        return spans;
+    });
+}
+
+bool PgnSuite::ParseGame(std::string_view text, Opening& opening) {
+    std::vector<Opening> openings;
+    ParseChunk(text, text.data(), &openings, nullptr);
+    if (openings.empty()) {
+        return false;
+    }
+    opening = std::move(openings.front());
+    return true;
 }
 
 }  // namespace ijccrl::core::openings
@@ -0,0 +1,606 @@
+#include "ijccrl/core/persist/CheckpointState.h"
+
+#include <cstring>
+#include <exception>
+#include <unordered_map>
+
+namespace ijccrl::core::persist {
+
+namespace {
+
+constexpr char kMagic[8] = {'I', 'J', 'C', 'K', 'P', 'T', 0x1a, 0x00};
+constexpr std::uint32_t kFormatVersion = 2;
+
+enum SectionTag : std::uint8_t {
+    kHeader = 1,
+    kStrings = 2,
+    kCompletedFixtures = 3,
+    kCompletedGames = 4,
+    kStandings = 5,
+    kActiveGames = 6,
+    kNextGame = 7,
+    kSwiss = 8,
+    kExcludedOpenings = 9,
+};
+
+class Encoder {
+public:
+    void PutVarint(std::uint64_t value) {
+        while (value >= 0x80) {
+            out_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out_.push_back(static_cast<char>(value));
+    }
+
+    void PutSigned(long long value) {
+        const auto raw = static_cast<std::uint64_t>(value);
+        PutVarint((raw << 1) ^ (value < 0 ? ~std::uint64_t{0} : 0));
+    }
+
+    void PutDouble(double value) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; ++i) {
+            out_.push_back(static_cast<char>((bits >> (8 * i)) & 0xff));
+        }
+    }
+
+    void PutBytes(const std::string& value) {
+        PutVarint(value.size());
+        out_.append(value);
+    }
+
+    std::string& data() { return out_; }
+
+private:
+    std::string out_;
+};
+
+class Decoder {
+public:
+    Decoder(const char* data, std::size_t size) : data_(data), size_(size) {}
+
+    bool GetVarint(std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos_ >= size_) {
+                return false;
+            }
+            const auto byte = static_cast<unsigned char>(data_[pos_++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool GetSigned(long long& value) {
+        std::uint64_t raw = 0;
+        if (!GetVarint(raw)) {
+            return false;
+        }
+        value = static_cast<long long>((raw >> 1) ^ (~(raw & 1) + 1));
+        return true;
+    }
+
+    bool GetInt(int& value) {
+        long long wide = 0;
+        if (!GetSigned(wide)) {
+            return false;
+        }
+        value = static_cast<int>(wide);
+        return true;
+    }
+
+    bool GetDouble(double& value) {
+        if (size_ - pos_ < 8) {
+            return false;
+        }
+        std::uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i) {
+            bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(data_[pos_ + i])) << (8 * i);
+        }
+        pos_ += 8;
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    bool GetBytes(std::string& value) {
+        std::uint64_t length = 0;
+        if (!GetVarint(length) || length > size_ - pos_) {
+            return false;
+        }
+        value.assign(data_ + pos_, static_cast<std::size_t>(length));
+        pos_ += static_cast<std::size_t>(length);
+        return true;
+    }
+
+    bool Skip(std::size_t length) {
+        if (length > size_ - pos_) {
+            return false;
+        }
+        pos_ += length;
+        return true;
+    }
+
+    bool done() const { return pos_ >= size_; }
+    std::size_t remaining() const { return size_ - pos_; }
+    std::size_t pos() const { return pos_; }
+    const char* data() const { return data_; }
+
+private:
+    const char* data_;
+    std::size_t size_;
+    std::size_t pos_ = 0;
+};
+
+class StringInterner {
+public:
+    std::uint64_t Intern(const std::string& value) {
+        const auto [it, inserted] = ids_.emplace(value, strings_.size());
+        if (inserted) {
+            strings_.push_back(value);
+        }
+        return it->second;
+    }
+
+    const std::vector<std::string>& strings() const { return strings_; }
+
+private:
+    std::unordered_map<std::string, std::uint64_t> ids_;
+    std::vector<std::string> strings_;
+};
+
+class StringTable {
+public:
+    bool Load(Decoder& decoder) {
+        std::uint64_t count = 0;
+        if (!decoder.GetVarint(count) || count > decoder.remaining()) {
+            return false;
+        }
+        strings_.clear();
+        strings_.reserve(static_cast<std::size_t>(count));
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::string value;
+            if (!decoder.GetBytes(value)) {
+                return false;
+            }
+            strings_.push_back(std::move(value));
+        }
+        return true;
+    }
+
+    bool Get(Decoder& decoder, std::string& value) const {
+        std::uint64_t id = 0;
+        if (!decoder.GetVarint(id) || id >= strings_.size()) {
+            return false;
+        }
+        value = strings_[static_cast<std::size_t>(id)];
+        return true;
+    }
+
+private:
+    std::vector<std::string> strings_;
+};
+
+void PutSection(std::string& out, SectionTag tag, Encoder& section) {
+    Encoder header;
+    header.data().push_back(static_cast<char>(tag));
+    header.PutVarint(section.data().size());
+    out.append(header.data());
+    out.append(section.data());
+}
+
+bool DecodeHeader(Decoder& in, CheckpointState& state) {
+    long long rng_seed = 0;
+    long long journal_seq = 0;
+    if (!in.GetInt(state.version) || !in.GetBytes(state.config_hash) || !in.GetInt(state.total_games) ||
+        !in.GetInt(state.next_fixture_index) || !in.GetInt(state.opening_index) ||
+        !in.GetSigned(rng_seed) || !in.GetInt(state.last_game_no) ||
+        !in.GetBytes(state.last_game_end_time) || !in.GetSigned(journal_seq)) {
+        return false;
+    }
+    state.rng_seed = static_cast<std::uint64_t>(rng_seed);
+    state.journal_seq = static_cast<std::uint64_t>(journal_seq);
+    return true;
+}
+
+bool DecodeIntList(Decoder& in, std::vector<int>& values) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count) || count > in.remaining()) {
+        return false;
+    }
+    values.clear();
+    values.reserve(static_cast<std::size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        int value = 0;
+        if (!in.GetInt(value)) {
+            return false;
+        }
+        values.push_back(value);
+    }
+    return true;
+}
+
+void EncodeIntList(Encoder& out, const std::vector<int>& values) {
+    out.PutVarint(values.size());
+    for (int value : values) {
+        out.PutSigned(value);
+    }
+}
+
+bool DecodeCompletedGames(Decoder& in, const StringTable& strings, CheckpointState& state) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count) || count > in.remaining()) {
+        return false;
+    }
+    state.completed_games.clear();
+    state.completed_games.reserve(static_cast<std::size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        CompletedGameMeta game;
+        if (!in.GetInt(game.game_no) || !in.GetInt(game.fixture_index) || !strings.Get(in, game.white) ||
+            !strings.Get(in, game.black) || !strings.Get(in, game.opening_id) ||
+            !strings.Get(in, game.result) || !strings.Get(in, game.termination) ||
+            !in.GetSigned(game.pgn_offset) || !strings.Get(in, game.pgn_path)) {
+            return false;
+        }
+        state.completed_games.push_back(std::move(game));
+    }
+    return true;
+}
+
+bool DecodeStandings(Decoder& in, const StringTable& strings, CheckpointState& state) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count)) {
+        return false;
+    }
+    state.standings.clear();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        StandingsSnapshot row;
+        if (!strings.Get(in, row.name) || !in.GetInt(row.games) || !in.GetInt(row.wins) ||
+            !in.GetInt(row.draws) || !in.GetInt(row.losses) || !in.GetDouble(row.points)) {
+            return false;
+        }
+        state.standings.push_back(std::move(row));
+    }
+    return true;
+}
+
+bool DecodeEval(Decoder& in, ijccrl::core::game::GameState::EvalInfo& eval) {
+    int has_cp = 0;
+    int has_mate = 0;
+    if (!in.GetInt(has_cp) || !in.GetInt(eval.cp) || !in.GetInt(has_mate) || !in.GetInt(eval.mate) ||
+        !in.GetInt(eval.depth)) {
+        return false;
+    }
+    eval.has_cp = has_cp != 0;
+    eval.has_mate = has_mate != 0;
+    return true;
+}
+
+void EncodeEval(Encoder& out, const ijccrl::core::game::GameState::EvalInfo& eval) {
+    out.PutSigned(eval.has_cp ? 1 : 0);
+    out.PutSigned(eval.cp);
+    out.PutSigned(eval.has_mate ? 1 : 0);
+    out.PutSigned(eval.mate);
+    out.PutSigned(eval.depth);
+}
+
+bool DecodeProgress(Decoder& in, const StringTable& strings, ijccrl::core::game::GameProgress& progress) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count) || count > in.remaining()) {
+        return false;
+    }
+    progress.moves_uci.resize(static_cast<std::size_t>(count));
+    for (auto& move : progress.moves_uci) {
+        if (!strings.Get(in, move)) {
+            return false;
+        }
+    }
+    return in.GetInt(progress.wtime_ms) && in.GetInt(progress.btime_ms) &&
+           in.GetInt(progress.draw_score_streak) && in.GetInt(progress.win_score_streak_white) &&
+           in.GetInt(progress.win_score_streak_black) && in.GetInt(progress.resign_streak_white) &&
+           in.GetInt(progress.resign_streak_black) && DecodeEval(in, progress.last_eval_white) &&
+           DecodeEval(in, progress.last_eval_black);
+}
+
+bool DecodeActiveGames(Decoder& in,
+                       const StringTable& strings,
+                       std::uint32_t format_version,
+                       CheckpointState& state) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count)) {
+        return false;
+    }
+    state.active_games.clear();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        ActiveGameMeta active;
+        if (!in.GetInt(active.game_no) || !in.GetInt(active.fixture_index) ||
+            !strings.Get(in, active.white) || !strings.Get(in, active.black) ||
+            !strings.Get(in, active.opening_id)) {
+            return false;
+        }
+        if (format_version >= 2 && !DecodeProgress(in, strings, active.progress)) {
+            return false;
+        }
+        state.active_games.push_back(std::move(active));
+    }
+    return true;
+}
+
+bool DecodeSwiss(Decoder& in, const StringTable& strings, CheckpointState& state) {
+    auto& swiss = state.swiss;
+    if (!in.GetInt(swiss.current_round) || !DecodeIntList(in, swiss.bye_history)) {
+        return false;
+    }
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count)) {
+        return false;
+    }
+    swiss.pairings_played.clear();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        CheckpointState::SwissPairing pairing;
+        if (!in.GetInt(pairing.white_engine_id) || !in.GetInt(pairing.black_engine_id)) {
+            return false;
+        }
+        swiss.pairings_played.push_back(pairing);
+    }
+    if (!in.GetVarint(count)) {
+        return false;
+    }
+    swiss.color_history.clear();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        CheckpointState::SwissColorSnapshot entry;
+        if (!in.GetInt(entry.last_color) || !in.GetInt(entry.streak)) {
+            return false;
+        }
+        swiss.color_history.push_back(entry);
+    }
+    if (!in.GetVarint(count)) {
+        return false;
+    }
+    swiss.pending_pairings_current_round.clear();
+    for (std::uint64_t i = 0; i < count; ++i) {
+        CheckpointState::SwissPendingFixture pending;
+        if (!in.GetInt(pending.fixture_index) || !in.GetInt(pending.fixture.round_index) ||
+            !in.GetInt(pending.fixture.white_engine_id) || !in.GetInt(pending.fixture.black_engine_id) ||
+            !in.GetInt(pending.fixture.game_index_within_pairing) ||
+            !strings.Get(in, pending.fixture.pairing_id)) {
+            return false;
+        }
+        swiss.pending_pairings_current_round.push_back(std::move(pending));
+    }
+    return true;
+}
+
+bool DecodeStringList(Decoder& in, const StringTable& strings, std::vector<std::string>& values) {
+    std::uint64_t count = 0;
+    if (!in.GetVarint(count) || count > in.remaining()) {
+        return false;
+    }
+    values.clear();
+    values.reserve(static_cast<std::size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        std::string value;
+        if (!strings.Get(in, value)) {
+            return false;
+        }
+        values.push_back(std::move(value));
+    }
+    return true;
+}
+
+}  // namespace
+
+bool IsBinaryCheckpoint(const std::string& data) {
+    return data.size() >= sizeof(kMagic) && std::memcmp(data.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+std::string EncodeCheckpointBinary(const CheckpointState& state) {
+    StringInterner strings;
+
+    Encoder header;
+    header.PutSigned(state.version);
+    header.PutBytes(state.config_hash);
+    header.PutSigned(state.total_games);
+    header.PutSigned(state.next_fixture_index);
+    header.PutSigned(state.opening_index);
+    header.PutSigned(static_cast<long long>(state.rng_seed));
+    header.PutSigned(state.last_game_no);
+    header.PutBytes(state.last_game_end_time);
+    header.PutSigned(static_cast<long long>(state.journal_seq));
+
+    Encoder fixtures;
+    EncodeIntList(fixtures, state.completed_fixture_indices);
+
+    Encoder games;
+    games.data().reserve(state.completed_games.size() * 12);
+    games.PutVarint(state.completed_games.size());
+    for (const auto& game : state.completed_games) {
+        games.PutSigned(game.game_no);
+        games.PutSigned(game.fixture_index);
+        games.PutVarint(strings.Intern(game.white));
+        games.PutVarint(strings.Intern(game.black));
+        games.PutVarint(strings.Intern(game.opening_id));
+        games.PutVarint(strings.Intern(game.result));
+        games.PutVarint(strings.Intern(game.termination));
+        games.PutSigned(game.pgn_offset);
+        games.PutVarint(strings.Intern(game.pgn_path));
+    }
+
+    Encoder standings;
+    standings.PutVarint(state.standings.size());
+    for (const auto& row : state.standings) {
+        standings.PutVarint(strings.Intern(row.name));
+        standings.PutSigned(row.games);
+        standings.PutSigned(row.wins);
+        standings.PutSigned(row.draws);
+        standings.PutSigned(row.losses);
+        standings.PutDouble(row.points);
+    }
+
+    Encoder active;
+    active.PutVarint(state.active_games.size());
+    for (const auto& game : state.active_games) {
+        active.PutSigned(game.game_no);
+        active.PutSigned(game.fixture_index);
+        active.PutVarint(strings.Intern(game.white));
+        active.PutVarint(strings.Intern(game.black));
+        active.PutVarint(strings.Intern(game.opening_id));
+        active.PutVarint(game.progress.moves_uci.size());
+        for (const auto& move : game.progress.moves_uci) {
+            active.PutVarint(strings.Intern(move));
+        }
+        active.PutSigned(game.progress.wtime_ms);
+        active.PutSigned(game.progress.btime_ms);
+        active.PutSigned(game.progress.draw_score_streak);
+        active.PutSigned(game.progress.win_score_streak_white);
+        active.PutSigned(game.progress.win_score_streak_black);
+        active.PutSigned(game.progress.resign_streak_white);
+        active.PutSigned(game.progress.resign_streak_black);
+        EncodeEval(active, game.progress.last_eval_white);
+        EncodeEval(active, game.progress.last_eval_black);
+    }
+
+    Encoder next_game;
+    next_game.PutSigned(state.next_game.fixture_index);
+    next_game.PutVarint(strings.Intern(state.next_game.white));
+    next_game.PutVarint(strings.Intern(state.next_game.black));
+    next_game.PutVarint(strings.Intern(state.next_game.opening_id));
+
+    Encoder swiss;
+    swiss.PutSigned(state.swiss.current_round);
+    EncodeIntList(swiss, state.swiss.bye_history);
+    swiss.PutVarint(state.swiss.pairings_played.size());
+    for (const auto& pairing : state.swiss.pairings_played) {
+        swiss.PutSigned(pairing.white_engine_id);
+        swiss.PutSigned(pairing.black_engine_id);
+    }
+    swiss.PutVarint(state.swiss.color_history.size());
+    for (const auto& entry : state.swiss.color_history) {
+        swiss.PutSigned(entry.last_color);
+        swiss.PutSigned(entry.streak);
+    }
+    swiss.PutVarint(state.swiss.pending_pairings_current_round.size());
+    for (const auto& pending : state.swiss.pending_pairings_current_round) {
+        swiss.PutSigned(pending.fixture_index);
+        swiss.PutSigned(pending.fixture.round_index);
+        swiss.PutSigned(pending.fixture.white_engine_id);
+        swiss.PutSigned(pending.fixture.black_engine_id);
+        swiss.PutSigned(pending.fixture.game_index_within_pairing);
+        swiss.PutVarint(strings.Intern(pending.fixture.pairing_id));
+    }
+
+    Encoder excluded;
+    excluded.PutVarint(state.excluded_openings.size());
+    for (const auto& opening_id : state.excluded_openings) {
+        excluded.PutVarint(strings.Intern(opening_id));
+    }
+
+    Encoder table;
+    table.PutVarint(strings.strings().size());
+    for (const auto& value : strings.strings()) {
+        table.PutBytes(value);
+    }
+
+    std::string out(kMagic, sizeof(kMagic));
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((kFormatVersion >> (8 * i)) & 0xff));
+    }
+    PutSection(out, kHeader, header);
+    PutSection(out, kStrings, table);
+    PutSection(out, kCompletedFixtures, fixtures);
+    PutSection(out, kCompletedGames, games);
+    PutSection(out, kStandings, standings);
+    PutSection(out, kActiveGames, active);
+    PutSection(out, kNextGame, next_game);
+    PutSection(out, kSwiss, swiss);
+    PutSection(out, kExcludedOpenings, excluded);
+    return out;
+}
+
+bool DecodeCheckpointBinary(const std::string& data, CheckpointState& state, std::string* error) {
+    const auto fail = [&](const std::string& message) {
+        if (error) {
+            *error = "Failed to parse binary checkpoint: " + message;
+        }
+        return false;
+    };
+
+    if (!IsBinaryCheckpoint(data) || data.size() < sizeof(kMagic) + 4) {
+        return fail("bad header");
+    }
+    std::uint32_t format_version = 0;
+    for (int i = 0; i < 4; ++i) {
+        format_version |= static_cast<std::uint32_t>(static_cast<unsigned char>(data[sizeof(kMagic) + i]))
+                          << (8 * i);
+    }
+    if (format_version > kFormatVersion) {
+        return fail("unsupported format version " + std::to_string(format_version));
+    }
+
+    state = CheckpointState{};
+    StringTable strings;
+    Decoder in(data.data() + sizeof(kMagic) + 4, data.size() - sizeof(kMagic) - 4);
+    // Counts are checked against the bytes left, but a corrupt file can still
+    // make an allocation fail; report that as a bad checkpoint.
+    try {
+        while (!in.done()) {
+            std::uint64_t length = 0;
+            const auto tag = static_cast<std::uint8_t>(in.data()[in.pos()]);
+            if (!in.Skip(1) || !in.GetVarint(length)) {
+                return fail("truncated section header");
+            }
+            Decoder section(in.data() + in.pos(), static_cast<std::size_t>(length));
+            if (!in.Skip(static_cast<std::size_t>(length))) {
+                return fail("truncated section " + std::to_string(tag));
+            }
+
+            bool ok = true;
+            switch (tag) {
+                case kHeader:
+                    ok = DecodeHeader(section, state);
+                    break;
+                case kStrings:
+                    ok = strings.Load(section);
+                    break;
+                case kCompletedFixtures:
+                    ok = DecodeIntList(section, state.completed_fixture_indices);
+                    break;
+                case kCompletedGames:
+                    ok = DecodeCompletedGames(section, strings, state);
+                    break;
+                case kStandings:
+                    ok = DecodeStandings(section, strings, state);
+                    break;
+                case kActiveGames:
+                    ok = DecodeActiveGames(section, strings, format_version, state);
+                    break;
+                case kNextGame:
+                    ok = section.GetInt(state.next_game.fixture_index) &&
+                         strings.Get(section, state.next_game.white) &&
+                         strings.Get(section, state.next_game.black) &&
+                         strings.Get(section, state.next_game.opening_id);
+                    break;
+                case kSwiss:
+                    ok = DecodeSwiss(section, strings, state);
+                    break;
+                case kExcludedOpenings:
+                    ok = DecodeStringList(section, strings, state.excluded_openings);
+                    break;
+                default:
+                    break;
+            }
+            if (!ok) {
+                return fail("corrupt section " + std::to_string(tag));
+            }
+        }
+    } catch (const std::exception& ex) {
+        return fail(ex.what());
+    }
+    return true;
+}
+
+}  // namespace ijccrl::core::persist
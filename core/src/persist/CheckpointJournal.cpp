@@ -0,0 +1,430 @@
+#include "ijccrl/core/persist/CheckpointJournal.h"
+
+#include "ijccrl/core/util/AtomicFileWriter.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <unordered_set>
+
+namespace ijccrl::core::persist {
+
+namespace {
+
+void ApplyResult(StandingsSnapshot& row, double points) {
+    row.games += 1;
+    row.points += points;
+    if (points >= 1.0) {
+        row.wins += 1;
+    } else if (points > 0.0) {
+        row.draws += 1;
+    } else {
+        row.losses += 1;
+    }
+}
+
+StandingsSnapshot& FindRow(CheckpointState& state, const std::string& name) {
+    for (auto& row : state.standings) {
+        if (row.name == name) {
+            return row;
+        }
+    }
+    StandingsSnapshot row;
+    row.name = name;
+    state.standings.push_back(std::move(row));
+    return state.standings.back();
+}
+
+void UpdateColor(CheckpointState& state, int engine_id, int color) {
+    if (engine_id < 0) {
+        return;
+    }
+    if (state.swiss.color_history.size() <= static_cast<size_t>(engine_id)) {
+        state.swiss.color_history.resize(static_cast<size_t>(engine_id) + 1);
+    }
+    auto& entry = state.swiss.color_history[static_cast<size_t>(engine_id)];
+    if (entry.last_color == color) {
+        entry.streak += 1;
+    } else {
+        entry.last_color = color;
+        entry.streak = 1;
+    }
+}
+
+void ApplySwissResult(CheckpointState& state, int fixture_index, int white_id, int black_id) {
+    UpdateColor(state, white_id, 1);
+    UpdateColor(state, black_id, -1);
+
+    auto& pending = state.swiss.pending_pairings_current_round;
+    pending.erase(std::remove_if(pending.begin(),
+                                 pending.end(),
+                                 [&](const auto& entry) { return entry.fixture_index == fixture_index; }),
+                  pending.end());
+
+    const int low = std::min(white_id, black_id);
+    const int high = std::max(white_id, black_id);
+    const bool pairing_open = std::any_of(pending.begin(), pending.end(), [&](const auto& entry) {
+        return std::min(entry.fixture.white_engine_id, entry.fixture.black_engine_id) == low &&
+               std::max(entry.fixture.white_engine_id, entry.fixture.black_engine_id) == high;
+    });
+    const bool already_played =
+        std::any_of(state.swiss.pairings_played.begin(),
+                    state.swiss.pairings_played.end(),
+                    [&](const auto& entry) {
+                        return entry.white_engine_id == low && entry.black_engine_id == high;
+                    });
+    if (!pairing_open && !already_played) {
+        CheckpointState::SwissPairing pairing;
+        pairing.white_engine_id = low;
+        pairing.black_engine_id = high;
+        state.swiss.pairings_played.push_back(pairing);
+    }
+    if (pending.empty()) {
+        state.swiss.current_round += 1;
+    }
+}
+
+std::vector<int> EvalToArray(const ijccrl::core::game::GameState::EvalInfo& eval) {
+    return {eval.has_cp ? 1 : 0, eval.cp, eval.has_mate ? 1 : 0, eval.mate, eval.depth};
+}
+
+void EvalFromArray(const std::vector<int>& values,
+                   std::size_t offset,
+                   ijccrl::core::game::GameState::EvalInfo& eval) {
+    eval.has_cp = values[offset] != 0;
+    eval.cp = values[offset + 1];
+    eval.has_mate = values[offset + 2] != 0;
+    eval.mate = values[offset + 3];
+    eval.depth = values[offset + 4];
+}
+
+// AppendLine writes every record as {"seq":N,...}, so compaction reads the
+// sequence number without parsing the line. Malformed lines read as 0 and are
+// dropped. The tag cannot occur inside a string value, where quotes are escaped.
+constexpr char kSeqPrefix[] = "{\"seq\":";
+constexpr char kEndRecordTag[] = "\"type\":\"end\"";
+
+std::uint64_t RecordSeq(const std::string& line) {
+    const size_t prefix = sizeof(kSeqPrefix) - 1;
+    if (line.compare(0, prefix, kSeqPrefix) != 0) {
+        return 0;
+    }
+    std::uint64_t seq = 0;
+    size_t pos = prefix;
+    for (; pos < line.size() && line[pos] >= '0' && line[pos] <= '9'; ++pos) {
+        seq = seq * 10 + static_cast<std::uint64_t>(line[pos] - '0');
+    }
+    return pos > prefix && pos < line.size() && line[pos] == ',' ? seq : 0;
+}
+
+}  // namespace
+
+std::string JournalPathFor(const std::string& checkpoint_path) {
+    return checkpoint_path + ".journal";
+}
+
+bool CheckpointJournal::Open(const std::string& path, std::uint64_t last_seq, bool truncate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_.is_open()) {
+        out_.close();
+    }
+    path_ = path;
+    seq_ = last_seq;
+    completed_since_compaction_ = 0;
+    journaled_plies_.clear();
+    const std::filesystem::path fs_path(path);
+    if (!fs_path.parent_path().empty()) {
+        std::filesystem::create_directories(fs_path.parent_path());
+    }
+    out_.open(path, std::ios::binary | (truncate ? std::ios::trunc : std::ios::app));
+    return out_.is_open();
+}
+
+void CheckpointJournal::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_.is_open()) {
+        out_.close();
+    }
+}
+
+bool CheckpointJournal::is_open() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return out_.is_open();
+}
+
+bool CheckpointJournal::AppendStarted(const ActiveGameMeta& game) {
+    nlohmann::json record = {
+        {"type", "start"},
+        {"game_no", game.game_no},
+        {"fixture_index", game.fixture_index},
+        {"white", game.white},
+        {"black", game.black},
+        {"opening_id", game.opening_id},
+    };
+    return AppendLine(record.dump(), Record::Start);
+}
+
+bool CheckpointJournal::AppendProgress(int game_no,
+                                       int fixture_index,
+                                       const ijccrl::core::game::GameProgress& progress) {
+    std::size_t from = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& journaled = journaled_plies_[game_no];
+        if (journaled > progress.moves_uci.size()) {
+            journaled = 0;
+        }
+        from = journaled;
+        journaled = progress.moves_uci.size();
+    }
+    nlohmann::json record = {
+        {"type", "move"},
+        {"game_no", game_no},
+        {"fixture_index", fixture_index},
+        {"from", from},
+        {"moves",
+         std::vector<std::string>(progress.moves_uci.begin() + static_cast<std::ptrdiff_t>(from),
+                                  progress.moves_uci.end())},
+        {"wtime_ms", progress.wtime_ms},
+        {"btime_ms", progress.btime_ms},
+        {"streaks",
+         {progress.draw_score_streak,
+          progress.win_score_streak_white,
+          progress.win_score_streak_black,
+          progress.resign_streak_white,
+          progress.resign_streak_black}},
+        {"evals", EvalToArray(progress.last_eval_white)},
+    };
+    for (int value : EvalToArray(progress.last_eval_black)) {
+        record["evals"].push_back(value);
+    }
+    return AppendLine(record.dump(), Record::Move);
+}
+
+bool CheckpointJournal::AppendCompleted(const CompletedGameMeta& game,
+                                        int white_engine_id,
+                                        int black_engine_id,
+                                        const std::string& end_time) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journaled_plies_.erase(game.game_no);
+    }
+    nlohmann::json record = {
+        {"type", "end"},
+        {"game_no", game.game_no},
+        {"fixture_index", game.fixture_index},
+        {"white", game.white},
+        {"black", game.black},
+        {"white_id", white_engine_id},
+        {"black_id", black_engine_id},
+        {"opening_id", game.opening_id},
+        {"result", game.result},
+        {"termination", game.termination},
+        {"pgn_offset", game.pgn_offset},
+        {"pgn_path", game.pgn_path},
+        {"end_time", end_time},
+    };
+    return AppendLine(record.dump(), Record::End);
+}
+
+bool CheckpointJournal::AppendLine(const std::string& line, Record kind) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+        return false;
+    }
+    seq_ += 1;
+    if (kind == Record::End) {
+        completed_since_compaction_ += 1;
+    }
+    out_ << "{\"seq\":" << seq_ << ',' << line.substr(1) << '\n';
+    if (kind != Record::Move) {
+        out_.flush();
+    }
+    return static_cast<bool>(out_);
+}
+
+void CheckpointJournal::Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_.is_open()) {
+        out_.flush();
+    }
+}
+
+std::uint64_t CheckpointJournal::last_seq() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return seq_;
+}
+
+std::size_t CheckpointJournal::completed_since_compaction() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return completed_since_compaction_;
+}
+
+bool CheckpointJournal::Compact(std::uint64_t snapshot_seq) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+        return false;
+    }
+    out_.close();
+
+    std::string kept;
+    std::size_t kept_completed = 0;
+    {
+        std::ifstream input(path_, std::ios::binary);
+        std::string line;
+        while (std::getline(input, line)) {
+            if (RecordSeq(line) <= snapshot_seq) {
+                continue;
+            }
+            kept.append(line);
+            kept.push_back('\n');
+            if (line.find(kEndRecordTag) != std::string::npos) {
+                kept_completed += 1;
+            }
+        }
+    }
+
+    const bool ok = ijccrl::core::util::AtomicFileWriter::Write(path_, kept);
+    completed_since_compaction_ = kept_completed;
+    out_.open(path_, std::ios::binary | std::ios::app);
+    return ok && out_.is_open();
+}
+
+bool ReplayJournal(const std::string& path, CheckpointState& state, std::string* error) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        if (error) {
+            *error = "Failed to open checkpoint journal: " + path;
+        }
+        return false;
+    }
+
+    std::unordered_set<int> completed(state.completed_fixture_indices.begin(),
+                                      state.completed_fixture_indices.end());
+    const bool swiss = state.version == 2;
+    std::string line;
+    while (std::getline(input, line)) {
+        const auto record = nlohmann::json::parse(line, nullptr, false);
+        if (record.is_discarded() || !record.is_object()) {
+            continue;
+        }
+        const auto seq = record.value("seq", std::uint64_t{0});
+        if (seq <= state.journal_seq) {
+            continue;
+        }
+        state.journal_seq = seq;
+
+        const std::string type = record.value("type", "");
+        const int fixture_index = record.value("fixture_index", -1);
+        const int game_no = record.value("game_no", 0);
+        if (completed.count(fixture_index) > 0) {
+            continue;
+        }
+
+        if (type == "move") {
+            for (auto& active : state.active_games) {
+                if (active.game_no != game_no) {
+                    continue;
+                }
+                auto& progress = active.progress;
+                const auto from = record.value("from", std::size_t{0});
+                if (from > progress.moves_uci.size()) {
+                    break;
+                }
+                progress.moves_uci.resize(from);
+                for (const auto& move : record.value("moves", nlohmann::json::array())) {
+                    progress.moves_uci.push_back(move.get<std::string>());
+                }
+                progress.wtime_ms = record.value("wtime_ms", progress.wtime_ms);
+                progress.btime_ms = record.value("btime_ms", progress.btime_ms);
+                const auto streaks = record.value("streaks", std::vector<int>{});
+                if (streaks.size() == 5) {
+                    progress.draw_score_streak = streaks[0];
+                    progress.win_score_streak_white = streaks[1];
+                    progress.win_score_streak_black = streaks[2];
+                    progress.resign_streak_white = streaks[3];
+                    progress.resign_streak_black = streaks[4];
+                }
+                const auto evals = record.value("evals", std::vector<int>{});
+                if (evals.size() == 10) {
+                    EvalFromArray(evals, 0, progress.last_eval_white);
+                    EvalFromArray(evals, 5, progress.last_eval_black);
+                }
+                break;
+            }
+            continue;
+        }
+
+        if (type == "start") {
+            state.active_games.erase(std::remove_if(state.active_games.begin(),
+                                                    state.active_games.end(),
+                                                    [&](const auto& active) {
+                                                        return active.fixture_index == fixture_index &&
+                                                               active.game_no != game_no;
+                                                    }),
+                                     state.active_games.end());
+            const bool known = std::any_of(state.active_games.begin(),
+                                           state.active_games.end(),
+                                           [&](const auto& active) { return active.game_no == game_no; });
+            if (!known) {
+                ActiveGameMeta active;
+                active.game_no = game_no;
+                active.fixture_index = fixture_index;
+                active.white = record.value("white", "");
+                active.black = record.value("black", "");
+                active.opening_id = record.value("opening_id", "");
+                state.active_games.push_back(std::move(active));
+            }
+            continue;
+        }
+        if (type != "end") {
+            continue;
+        }
+
+        CompletedGameMeta game;
+        game.game_no = game_no;
+        game.fixture_index = fixture_index;
+        game.white = record.value("white", "");
+        game.black = record.value("black", "");
+        game.opening_id = record.value("opening_id", "");
+        game.result = record.value("result", "");
+        game.termination = record.value("termination", "");
+        game.pgn_offset = record.value("pgn_offset", 0LL);
+        game.pgn_path = record.value("pgn_path", "");
+
+        double white_points = 0.0;
+        if (game.result == "1-0") {
+            white_points = 1.0;
+        } else if (game.result == "1/2-1/2") {
+            white_points = 0.5;
+        }
+        if (game.result == "1-0" || game.result == "0-1" || game.result == "1/2-1/2") {
+            ApplyResult(FindRow(state, game.white), white_points);
+            ApplyResult(FindRow(state, game.black), 1.0 - white_points);
+        } else {
+            FindRow(state, game.white).games += 1;
+            FindRow(state, game.black).games += 1;
+        }
+
+        if (swiss) {
+            ApplySwissResult(state, fixture_index, record.value("white_id", -1), record.value("black_id", -1));
+        }
+
+        state.active_games.erase(std::remove_if(state.active_games.begin(),
+                                                state.active_games.end(),
+                                                [&](const auto& active) { return active.game_no == game_no; }),
+                                 state.active_games.end());
+        state.last_game_no = std::max(state.last_game_no, game_no);
+        const std::string end_time = record.value("end_time", "");
+        if (!end_time.empty()) {
+            state.last_game_end_time = end_time;
+        }
+        completed.insert(fixture_index);
+        state.completed_fixture_indices.push_back(fixture_index);
+        state.completed_games.push_back(std::move(game));
+    }
+    return true;
+}
+
+}  // namespace ijccrl::core::persist
@@ -1,11 +1,13 @@
 #include "ijccrl/core/persist/CheckpointState.h"
 
+#include "ijccrl/core/persist/CheckpointJournal.h"
 #include "ijccrl/core/util/AtomicFileWriter.h"
 
 #include <nlohmann/json.hpp>
 
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 
 namespace ijccrl::core::persist {
 
@@ -22,6 +24,62 @@ std::uint64_t Fnv1a64(const std::string& payload) {
     return hash;
 }
 
+nlohmann::json EvalToJson(const ijccrl::core::game::GameState::EvalInfo& eval) {
+    return {
+        {"has_cp", eval.has_cp},
+        {"cp", eval.cp},
+        {"has_mate", eval.has_mate},
+        {"mate", eval.mate},
+        {"depth", eval.depth},
+    };
+}
+
+ijccrl::core::game::GameState::EvalInfo EvalFromJson(const nlohmann::json& node) {
+    ijccrl::core::game::GameState::EvalInfo eval;
+    eval.has_cp = node.value("has_cp", false);
+    eval.cp = node.value("cp", 0);
+    eval.has_mate = node.value("has_mate", false);
+    eval.mate = node.value("mate", 0);
+    eval.depth = node.value("depth", 0);
+    return eval;
+}
+
+nlohmann::json ProgressToJson(const ijccrl::core::game::GameProgress& progress) {
+    return {
+        {"moves", progress.moves_uci},
+        {"wtime_ms", progress.wtime_ms},
+        {"btime_ms", progress.btime_ms},
+        {"draw_score_streak", progress.draw_score_streak},
+        {"win_score_streak_white", progress.win_score_streak_white},
+        {"win_score_streak_black", progress.win_score_streak_black},
+        {"resign_streak_white", progress.resign_streak_white},
+        {"resign_streak_black", progress.resign_streak_black},
+        {"last_eval_white", EvalToJson(progress.last_eval_white)},
+        {"last_eval_black", EvalToJson(progress.last_eval_black)},
+    };
+}
+
+ijccrl::core::game::GameProgress ProgressFromJson(const nlohmann::json& node) {
+    ijccrl::core::game::GameProgress progress;
+    if (node.contains("moves")) {
+        progress.moves_uci = node.at("moves").get<std::vector<std::string>>();
+    }
+    progress.wtime_ms = node.value("wtime_ms", 0);
+    progress.btime_ms = node.value("btime_ms", 0);
+    progress.draw_score_streak = node.value("draw_score_streak", 0);
+    progress.win_score_streak_white = node.value("win_score_streak_white", 0);
+    progress.win_score_streak_black = node.value("win_score_streak_black", 0);
+    progress.resign_streak_white = node.value("resign_streak_white", 0);
+    progress.resign_streak_black = node.value("resign_streak_black", 0);
+    if (node.contains("last_eval_white")) {
+        progress.last_eval_white = EvalFromJson(node.at("last_eval_white"));
+    }
+    if (node.contains("last_eval_black")) {
+        progress.last_eval_black = EvalFromJson(node.at("last_eval_black"));
+    }
+    return progress;
+}
+
 }  // namespace
 
 std::string ComputeConfigHash(const std::string& payload) {
@@ -29,11 +87,21 @@ std::string ComputeConfigHash(const std::string& payload) {
     return std::to_string(hash);
 }
 
-bool SaveCheckpoint(const std::string& path, const CheckpointState& state) {
+CheckpointFormat CheckpointFormatFromString(const std::string& name) {
+    return name == "binary" ? CheckpointFormat::Binary : CheckpointFormat::Json;
+}
+
+bool SaveCheckpoint(const std::string& path, const CheckpointState& state, CheckpointFormat format) {
     const std::filesystem::path fs_path(path);
     if (!fs_path.parent_path().empty()) {
         std::filesystem::create_directories(fs_path.parent_path());
     }
+    const std::string payload =
+        format == CheckpointFormat::Binary ? EncodeCheckpointBinary(state) : EncodeCheckpointJson(state);
+    return ijccrl::core::util::AtomicFileWriter::Write(path, payload);
+}
+
+std::string EncodeCheckpointJson(const CheckpointState& state) {
     nlohmann::json root;
     root["version"] = state.version;
     root["config_hash"] = state.config_hash;
@@ -44,6 +112,8 @@ bool SaveCheckpoint(const std::string& path, const CheckpointState& state) {
     root["rng_seed"] = state.rng_seed;
     root["last_game_no"] = state.last_game_no;
     root["last_game_end_time"] = state.last_game_end_time;
+    root["journal_seq"] = state.journal_seq;
+    root["excluded_openings"] = state.excluded_openings;
 
     root["completed_games"] = nlohmann::json::array();
     for (const auto& game : state.completed_games) {
@@ -80,6 +150,7 @@ bool SaveCheckpoint(const std::string& path, const CheckpointState& state) {
             {"white", active.white},
             {"black", active.black},
             {"opening_id", active.opening_id},
+            {"progress", ProgressToJson(active.progress)},
         });
     }
 
@@ -123,21 +194,49 @@ bool SaveCheckpoint(const std::string& path, const CheckpointState& state) {
         });
     }
 
-    return ijccrl::core::util::AtomicFileWriter::Write(path, root.dump(2));
+    return root.dump(2);
 }
 
 bool LoadCheckpoint(const std::string& path, CheckpointState& state, std::string* error) {
-    std::ifstream input(path);
+    std::ifstream input(path, std::ios::binary);
     if (!input) {
         if (error) {
             *error = "Failed to open checkpoint: " + path;
         }
         return false;
     }
+    std::ostringstream buffer;
+    buffer << input.rdbuf();
+    const std::string data = buffer.str();
+
+    const bool decoded = IsBinaryCheckpoint(data) ? DecodeCheckpointBinary(data, state, error)
+                                                  : DecodeCheckpointJson(data, state, error);
+    if (!decoded) {
+        return false;
+    }
+
+    const std::string journal_path = JournalPathFor(path);
+    if (std::filesystem::exists(journal_path)) {
+        return ReplayJournal(journal_path, state, error);
+    }
+    return true;
+}
 
+const ActiveGameMeta* FindActiveGame(const CheckpointState& state, int fixture_index) {
+    const ActiveGameMeta* found = nullptr;
+    for (const auto& active : state.active_games) {
+        if (active.fixture_index == fixture_index &&
+            (!found || active.progress.moves_uci.size() > found->progress.moves_uci.size())) {
+            found = &active;
+        }
+    }
+    return found;
+}
+
+bool DecodeCheckpointJson(const std::string& data, CheckpointState& state, std::string* error) {
     nlohmann::json root;
     try {
-        input >> root;
+        root = nlohmann::json::parse(data);
     } catch (const std::exception& ex) {
         if (error) {
             *error = std::string("Failed to parse checkpoint: ") + ex.what();
@@ -154,10 +253,14 @@ bool LoadCheckpoint(const std::string& path, CheckpointState& state, std::string
     state.rng_seed = root.value("rng_seed", state.rng_seed);
     state.last_game_no = root.value("last_game_no", state.last_game_no);
     state.last_game_end_time = root.value("last_game_end_time", state.last_game_end_time);
+    state.journal_seq = root.value("journal_seq", state.journal_seq);
 
     if (root.contains("completed_fixture_indices")) {
         state.completed_fixture_indices = root.at("completed_fixture_indices").get<std::vector<int>>();
     }
+    if (root.contains("excluded_openings")) {
+        state.excluded_openings = root.at("excluded_openings").get<std::vector<std::string>>();
+    }
 
     if (root.contains("completed_games")) {
         for (const auto& node : root.at("completed_games")) {
@@ -196,6 +299,9 @@ bool LoadCheckpoint(const std::string& path, CheckpointState& state, std::string
             active.white = node.value("white", "");
             active.black = node.value("black", "");
             active.opening_id = node.value("opening_id", "");
+            if (node.contains("progress")) {
+                active.progress = ProgressFromJson(node.at("progress"));
+            }
             state.active_games.push_back(std::move(active));
         }
     }
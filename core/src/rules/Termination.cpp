@@ -428,6 +428,22 @@ void GameTerminator::ApplyMove(const std::string& move_uci) {
     }
 }
 
+void GameTerminator::CaptureStreaks(ijccrl::core::game::GameProgress& progress) const {
+    progress.draw_score_streak = draw_score_streak_;
+    progress.win_score_streak_white = win_score_streak_white_;
+    progress.win_score_streak_black = win_score_streak_black_;
+    progress.resign_streak_white = resign_streak_white_;
+    progress.resign_streak_black = resign_streak_black_;
+}
+
+void GameTerminator::RestoreStreaks(const ijccrl::core::game::GameProgress& progress) {
+    draw_score_streak_ = progress.draw_score_streak;
+    win_score_streak_white_ = progress.win_score_streak_white;
+    win_score_streak_black_ = progress.win_score_streak_black;
+    resign_streak_white_ = progress.resign_streak_white;
+    resign_streak_black_ = progress.resign_streak_black;
+}
+
 ProbeInfo GameTerminator::BuildProbeInfo() const {
     if (!position_state_) {
         return {};
@@ -641,6 +657,75 @@ TerminationOutcome GameTerminator::ShouldEnd(const ijccrl::core::game::GameState
     return outcome;
 }
 
+namespace {
+
+bool IsUciMove(const std::string& move) {
+    if (move.size() != 4 && move.size() != 5) {
+        return false;
+    }
+    const auto on_board = [](char file, char rank) {
+        return file >= 'a' && file <= 'h' && rank >= '1' && rank <= '8';
+    };
+    if (!on_board(move[0], move[1]) || !on_board(move[2], move[3])) {
+        return false;
+    }
+    return move.size() == 4 || std::string("qrbnQRBN").find(move[4]) != std::string::npos;
+}
+
+std::uint64_t Fnv1a(const std::string& text, std::uint64_t hash = 14695981039346656037ull) {
+    for (const char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+}  // namespace
+
+bool CanonicalPositionKey(const std::string& fen, const std::vector<std::string>& moves_uci, std::string* key) {
+    GameTerminator::PositionState position;
+    if (fen.empty()) {
+        position.LoadStartpos();
+    } else {
+        position.LoadFen(fen);
+    }
+    for (const auto& move : moves_uci) {
+        if (!IsUciMove(move)) {
+            return false;
+        }
+        position.ApplyMove(move);
+    }
+
+    if (position.en_passant.size() == 2) {
+        const bool white_to_move = position.side_to_move == ijccrl::core::game::Side::White;
+        const int capture_rank = white_to_move ? 4 : 3;
+        const char capturer = white_to_move ? 'P' : 'p';
+        const int file = FileIndex(position.en_passant[0]);
+        const bool capturable = (file > 0 && position.board[capture_rank][file - 1] == capturer) ||
+                                (file < kBoardSize - 1 && position.board[capture_rank][file + 1] == capturer);
+        if (!capturable || position.en_passant[1] != (white_to_move ? '6' : '3')) {
+            position.en_passant = "-";
+        }
+    }
+    if (key) {
+        *key = position.PositionKey();
+    }
+    return true;
+}
+
+std::uint64_t CanonicalPositionHash(const std::string& fen, const std::vector<std::string>& moves_uci) {
+    std::string key;
+    if (CanonicalPositionKey(fen, moves_uci, &key)) {
+        return Fnv1a(key);
+    }
+    CanonicalPositionKey(fen, {}, &key);
+    auto hash = Fnv1a(key);
+    for (const auto& move : moves_uci) {
+        hash = Fnv1a(" " + move, hash);
+    }
+    return hash;
+}
+
 std::string GameTerminator::ReasonToString(TerminationReason reason) {
     switch (reason) {
         case TerminationReason::Checkmate:
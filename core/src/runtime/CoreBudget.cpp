@@ -0,0 +1,95 @@
+#include "ijccrl/core/runtime/CoreBudget.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace ijccrl::core::runtime {
+
+CoreBudget::CoreBudget(int capacity) : capacity_(std::max(1, capacity)) {}
+
+int CoreBudget::AddClient(double weight) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Usage usage;
+    usage.weight = weight > 0.0 ? weight : 1.0;
+    usage.active = true;
+    clients_.push_back(usage);
+    return static_cast<int>(clients_.size() - 1);
+}
+
+void CoreBudget::RemoveClient(int client) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (client < 0 || client >= static_cast<int>(clients_.size())) {
+            return;
+        }
+        auto& usage = clients_[static_cast<size_t>(client)];
+        in_use_ -= usage.in_use;
+        usage = Usage{};
+    }
+    cv_.notify_all();
+}
+
+bool CoreBudget::Acquire(int client, const std::atomic<bool>* stop) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (client < 0 || client >= static_cast<int>(clients_.size()) || !clients_[static_cast<size_t>(client)].active) {
+        return true;
+    }
+    const size_t index = static_cast<size_t>(client);
+    clients_[index].waiting += 1;
+    while (!(in_use_ < capacity_ && NextInLine(index))) {
+        if (stop && stop->load()) {
+            clients_[index].waiting -= 1;
+            lock.unlock();
+            cv_.notify_all();
+            return false;
+        }
+        cv_.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    clients_[index].waiting -= 1;
+    clients_[index].in_use += 1;
+    in_use_ += 1;
+    lock.unlock();
+    // Another slot may still be free for the next client in line.
+    cv_.notify_all();
+    return true;
+}
+
+void CoreBudget::Release(int client) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (client < 0 || client >= static_cast<int>(clients_.size())) {
+            return;
+        }
+        auto& usage = clients_[static_cast<size_t>(client)];
+        if (!usage.active || usage.in_use == 0) {
+            return;
+        }
+        usage.in_use -= 1;
+        in_use_ -= 1;
+    }
+    cv_.notify_all();
+}
+
+std::vector<CoreBudget::Usage> CoreBudget::usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return clients_;
+}
+
+bool CoreBudget::NextInLine(size_t client) const {
+    // Compare (in_use + 1) / weight: the share a client would have after the grant.
+    const auto& self = clients_[client];
+    const double own = (self.in_use + 1) / self.weight;
+    for (size_t i = 0; i < clients_.size(); ++i) {
+        const auto& other = clients_[i];
+        if (i == client || !other.active || other.waiting == 0) {
+            continue;
+        }
+        const double share = (other.in_use + 1) / other.weight;
+        if (share < own || (share == own && i < client)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace ijccrl::core::runtime
@@ -0,0 +1,234 @@
+#include "ijccrl/core/runtime/DurationModel.h"
+
+#include "ijccrl/core/util/AtomicFileWriter.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <queue>
+
+namespace ijccrl::core::runtime {
+
+DurationModel::DurationModel(double default_seconds) : default_seconds_(default_seconds) {}
+
+bool DurationModel::Load(const std::string& path, std::string* error) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        if (error) {
+            *error = "Failed to open duration history: " + path;
+        }
+        return false;
+    }
+    try {
+        nlohmann::json root;
+        input >> root;
+        const auto read_totals = [](const nlohmann::json& node) {
+            Totals totals;
+            totals.games = node.value("games", 0);
+            totals.plies = node.value("plies", 0.0);
+            totals.seconds = node.value("seconds", 0.0);
+            return totals;
+        };
+        std::lock_guard<std::mutex> lock(mutex_);
+        pairs_.clear();
+        openings_.clear();
+        global_ = Totals{};
+        if (root.contains("global")) {
+            global_ = read_totals(root.at("global"));
+        }
+        if (root.contains("pairs")) {
+            for (const auto& [key, node] : root.at("pairs").items()) {
+                pairs_[key] = read_totals(node);
+            }
+        }
+        if (root.contains("openings")) {
+            for (const auto& [key, node] : root.at("openings").items()) {
+                openings_[key] = read_totals(node);
+            }
+        }
+    } catch (const std::exception& ex) {
+        if (error) {
+            *error = std::string("Failed to parse duration history: ") + ex.what();
+        }
+        return false;
+    }
+    return true;
+}
+
+bool DurationModel::Save(const std::string& path) const {
+    const auto write_totals = [](const Totals& totals) {
+        return nlohmann::json{{"games", totals.games}, {"plies", totals.plies}, {"seconds", totals.seconds}};
+    };
+    nlohmann::json root;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        root["version"] = 1;
+        root["global"] = write_totals(global_);
+        root["pairs"] = nlohmann::json::object();
+        for (const auto& [key, totals] : pairs_) {
+            root["pairs"][key] = write_totals(totals);
+        }
+        root["openings"] = nlohmann::json::object();
+        for (const auto& [key, totals] : openings_) {
+            root["openings"][key] = write_totals(totals);
+        }
+    }
+    return ijccrl::core::util::AtomicFileWriter::Write(path, root.dump(2));
+}
+
+void DurationModel::Record(const std::string& white,
+                           const std::string& black,
+                           const std::string& opening_id,
+                           int plies,
+                           double seconds) {
+    if (plies <= 0 || seconds <= 0.0) {
+        return;
+    }
+    const auto add = [&](Totals& totals) {
+        totals.games += 1;
+        totals.plies += plies;
+        totals.seconds += seconds;
+    };
+    std::lock_guard<std::mutex> lock(mutex_);
+    add(global_);
+    add(pairs_[PairKey(white, black)]);
+    if (!opening_id.empty()) {
+        add(openings_[opening_id]);
+    }
+}
+
+double DurationModel::Predict(const std::string& white,
+                              const std::string& black,
+                              const std::string& opening_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (global_.games == 0 || global_.plies <= 0.0) {
+        return default_seconds_;
+    }
+    const double global_plies = global_.plies / global_.games;
+    double plies = global_plies;
+    double seconds_per_ply = global_.seconds / global_.plies;
+
+    const auto pair = pairs_.find(PairKey(white, black));
+    if (pair != pairs_.end() && pair->second.games > 0 && pair->second.plies > 0.0) {
+        plies = pair->second.plies / pair->second.games;
+        seconds_per_ply = pair->second.seconds / pair->second.plies;
+    }
+    const auto opening = openings_.find(opening_id);
+    if (opening != openings_.end() && opening->second.games > 0) {
+        plies *= (opening->second.plies / opening->second.games) / global_plies;
+    }
+    return plies * seconds_per_ply;
+}
+
+int DurationModel::games() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return global_.games;
+}
+
+std::string DurationModel::PathFor(const std::string& checkpoint_path) {
+    return checkpoint_path + ".durations.json";
+}
+
+std::string DurationModel::PairKey(const std::string& white, const std::string& black) {
+    return white < black ? white + "|" + black : black + "|" + white;
+}
+
+std::vector<size_t> LongestFirstOrder(const std::vector<double>& predicted) {
+    std::vector<size_t> order(predicted.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return predicted[a] > predicted[b];
+    });
+    return order;
+}
+
+double SimulateMakespan(const std::vector<PlannedJob>& jobs,
+                        const std::vector<size_t>& order,
+                        int workers,
+                        const std::vector<int>& instances,
+                        bool pick_free) {
+    size_t engine_count = instances.size();
+    for (const auto& job : jobs) {
+        engine_count = std::max({engine_count,
+                                 static_cast<size_t>(std::max(0, job.white_id) + 1),
+                                 static_cast<size_t>(std::max(0, job.black_id) + 1)});
+    }
+    const auto slots = [&](size_t engine) { return engine < instances.size() ? std::max(1, instances[engine]) : 1; };
+    const int board_count = std::max(1, workers);
+    double makespan = 0.0;
+
+    if (!pick_free) {
+        // Each instance is free from the time its last game ends.
+        std::vector<std::vector<double>> engine_free(engine_count);
+        for (size_t engine = 0; engine < engine_count; ++engine) {
+            engine_free[engine].assign(static_cast<size_t>(slots(engine)), 0.0);
+        }
+        std::priority_queue<double, std::vector<double>, std::greater<double>> boards;
+        for (int i = 0; i < board_count; ++i) {
+            boards.push(0.0);
+        }
+        for (size_t index : order) {
+            const auto& job = jobs[index];
+            auto& white = engine_free[static_cast<size_t>(job.white_id)];
+            auto& black = engine_free[static_cast<size_t>(job.black_id)];
+            const auto white_slot = std::min_element(white.begin(), white.end());
+            const auto black_slot = std::min_element(black.begin(), black.end());
+            const double finish = std::max({boards.top(), *white_slot, *black_slot}) + job.seconds;
+            boards.pop();
+            boards.push(finish);
+            *white_slot = finish;
+            *black_slot = finish;
+            makespan = std::max(makespan, finish);
+        }
+        return makespan;
+    }
+
+    struct Running {
+        double finish = 0.0;
+        int white_id = -1;
+        int black_id = -1;
+        bool operator>(const Running& other) const { return finish > other.finish; }
+    };
+    std::list<size_t> pending(order.begin(), order.end());
+    std::vector<int> free_slots(engine_count);
+    for (size_t engine = 0; engine < engine_count; ++engine) {
+        free_slots[engine] = slots(engine);
+    }
+    std::priority_queue<Running, std::vector<Running>, std::greater<Running>> running;
+    int free_boards = board_count;
+    double now = 0.0;
+    while (!pending.empty() || !running.empty()) {
+        for (auto it = pending.begin(); it != pending.end() && free_boards > 0;) {
+            const auto& job = jobs[*it];
+            auto& white = free_slots[static_cast<size_t>(job.white_id)];
+            auto& black = free_slots[static_cast<size_t>(job.black_id)];
+            if (white == 0 || black == 0) {
+                ++it;
+                continue;
+            }
+            white -= 1;
+            black -= 1;
+            free_boards -= 1;
+            running.push({now + job.seconds, job.white_id, job.black_id});
+            it = pending.erase(it);
+        }
+        if (running.empty()) {
+            break;
+        }
+        now = running.top().finish;
+        while (!running.empty() && running.top().finish <= now) {
+            free_slots[static_cast<size_t>(running.top().white_id)] += 1;
+            free_slots[static_cast<size_t>(running.top().black_id)] += 1;
+            free_boards += 1;
+            running.pop();
+        }
+        makespan = now;
+    }
+    return makespan;
+}
+
+}  // namespace ijccrl::core::runtime
@@ -1,16 +1,25 @@
 #include "ijccrl/core/runtime/EnginePool.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <thread>
 
 namespace ijccrl::core::runtime {
 
-EngineLease::EngineLease(EnginePool* pool, int white_id, int black_id)
-    : pool_(pool), white_id_(white_id), black_id_(black_id) {}
+EngineLease::EngineLease(EnginePool* pool, int white_id, int white_instance, int black_id, int black_instance)
+    : pool_(pool),
+      white_id_(white_id),
+      white_instance_(white_instance),
+      black_id_(black_id),
+      black_instance_(black_instance) {}
 
 EngineLease::EngineLease(EngineLease&& other) noexcept
-    : pool_(other.pool_), white_id_(other.white_id_), black_id_(other.black_id_) {
+    : pool_(other.pool_),
+      white_id_(other.white_id_),
+      white_instance_(other.white_instance_),
+      black_id_(other.black_id_),
+      black_instance_(other.black_instance_) {
     other.pool_ = nullptr;
     other.white_id_ = -1;
     other.black_id_ = -1;
@@ -21,7 +30,9 @@ EngineLease& EngineLease::operator=(EngineLease&& other) noexcept {
         Release();
         pool_ = other.pool_;
         white_id_ = other.white_id_;
+        white_instance_ = other.white_instance_;
         black_id_ = other.black_id_;
+        black_instance_ = other.black_instance_;
         other.pool_ = nullptr;
         other.white_id_ = -1;
         other.black_id_ = -1;
@@ -34,16 +45,16 @@ EngineLease::~EngineLease() {
 }
 
 ijccrl::core::uci::UciEngine& EngineLease::white() {
-    return pool_->engine(white_id_);
+    return pool_->engine(white_id_, white_instance_);
 }
 
 ijccrl::core::uci::UciEngine& EngineLease::black() {
-    return pool_->engine(black_id_);
+    return pool_->engine(black_id_, black_instance_);
 }
 
 void EngineLease::Release() {
     if (pool_) {
-        pool_->ReleasePair(white_id_, black_id_);
+        pool_->ReleasePair(white_id_, white_instance_, black_id_, black_instance_);
         pool_ = nullptr;
     }
 }
@@ -52,59 +63,103 @@ EnginePool::EnginePool(std::vector<EngineSpec> specs,
                        std::function<void(const std::string&)> log_fn)
     : specs_(std::move(specs)),
       log_fn_(std::move(log_fn)) {
-    engines_.reserve(specs_.size());
-    for (const auto& spec : specs_) {
-        engines_.push_back(std::make_unique<ijccrl::core::uci::UciEngine>(
-            spec.name, spec.command, spec.args));
+    engines_.resize(specs_.size());
+    busy_.resize(specs_.size());
+    for (size_t i = 0; i < specs_.size(); ++i) {
+        set_instances(static_cast<int>(i), 1);
     }
-    busy_.assign(engines_.size(), false);
+}
+
+void EnginePool::set_instances(int engine_id, int count) {
+    if (engine_id < 0 || engine_id >= static_cast<int>(specs_.size())) {
+        return;
+    }
+    const auto& spec = specs_[static_cast<size_t>(engine_id)];
+    auto& instances = engines_[static_cast<size_t>(engine_id)];
+    instances.clear();
+    for (int i = 0; i < std::max(1, count); ++i) {
+        instances.push_back(std::make_unique<ijccrl::core::uci::UciEngine>(spec.name, spec.command, spec.args));
+    }
+    busy_[static_cast<size_t>(engine_id)].assign(instances.size(), false);
 }
 
 bool EnginePool::StartAll(const std::string& working_dir) {
     working_dir_ = working_dir;
     for (size_t i = 0; i < engines_.size(); ++i) {
-        if (!InitializeEngine(static_cast<int>(i))) {
-            return false;
+        for (size_t instance = 0; instance < engines_[i].size(); ++instance) {
+            if (!InitializeEngine(static_cast<int>(i), static_cast<int>(instance))) {
+                return false;
+            }
         }
     }
     return true;
 }
 
+int EnginePool::FreeInstance(int engine_id) const {
+    const auto& busy = busy_[static_cast<size_t>(engine_id)];
+    for (size_t instance = 0; instance < busy.size(); ++instance) {
+        if (!busy[instance]) {
+            return static_cast<int>(instance);
+        }
+    }
+    return -1;
+}
+
 EngineLease EnginePool::AcquirePair(int white_id, int black_id) {
     std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [&]() {
-        return !busy_[static_cast<size_t>(white_id)] &&
-               !busy_[static_cast<size_t>(black_id)];
-    });
-    busy_[static_cast<size_t>(white_id)] = true;
-    busy_[static_cast<size_t>(black_id)] = true;
-    return EngineLease(this, white_id, black_id);
+    cv_.wait(lock, [&]() { return FreeInstance(white_id) >= 0 && FreeInstance(black_id) >= 0; });
+    const int white_instance = FreeInstance(white_id);
+    const int black_instance = FreeInstance(black_id);
+    busy_[static_cast<size_t>(white_id)][static_cast<size_t>(white_instance)] = true;
+    busy_[static_cast<size_t>(black_id)][static_cast<size_t>(black_instance)] = true;
+    return EngineLease(this, white_id, white_instance, black_id, black_instance);
+}
+
+EngineLease EnginePool::TryAcquirePair(int white_id, int black_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int white_instance = FreeInstance(white_id);
+    const int black_instance = FreeInstance(black_id);
+    if (white_instance < 0 || black_instance < 0) {
+        return {};
+    }
+    busy_[static_cast<size_t>(white_id)][static_cast<size_t>(white_instance)] = true;
+    busy_[static_cast<size_t>(black_id)][static_cast<size_t>(black_instance)] = true;
+    return EngineLease(this, white_id, white_instance, black_id, black_instance);
 }
 
-void EnginePool::ReleasePair(int white_id, int black_id) {
+void EnginePool::ReleasePair(int white_id, int white_instance, int black_id, int black_instance) {
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        busy_[static_cast<size_t>(white_id)] = false;
-        busy_[static_cast<size_t>(black_id)] = false;
+        busy_[static_cast<size_t>(white_id)][static_cast<size_t>(white_instance)] = false;
+        busy_[static_cast<size_t>(black_id)][static_cast<size_t>(black_instance)] = false;
     }
     cv_.notify_all();
 }
 
-bool EnginePool::RestartEngine(int engine_id) {
+bool EnginePool::RestartEngine(int engine_id, int instance) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (engine_id < 0 || engine_id >= static_cast<int>(engines_.size())) {
+    if (engine_id < 0 || engine_id >= static_cast<int>(engines_.size()) || instance < 0 ||
+        instance >= static_cast<int>(engines_[static_cast<size_t>(engine_id)].size())) {
         return false;
     }
-    engines_[static_cast<size_t>(engine_id)]->Stop();
-    return InitializeEngine(engine_id);
+    engine(engine_id, instance).Stop();
+    return InitializeEngine(engine_id, instance);
+}
+
+void EnginePool::StopAll() {
+    for (auto& instances : engines_) {
+        for (auto& engine : instances) {
+            engine->Stop();
+        }
+    }
 }
 
-ijccrl::core::uci::UciEngine& EnginePool::engine(int engine_id) {
-    return *engines_[static_cast<size_t>(engine_id)];
+ijccrl::core::uci::UciEngine& EnginePool::engine(int engine_id, int instance) {
+    return *engines_[static_cast<size_t>(engine_id)][static_cast<size_t>(instance)];
 }
 
-bool EnginePool::InitializeEngine(int engine_id) {
-    auto& engine = *engines_[static_cast<size_t>(engine_id)];
+bool EnginePool::InitializeEngine(int engine_id, int instance) {
+    auto& engine = this->engine(engine_id, instance);
     engine.set_handshake_timeout_ms(handshake_timeout_ms_);
     if (!watchdog_enabled_) {
         if (!engine.Start(working_dir_)) {
@@ -0,0 +1,44 @@
+#include "ijccrl/core/runtime/JobQueue.h"
+
+#include <chrono>
+
+namespace ijccrl::core::runtime {
+
+void JobQueue::Push(MatchJob job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+}
+
+void JobQueue::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_.store(true);
+    }
+    cv_.notify_all();
+}
+
+bool JobQueue::Pop(MatchJob& job, const std::atomic<bool>* stop) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto wait_start = std::chrono::steady_clock::now();
+    while (jobs_.empty() && !closed_.load() && !(stop && stop->load())) {
+        cv_.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    if (jobs_.empty()) {
+        return false;
+    }
+    idle_us_.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - wait_start)
+                           .count());
+    job = std::move(jobs_.front());
+    jobs_.pop_front();
+    return true;
+}
+
+double JobQueue::idle_seconds() const {
+    return static_cast<double>(idle_us_.load()) / 1'000'000.0;
+}
+
+}  // namespace ijccrl::core::runtime
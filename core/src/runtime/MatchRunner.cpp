@@ -1,6 +1,8 @@
 #include "ijccrl/core/runtime/MatchRunner.h"
 
 #include <algorithm>
+#include <chrono>
+#include <list>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -28,7 +30,8 @@ MatchRunner::MatchRunner(EnginePool& pool,
                          LiveUpdateFn live_update,
                          MoveUpdateFn move_update,
                          WatchdogLogFn watchdog_log,
-                         JobEventFn job_event)
+                         JobEventFn job_event,
+                         ProgressFn progress_update)
     : pool_(pool),
       time_control_(time_control),
       termination_limits_(std::move(termination_limits)),
@@ -42,20 +45,109 @@ MatchRunner::MatchRunner(EnginePool& pool,
       live_update_(std::move(live_update)),
       move_update_(std::move(move_update)),
       watchdog_log_(std::move(watchdog_log)),
-      job_event_(std::move(job_event)) {}
+      job_event_(std::move(job_event)),
+      progress_update_(std::move(progress_update)) {}
 
 void MatchRunner::Run(const std::vector<MatchJob>& jobs,
                       int concurrency,
                       const Control& control,
                       int initial_game_number) {
-    if (jobs.empty()) {
+    Run(
+        jobs.size(),
+        [&jobs](size_t index, MatchJob& job) {
+            job = jobs[index];
+            return true;
+        },
+        concurrency,
+        control,
+        initial_game_number);
+}
+
+void MatchRunner::Run(size_t job_count,
+                      const JobSource& source,
+                      int concurrency,
+                      const Control& control,
+                      int initial_game_number) {
+    if (job_count == 0) {
+        return;
+    }
+    std::atomic<size_t> next_job{0};
+    const ClaimFn claim = [&](MatchJob& job, EngineLease& lease) {
+        while (true) {
+            // A source that closes (the worker's job queue) keeps returning
+            // false, so every skipped job rechecks stop and drain.
+            if ((control.stop && control.stop->load()) || (control.drain && control.drain->load())) {
+                return false;
+            }
+            const size_t index = next_job.fetch_add(1);
+            if (index >= job_count) {
+                return false;
+            }
+            if (source(index, job)) {
+                break;
+            }
+        }
+        lease = pool_.AcquirePair(job.fixture.white_engine_id, job.fixture.black_engine_id);
+        return true;
+    };
+    RunClaims(claim, {}, concurrency, control, initial_game_number);
+}
+
+void MatchRunner::Run(const std::vector<OrderedJob>& order,
+                      const JobSource& source,
+                      int concurrency,
+                      const Control& control,
+                      int initial_game_number) {
+    std::list<OrderedJob> pending(order.begin(), order.end());
+    if (pending.empty()) {
         return;
     }
 
+    std::mutex picker_mutex;
+    std::condition_variable picker_cv;
+    const auto stopping = [&]() {
+        return (control.stop && control.stop->load()) || (control.drain && control.drain->load());
+    };
+    const ClaimFn claim = [&](MatchJob& job, EngineLease& lease) {
+        std::unique_lock<std::mutex> lock(picker_mutex);
+        while (!pending.empty() && !stopping()) {
+            bool picked = false;
+            for (auto it = pending.begin(); it != pending.end(); ++it) {
+                auto candidate = pool_.TryAcquirePair(it->white_engine_id, it->black_engine_id);
+                if (!candidate.valid()) {
+                    continue;
+                }
+                const size_t index = it->index;
+                pending.erase(it);
+                if (source(index, job)) {
+                    lease = std::move(candidate);
+                    return true;
+                }
+                picked = true;
+                break;
+            }
+            // Engines are released by other boards; the timeout rechecks stop.
+            if (!picked) {
+                picker_cv.wait_for(lock, std::chrono::milliseconds(100));
+            }
+        }
+        return false;
+    };
+    const auto released = [&]() {
+        std::lock_guard<std::mutex> lock(picker_mutex);
+        picker_cv.notify_all();
+    };
+    RunClaims(claim, released, concurrency, control, initial_game_number);
+}
+
+void MatchRunner::RunClaims(const ClaimFn& claim,
+                            const std::function<void()>& released,
+                            int concurrency,
+                            const Control& control,
+                            int initial_game_number) {
     const int worker_count = std::max(1, concurrency);
     std::vector<std::thread> workers;
     workers.reserve(static_cast<size_t>(worker_count));
-    std::atomic<size_t> next_job{0};
     std::atomic<int> game_counter{initial_game_number};
     {
         std::lock_guard<std::mutex> lock(failure_mutex_);
@@ -63,8 +155,8 @@ void MatchRunner::Run(const std::vector<MatchJob>& jobs,
     }
 
     for (int i = 0; i < worker_count; ++i) {
-        workers.emplace_back([&]() {
-            RunWorker(jobs, next_job, game_counter, control);
+        workers.emplace_back([&, i]() {
+            RunWorker(i, claim, released, game_counter, control);
         });
     }
 
@@ -82,11 +174,13 @@ void MatchRunner::Run(const std::vector<MatchJob>& jobs,
     Run(jobs, concurrency, control, initial_game_number);
 }
 
-void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
-                            std::atomic<size_t>& next_job,
+void MatchRunner::RunWorker(int board,
+                            const ClaimFn& claim,
+                            const std::function<void()>& released,
                             std::atomic<int>& game_counter,
                             const Control& control) {
     ijccrl::core::game::GameRunner runner;
+    runner.set_broadcast_latency(control.latency);
 
     while (true) {
         if (control.stop && control.stop->load()) {
@@ -98,22 +192,25 @@ void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
                 return !control.paused->load() || (control.stop && control.stop->load());
             });
         }
-        if (control.stop && control.stop->load()) {
+        if ((control.stop && control.stop->load()) || (control.drain && control.drain->load())) {
             return;
         }
 
-        const size_t index = next_job.fetch_add(1);
-        if (index >= jobs.size()) {
+        MatchJob job;
+        EngineLease lease;
+        if (!claim(job, lease)) {
+            return;
+        }
+        // The slot is taken after the engines so that a game holding a slot
+        // never waits on engines held by a game still waiting for one, and
+        // before the started event, which a stop here would leave unmatched.
+        if (control.budget && !control.budget->Acquire(control.budget_client, control.stop)) {
             return;
         }
-
-        const auto& job = jobs[index];
         const int game_number = game_counter.fetch_add(1) + 1;
         if (job_event_) {
             job_event_(job, game_number, true);
         }
-        auto lease = pool_.AcquirePair(job.fixture.white_engine_id,
-                                       job.fixture.black_engine_id);
         auto& white = lease.white();
         auto& black = lease.black();
 
@@ -138,7 +235,7 @@ void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
 
         const auto live_update = [&](const ijccrl::core::pgn::PgnGame& live_game) {
             if (live_update_) {
-                live_update_(live_game);
+                live_update_(job, game_number, board, live_game);
             }
         };
         const auto move_update = [&](const std::string& move_uci, const std::string& fen_after_move) {
@@ -146,7 +243,13 @@ void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
                 move_update_(job, game_number, move_uci, fen_after_move);
             }
         };
+        const auto progress_update = [&](const ijccrl::core::game::GameProgress& progress) {
+            if (progress_update_) {
+                progress_update_(job, game_number, progress);
+            }
+        };
 
+        const auto game_start = std::chrono::steady_clock::now();
         auto result = runner.PlayGame(white,
                                       black,
                                       time_control_,
@@ -157,9 +260,12 @@ void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
                                       job.opening.fen,
                                       job.opening.moves,
                                       live_update,
-                                      move_update);
+                                      move_update,
+                                      job.resume.moves_uci.empty() ? nullptr : &job.resume,
+                                      progress_update);
 
         const auto handle_failure = [&](int engine_id,
+                                         int instance,
                                          ijccrl::core::uci::UciEngine& engine,
                                          const std::string& label) {
             if (!watchdog_enabled_) {
@@ -207,19 +313,28 @@ void MatchRunner::RunWorker(const std::vector<MatchJob>& jobs,
                     }
                 }
             }
-            pool_.RestartEngine(engine_id);
+            pool_.RestartEngine(engine_id, instance);
         };
 
-        handle_failure(job.fixture.white_engine_id, white, white.name());
-        handle_failure(job.fixture.black_engine_id, black, black.name());
+        handle_failure(job.fixture.white_engine_id, lease.white_instance(), white, white.name());
+        handle_failure(job.fixture.black_engine_id, lease.black_instance(), black, black.name());
+        if (control.budget) {
+            control.budget->Release(control.budget_client);
+        }
 
         if (job_event_) {
             job_event_(job, game_number, false);
         }
         MatchResult payload{job, result, game_number};
+        payload.duration_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - game_start).count();
         if (result_callback_) {
             result_callback_(payload);
         }
+        lease = EngineLease();
+        if (released) {
+            released();
+        }
     }
 }
 
@@ -0,0 +1,166 @@
+#include "ijccrl/core/stats/EloEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace ijccrl::core::stats {
+
+namespace {
+
+constexpr double kEloScale = 400.0;
+constexpr double kTolerance = 1e-3;
+constexpr int kMaxIterations = 10000;
+constexpr size_t kParallelThreshold = 64;
+constexpr double kConfidenceZ = 1.96;
+
+double ToElo(double strength) {
+    return kEloScale * std::log10(strength);
+}
+
+}  // namespace
+
+EloEstimator::EloEstimator(size_t engine_count, double prior_games)
+    : engine_count_(engine_count),
+      prior_games_(prior_games),
+      games_(engine_count * engine_count, 0.0),
+      scores_(engine_count * engine_count, 0.0),
+      strength_(engine_count, 1.0),
+      ratings_(engine_count) {}
+
+void EloEstimator::AddResult(int white_id, int black_id, double white_score) {
+    if (white_id < 0 || black_id < 0 || white_id == black_id ||
+        white_id >= static_cast<int>(engine_count_) ||
+        black_id >= static_cast<int>(engine_count_) ||
+        white_score < 0.0 || white_score > 1.0) {
+        return;
+    }
+    const size_t white = static_cast<size_t>(white_id);
+    const size_t black = static_cast<size_t>(black_id);
+    games_[white * engine_count_ + black] += 1.0;
+    games_[black * engine_count_ + white] += 1.0;
+    scores_[white * engine_count_ + black] += white_score;
+    scores_[black * engine_count_ + white] += 1.0 - white_score;
+    ratings_[white].games += 1;
+    ratings_[black].games += 1;
+    dirty_ = true;
+}
+
+// Minorization-maximization step for the Bradley-Terry model with draws as
+// half points. prior_games_ virtual draws against the pool average keep
+// perfect scores finite.
+void EloEstimator::UpdateRange(size_t begin, size_t end, std::vector<double>& next) const {
+    for (size_t i = begin; i < end; ++i) {
+        if (ratings_[i].games == 0) {
+            next[i] = 1.0;
+            continue;
+        }
+        const double* games = &games_[i * engine_count_];
+        const double* scores = &scores_[i * engine_count_];
+        double wins = prior_games_ * 0.5;
+        double denominator = prior_games_ / (strength_[i] + 1.0);
+        for (size_t j = 0; j < engine_count_; ++j) {
+            if (games[j] <= 0.0) {
+                continue;
+            }
+            wins += scores[j];
+            denominator += games[j] / (strength_[i] + strength_[j]);
+        }
+        next[i] = wins / denominator;
+    }
+}
+
+int EloEstimator::Solve() {
+    if (!dirty_) {
+        return 0;
+    }
+    dirty_ = false;
+
+    const size_t workers =
+        engine_count_ < kParallelThreshold
+            ? 1
+            : std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(),
+                                                   engine_count_ / kParallelThreshold));
+    std::vector<double> next(engine_count_, 1.0);
+    int iterations = 0;
+    while (iterations < kMaxIterations) {
+        ++iterations;
+        if (workers == 1) {
+            UpdateRange(0, engine_count_, next);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(workers);
+            const size_t chunk = (engine_count_ + workers - 1) / workers;
+            for (size_t w = 0; w < workers; ++w) {
+                const size_t begin = std::min(engine_count_, w * chunk);
+                const size_t end = std::min(engine_count_, begin + chunk);
+                threads.emplace_back([this, begin, end, &next]() { UpdateRange(begin, end, next); });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        // Only rating differences are identified, so pin the geometric mean to
+        // 1; without this the common offset drifts and convergence crawls.
+        double log_sum = 0.0;
+        int rated = 0;
+        for (size_t i = 0; i < engine_count_; ++i) {
+            if (ratings_[i].games > 0) {
+                log_sum += std::log(next[i]);
+                ++rated;
+            }
+        }
+        const double center = rated > 0 ? std::exp(log_sum / rated) : 1.0;
+        double max_delta = 0.0;
+        for (size_t i = 0; i < engine_count_; ++i) {
+            if (ratings_[i].games > 0) {
+                next[i] /= center;
+            }
+            max_delta = std::max(max_delta, std::fabs(ToElo(next[i]) - ToElo(strength_[i])));
+        }
+        strength_.swap(next);
+        if (max_delta < kTolerance) {
+            break;
+        }
+    }
+
+    UpdateRatings();
+    return iterations;
+}
+
+void EloEstimator::UpdateRatings() {
+    const double log_scale = std::log(10.0) / kEloScale;
+    double sum = 0.0;
+    int rated = 0;
+    for (size_t i = 0; i < engine_count_; ++i) {
+        if (ratings_[i].games > 0) {
+            sum += ToElo(strength_[i]);
+            ++rated;
+        }
+    }
+    const double mean = rated > 0 ? sum / rated : 0.0;
+
+    for (size_t i = 0; i < engine_count_; ++i) {
+        auto& rating = ratings_[i];
+        if (rating.games == 0) {
+            rating.elo = 0.0;
+            rating.error = 0.0;
+            continue;
+        }
+        const double prior_p = strength_[i] / (strength_[i] + 1.0);
+        double information = prior_games_ * prior_p * (1.0 - prior_p);
+        for (size_t j = 0; j < engine_count_; ++j) {
+            const double games = games_[i * engine_count_ + j];
+            if (games <= 0.0) {
+                continue;
+            }
+            const double p = strength_[i] / (strength_[i] + strength_[j]);
+            information += games * p * (1.0 - p);
+        }
+        rating.elo = ToElo(strength_[i]) - mean;
+        rating.error = information > 0.0 ? kConfidenceZ / (log_scale * std::sqrt(information)) : 0.0;
+    }
+}
+
+}  // namespace ijccrl::core::stats
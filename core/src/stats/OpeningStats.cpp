@@ -0,0 +1,251 @@
+#include "ijccrl/core/stats/OpeningStats.h"
+
+#include "ijccrl/core/util/AtomicFileWriter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace ijccrl::core::stats {
+
+namespace {
+
+constexpr char kMagic[8] = {'I', 'J', 'O', 'S', 'T', 'A', 'T', '1'};
+
+enum ResultCode : std::uint8_t {
+    kWhiteWin = 0,
+    kDraw = 1,
+    kBlackWin = 2,
+};
+
+void PutVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void PutBytes(std::string& out, const std::string& value) {
+    PutVarint(out, value.size());
+    out.append(value);
+}
+
+bool GetVarint(const std::string& data, size_t& pos, std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= data.size()) {
+            return false;
+        }
+        const auto byte = static_cast<unsigned char>(data[pos++]);
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GetBytes(const std::string& data, size_t& pos, size_t end, std::string& value) {
+    std::uint64_t size = 0;
+    if (!GetVarint(data, pos, size) || size > end - pos) {
+        return false;
+    }
+    value.assign(data, pos, static_cast<size_t>(size));
+    pos += static_cast<size_t>(size);
+    return true;
+}
+
+bool ResultToCode(const std::string& result, std::uint8_t& code) {
+    if (result == "1-0") {
+        code = kWhiteWin;
+    } else if (result == "1/2-1/2") {
+        code = kDraw;
+    } else if (result == "0-1") {
+        code = kBlackWin;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string EncodeRecord(const OpeningGame& game) {
+    std::uint8_t code = kDraw;
+    ResultToCode(game.result, code);
+    std::string payload;
+    PutBytes(payload, game.event);
+    PutBytes(payload, game.opening_id);
+    PutVarint(payload, static_cast<std::uint64_t>(game.fixture_index));
+    payload.push_back(static_cast<char>(code));
+    PutVarint(payload, static_cast<std::uint64_t>(game.plies));
+    PutBytes(payload, game.termination);
+    std::string record;
+    PutVarint(record, payload.size());
+    record += payload;
+    return record;
+}
+
+bool DecodeRecord(const std::string& data, size_t& pos, OpeningGame& game) {
+    std::uint64_t size = 0;
+    if (!GetVarint(data, pos, size) || size > data.size() - pos) {
+        return false;
+    }
+    const size_t end = pos + static_cast<size_t>(size);
+    std::uint64_t fixture = 0;
+    std::uint64_t plies = 0;
+    if (!GetBytes(data, pos, end, game.event) || !GetBytes(data, pos, end, game.opening_id) ||
+        !GetVarint(data, pos, fixture) || pos >= end) {
+        return false;
+    }
+    const auto code = static_cast<std::uint8_t>(data[pos++]);
+    if (!GetVarint(data, pos, plies) || !GetBytes(data, pos, end, game.termination) || pos != end) {
+        return false;
+    }
+    game.fixture_index = static_cast<int>(fixture);
+    game.plies = static_cast<int>(plies);
+    game.result = code == kWhiteWin ? "1-0" : (code == kBlackWin ? "0-1" : "1/2-1/2");
+    return true;
+}
+
+std::string CsvField(const std::string& value) {
+    if (value.find_first_of(",\"\n") == std::string::npos) {
+        return value;
+    }
+    std::string quoted = "\"";
+    for (const char c : value) {
+        if (c == '"') {
+            quoted.push_back('"');
+        }
+        quoted.push_back(c);
+    }
+    quoted.push_back('"');
+    return quoted;
+}
+
+}  // namespace
+
+double OpeningTotals::white_score() const {
+    const int total = games();
+    return total > 0 ? (white_wins + 0.5 * draws) / total : 0.5;
+}
+
+bool OpeningStats::Open(const std::string& path, std::string* error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_.clear();
+    games_.clear();
+
+    std::string data;
+    {
+        std::ifstream input(path, std::ios::binary);
+        if (input) {
+            std::ostringstream buffer;
+            buffer << input.rdbuf();
+            data = buffer.str();
+        }
+    }
+    if (!data.empty() && (data.size() < sizeof(kMagic) || std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0)) {
+        if (error) {
+            *error = "Not an opening stats file: " + path;
+        }
+        return false;
+    }
+
+    size_t records = 0;
+    size_t pos = sizeof(kMagic);
+    while (pos < data.size()) {
+        OpeningGame game;
+        if (!DecodeRecord(data, pos, game)) {
+            break;
+        }
+        records += 1;
+        games_[{game.event, game.fixture_index}] = std::move(game);
+    }
+
+    const bool torn = !data.empty() && pos != data.size();
+    if (data.empty() || torn || records > 2 * games_.size() + 64) {
+        std::string contents(kMagic, sizeof(kMagic));
+        for (const auto& entry : games_) {
+            contents += EncodeRecord(entry.second);
+        }
+        const std::filesystem::path fs_path(path);
+        if (!fs_path.parent_path().empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(fs_path.parent_path(), ec);
+        }
+        if (!ijccrl::core::util::AtomicFileWriter::Write(path, contents)) {
+            if (error) {
+                *error = "Failed to write opening stats " + path;
+            }
+            return false;
+        }
+    }
+    path_ = path;
+    return true;
+}
+
+bool OpeningStats::Record(const OpeningGame& game) {
+    std::uint8_t code = 0;
+    if (!ResultToCode(game.result, code)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path_.empty()) {
+        return false;
+    }
+    games_[{game.event, game.fixture_index}] = game;
+    std::ofstream output(path_, std::ios::binary | std::ios::app);
+    const auto record = EncodeRecord(game);
+    output.write(record.data(), static_cast<std::streamsize>(record.size()));
+    return static_cast<bool>(output);
+}
+
+std::map<std::string, OpeningTotals> OpeningStats::Totals(const std::string& exclude_event) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, OpeningTotals> totals;
+    for (const auto& entry : games_) {
+        const auto& game = entry.second;
+        if (!exclude_event.empty() && game.event == exclude_event) {
+            continue;
+        }
+        auto& row = totals[game.opening_id];
+        if (game.result == "1-0") {
+            row.white_wins += 1;
+        } else if (game.result == "0-1") {
+            row.black_wins += 1;
+        } else {
+            row.draws += 1;
+        }
+        row.plies += game.plies;
+        row.terminations[game.termination.empty() ? "normal" : game.termination] += 1;
+    }
+    return totals;
+}
+
+size_t OpeningStats::games() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return games_.size();
+}
+
+std::string OpeningStats::FormatCsv(const std::map<std::string, OpeningTotals>& totals) {
+    std::ostringstream out;
+    out << "opening_id,games,white_wins,draws,black_wins,white_score,average_plies,terminations\n";
+    out << std::fixed;
+    for (const auto& [id, row] : totals) {
+        std::string terminations;
+        for (const auto& [name, count] : row.terminations) {
+            if (!terminations.empty()) {
+                terminations.push_back(';');
+            }
+            terminations += name + ":" + std::to_string(count);
+        }
+        out << CsvField(id) << ',' << row.games() << ',' << row.white_wins << ',' << row.draws << ','
+            << row.black_wins << ',' << std::setprecision(3) << row.white_score() << ',' << std::setprecision(1)
+            << row.average_plies() << ',' << CsvField(terminations) << '\n';
+    }
+    return out.str();
+}
+
+}  // namespace ijccrl::core::stats
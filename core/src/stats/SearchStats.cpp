@@ -0,0 +1,92 @@
+#include "ijccrl/core/stats/SearchStats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ijccrl::core::stats {
+
+void GameSearchStats::AddSearch(int depth,
+                                long long search_nodes,
+                                long long search_nps,
+                                long long used_ms,
+                                long long allotted_ms,
+                                long long margin_ms) {
+    if (depth > 0) {
+        min_depth = depth_searches == 0 ? depth : std::min(min_depth, depth);
+        depth_searches += 1;
+        depth_total += depth;
+    }
+    nodes += search_nodes;
+    if (search_nps <= 0 && search_nodes > 0 && used_ms > 0) {
+        search_nps = search_nodes * 1000 / used_ms;
+    }
+    if (search_nps > 0) {
+        nps.push_back(search_nps);
+    }
+    time_used_ms += used_ms;
+    time_allotted_ms += allotted_ms;
+    min_margin_ms = searches == 0 ? margin_ms : std::min(min_margin_ms, margin_ms);
+    searches += 1;
+}
+
+std::size_t SearchAggregate::NpsBucket(long long nps) {
+    if (nps <= 1) {
+        return 0;
+    }
+    const auto bucket = static_cast<std::size_t>(4.0 * std::log2(static_cast<double>(nps)));
+    return std::min(bucket, kNpsBuckets - 1);
+}
+
+long long SearchAggregate::NpsPercentile(double fraction) const {
+    if (nps_samples_ == 0) {
+        return 0;
+    }
+    const auto target = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(nps_samples_)));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kNpsBuckets; ++i) {
+        seen += nps_buckets_[i];
+        if (seen >= std::max<std::uint64_t>(target, 1)) {
+            return std::llround(std::exp2((static_cast<double>(i) + 0.5) / 4.0));
+        }
+    }
+    return 0;
+}
+
+void SearchAggregate::Add(const GameSearchStats& game) {
+    if (game.searches == 0) {
+        return;
+    }
+    games_ += 1;
+    searches_ += game.searches;
+    if (game.depth_searches > 0) {
+        min_depth_ = depth_searches_ == 0 ? game.min_depth : std::min(min_depth_, game.min_depth);
+        depth_searches_ += game.depth_searches;
+        depth_total_ += game.depth_total;
+    }
+    for (const long long nps : game.nps) {
+        nps_buckets_[NpsBucket(nps)] += 1;
+        nps_samples_ += 1;
+    }
+    time_used_ms_ += game.time_used_ms;
+    time_allotted_ms_ += game.time_allotted_ms;
+    min_margin_ms_ = has_margin_ ? std::min(min_margin_ms_, game.min_margin_ms) : game.min_margin_ms;
+    has_margin_ = true;
+}
+
+SearchSummary SearchAggregate::Summarize() const {
+    SearchSummary summary;
+    summary.games = games_;
+    summary.searches = searches_;
+    summary.average_depth =
+        depth_searches_ > 0 ? static_cast<double>(depth_total_) / static_cast<double>(depth_searches_) : 0.0;
+    summary.min_depth = min_depth_;
+    summary.nps_p10 = NpsPercentile(0.10);
+    summary.nps_p50 = NpsPercentile(0.50);
+    summary.nps_p90 = NpsPercentile(0.90);
+    summary.time_used_seconds = static_cast<double>(time_used_ms_) / 1000.0;
+    summary.time_allotted_seconds = static_cast<double>(time_allotted_ms_) / 1000.0;
+    summary.min_margin_ms = min_margin_ms_;
+    return summary;
+}
+
+}  // namespace ijccrl::core::stats
@@ -0,0 +1,141 @@
+#include "ijccrl/core/stats/Sprt.h"
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace ijccrl::core::stats {
+
+namespace {
+
+double ExpectedScore(double elo) {
+    return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+}  // namespace
+
+Sprt::Sprt(double elo0, double elo1, double alpha, double beta)
+    : elo0_(elo0),
+      elo1_(elo1),
+      alpha_(alpha),
+      beta_(beta),
+      lower_bound_(std::log(beta / (1.0 - alpha))),
+      upper_bound_(std::log((1.0 - beta) / alpha)) {}
+
+Sprt::Status Sprt::RecordGame(int pair_index, double score) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = open_pairs_.find(pair_index);
+    if (it == open_pairs_.end()) {
+        open_pairs_.emplace(pair_index, score);
+        return status_;
+    }
+    const int bucket = static_cast<int>(std::lround((it->second + score) * 2.0));
+    open_pairs_.erase(it);
+    if (bucket < 0 || bucket > 4) {
+        return status_;
+    }
+    pentanomial_[static_cast<size_t>(bucket)] += 1;
+
+    if (status_ == Status::Continue) {
+        const double llr = LlrLocked();
+        if (llr >= upper_bound_) {
+            status_ = Status::AcceptH1;
+        } else if (llr <= lower_bound_) {
+            status_ = Status::AcceptH0;
+        }
+    }
+    return status_;
+}
+
+Sprt::Status Sprt::status() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return status_;
+}
+
+Sprt::Snapshot Sprt::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Snapshot snapshot;
+    snapshot.elo0 = elo0_;
+    snapshot.elo1 = elo1_;
+    snapshot.alpha = alpha_;
+    snapshot.beta = beta_;
+    snapshot.llr = LlrLocked();
+    snapshot.lower_bound = lower_bound_;
+    snapshot.upper_bound = upper_bound_;
+    snapshot.status = status_;
+    snapshot.pentanomial = pentanomial_;
+    for (int count : pentanomial_) {
+        snapshot.pairs += count;
+    }
+    return snapshot;
+}
+
+const char* Sprt::StatusName(Status status) {
+    switch (status) {
+        case Status::AcceptH0:
+            return "H0";
+        case Status::AcceptH1:
+            return "H1";
+        case Status::Continue:
+            break;
+    }
+    return "running";
+}
+
+std::string Sprt::Describe(const Snapshot& snapshot) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << "SPRT [" << snapshot.elo0 << ", " << snapshot.elo1
+        << "] LLR " << snapshot.llr << " (" << snapshot.lower_bound << ", " << snapshot.upper_bound
+        << ") pairs=" << snapshot.pairs << " status=" << StatusName(snapshot.status);
+    return out.str();
+}
+
+double Sprt::GameScore(const std::string& result, bool candidate_is_white) {
+    double white_score = -1.0;
+    if (result == "1-0") {
+        white_score = 1.0;
+    } else if (result == "0-1") {
+        white_score = 0.0;
+    } else if (result == "1/2-1/2") {
+        white_score = 0.5;
+    }
+    if (white_score < 0.0) {
+        return -1.0;
+    }
+    return candidate_is_white ? white_score : 1.0 - white_score;
+}
+
+double Sprt::LlrLocked() const {
+    constexpr double kRegularization = 1e-3;
+    int played = 0;
+    for (int count : pentanomial_) {
+        played += count;
+    }
+    if (played < 2) {
+        return 0.0;
+    }
+
+    std::array<double, 5> counts{};
+    double pairs = 0.0;
+    double sum = 0.0;
+    for (size_t i = 0; i < pentanomial_.size(); ++i) {
+        counts[i] = pentanomial_[i] > 0 ? pentanomial_[i] : kRegularization;
+        pairs += counts[i];
+        sum += counts[i] * (static_cast<double>(i) / 4.0);
+    }
+    const double mean = sum / pairs;
+    double variance = 0.0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        const double delta = static_cast<double>(i) / 4.0 - mean;
+        variance += counts[i] * delta * delta;
+    }
+    variance /= pairs;
+    if (variance <= 0.0) {
+        return 0.0;
+    }
+    const double s0 = ExpectedScore(elo0_);
+    const double s1 = ExpectedScore(elo1_);
+    return pairs * (s1 - s0) * (2.0 * mean - s0 - s1) / (2.0 * variance);
+}
+
+}  // namespace ijccrl::core::stats
@@ -0,0 +1,284 @@
+#include "ijccrl/core/stats/StandingsSimulator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <numeric>
+
+namespace ijccrl::core::stats {
+
+namespace {
+
+// Simulations run in batches of kLanes, one independent RNG per lane, with
+// points stored engine-major so the per-game update is a straight loop over
+// lanes the compiler can vectorize.
+constexpr size_t kLanes = 64;
+// Weight, in games, of the Elo-based prior against a pair's own results.
+constexpr double kPriorGames = 4.0;
+
+std::uint64_t SplitMix64(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+// xorshift32 never yields 0, so a sample <= Threshold(p) has probability p
+// (to 2^-32) and Threshold(0) is never reached.
+std::uint32_t Threshold(double probability) {
+    return static_cast<std::uint32_t>(std::lround(std::clamp(probability, 0.0, 1.0) * 4294967295.0));
+}
+
+}  // namespace
+
+StandingsSimulator::StandingsSimulator(std::vector<SimulatedGame> remaining,
+                                       int simulations,
+                                       int threads,
+                                       std::uint64_t seed)
+    : simulations_(std::max(0, simulations)),
+      threads_(threads > 0 ? threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()))),
+      seed_(seed),
+      remaining_(std::move(remaining)) {
+    std::sort(remaining_.begin(), remaining_.end(), [](const SimulatedGame& a, const SimulatedGame& b) {
+        return a.fixture_index < b.fixture_index;
+    });
+    worker_ = std::thread([this]() { Loop(); });
+}
+
+StandingsSimulator::~StandingsSimulator() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true);
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void StandingsSimulator::Update(const StandingsTable& standings, int completed_fixture) {
+    if (simulations_ == 0) {
+        return;
+    }
+    const auto& engines = standings.standings();
+    Input input;
+    input.half_points.reserve(engines.size());
+    input.elo.reserve(engines.size());
+    int draws = 0;
+    int games = 0;
+    for (const auto& entry : engines) {
+        input.half_points.push_back(static_cast<int>(std::lround(entry.points * 2.0)));
+        input.elo.push_back(entry.elo);
+        draws += entry.draws;
+        games += entry.games;
+    }
+    // Every game is counted once per side; start from an even draw rate.
+    input.draw_rate = (draws + 1.0) / (games + 2.0);
+    input.ranking = standings.ranking();
+    input.crosstable = standings.crosstable();
+    input.games_played = standings.games_played();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (completed_fixture >= 0) {
+            const auto it = std::lower_bound(remaining_.begin(),
+                                             remaining_.end(),
+                                             completed_fixture,
+                                             [](const SimulatedGame& game, int fixture_index) {
+                                                 return game.fixture_index < fixture_index;
+                                             });
+            if (it != remaining_.end() && it->fixture_index == completed_fixture) {
+                remaining_.erase(it);
+            }
+        }
+        pending_ = std::move(input);
+        dirty_ = true;
+    }
+    cv_.notify_all();
+}
+
+SimulationResult StandingsSimulator::Latest() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return latest_;
+}
+
+void StandingsSimulator::Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return stop_.load() || (!dirty_ && !busy_); });
+}
+
+void StandingsSimulator::Loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stop_.load() || dirty_; });
+        if (stop_.load()) {
+            return;
+        }
+        Input input = std::move(pending_);
+        input.remaining = remaining_;
+        dirty_ = false;
+        busy_ = true;
+        lock.unlock();
+        SimulationResult result = Simulate(input);
+        lock.lock();
+        busy_ = false;
+        if (!result.empty()) {
+            latest_ = std::move(result);
+        }
+        cv_.notify_all();
+    }
+}
+
+SimulationResult StandingsSimulator::Simulate(const Input& input) const {
+    const size_t engine_count = input.half_points.size();
+    SimulationResult result;
+    if (engine_count == 0) {
+        return result;
+    }
+
+    // Ties keep the current ranking: tie_key is higher for better-ranked
+    // engines, so half_points * engine_count + tie_key orders a simulation.
+    std::vector<int> tie_key(engine_count, 0);
+    std::vector<int> engine_by_tie(engine_count, 0);
+    std::vector<int> order = input.ranking;
+    if (order.size() != engine_count) {
+        order.resize(engine_count);
+        std::iota(order.begin(), order.end(), 0);
+    }
+    for (size_t position = 0; position < engine_count; ++position) {
+        const int key = static_cast<int>(engine_count - 1 - position);
+        tie_key[static_cast<size_t>(order[position])] = key;
+        engine_by_tie[static_cast<size_t>(key)] = order[position];
+    }
+
+    std::vector<std::uint32_t> white_ids;
+    std::vector<std::uint32_t> black_ids;
+    std::vector<std::uint32_t> win_cuts;
+    std::vector<std::uint32_t> draw_cuts;
+    for (const auto& game : input.remaining) {
+        if (game.white_id < 0 || game.black_id < 0 || game.white_id == game.black_id ||
+            static_cast<size_t>(game.white_id) >= engine_count || static_cast<size_t>(game.black_id) >= engine_count) {
+            continue;
+        }
+        const double expected =
+            1.0 / (1.0 + std::pow(10.0,
+                                  (input.elo[static_cast<size_t>(game.black_id)] -
+                                   input.elo[static_cast<size_t>(game.white_id)]) / 400.0));
+        const double draw = std::min(input.draw_rate, 2.0 * std::min(expected, 1.0 - expected));
+        const auto& pair = input.crosstable[static_cast<size_t>(game.white_id) * engine_count +
+                                            static_cast<size_t>(game.black_id)];
+        const double weight = pair.games() + kPriorGames;
+        const double win_probability = (pair.wins + kPriorGames * (expected - draw / 2.0)) / weight;
+        const double draw_probability = (pair.draws + kPriorGames * draw) / weight;
+        white_ids.push_back(static_cast<std::uint32_t>(game.white_id));
+        black_ids.push_back(static_cast<std::uint32_t>(game.black_id));
+        win_cuts.push_back(Threshold(win_probability));
+        draw_cuts.push_back(Threshold(win_probability + draw_probability));
+    }
+
+    const size_t batches = (static_cast<size_t>(simulations_) + kLanes - 1) / kLanes;
+    const size_t thread_count = std::min(static_cast<size_t>(threads_), batches);
+    if (thread_count == 0) {
+        return result;
+    }
+    const std::uint64_t run_seed = SplitMix64(seed_ ^ static_cast<std::uint64_t>(input.games_played));
+    std::vector<std::vector<std::uint64_t>> place_counts(thread_count);
+    std::vector<std::vector<long long>> half_point_totals(thread_count);
+    std::atomic<bool> aborted{false};
+
+    const auto run = [&](size_t thread_index) {
+        auto& counts = place_counts[thread_index];
+        auto& totals = half_point_totals[thread_index];
+        counts.assign(engine_count * engine_count, 0);
+        totals.assign(engine_count, 0);
+        std::array<std::uint32_t, kLanes> state{};
+        std::array<std::int32_t, kLanes> half{};
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+            state[lane] = static_cast<std::uint32_t>(SplitMix64(run_seed + thread_index * kLanes + lane)) | 1;
+        }
+        std::vector<std::int32_t> points(engine_count * kLanes);
+        std::vector<long long> keys(engine_count);
+        const size_t first = batches * thread_index / thread_count;
+        const size_t last = batches * (thread_index + 1) / thread_count;
+        for (size_t batch = first; batch < last; ++batch) {
+            if (stop_.load(std::memory_order_relaxed)) {
+                aborted.store(true);
+                return;
+            }
+            for (size_t engine = 0; engine < engine_count; ++engine) {
+                std::fill_n(points.begin() + static_cast<std::ptrdiff_t>(engine * kLanes),
+                            kLanes,
+                            input.half_points[engine]);
+            }
+            for (size_t game = 0; game < white_ids.size(); ++game) {
+                std::int32_t* white = points.data() + white_ids[game] * kLanes;
+                std::int32_t* black = points.data() + black_ids[game] * kLanes;
+                const std::uint32_t win_cut = win_cuts[game];
+                const std::uint32_t draw_cut = draw_cuts[game];
+                for (size_t lane = 0; lane < kLanes; ++lane) {
+                    std::uint32_t x = state[lane];
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    state[lane] = x;
+                    half[lane] = static_cast<std::int32_t>(x <= win_cut) + static_cast<std::int32_t>(x <= draw_cut);
+                }
+                for (size_t lane = 0; lane < kLanes; ++lane) {
+                    white[lane] += half[lane];
+                }
+                for (size_t lane = 0; lane < kLanes; ++lane) {
+                    black[lane] += 2 - half[lane];
+                }
+            }
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                for (size_t engine = 0; engine < engine_count; ++engine) {
+                    const long long engine_points = points[engine * kLanes + lane];
+                    totals[engine] += engine_points;
+                    keys[engine] = engine_points * static_cast<long long>(engine_count) + tie_key[engine];
+                }
+                std::sort(keys.begin(), keys.end(), std::greater<long long>());
+                for (size_t place = 0; place < engine_count; ++place) {
+                    const auto tie = static_cast<size_t>(keys[place] % static_cast<long long>(engine_count));
+                    counts[static_cast<size_t>(engine_by_tie[tie]) * engine_count + place] += 1;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t thread_index = 1; thread_index < thread_count; ++thread_index) {
+        workers.emplace_back(run, thread_index);
+    }
+    run(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (aborted.load()) {
+        return result;
+    }
+
+    const size_t total = batches * kLanes;
+    result.simulations = static_cast<int>(total);
+    result.games_played = input.games_played;
+    result.remaining_games = static_cast<int>(white_ids.size());
+    result.place_probability.assign(engine_count * engine_count, 0.0);
+    result.expected_points.assign(engine_count, 0.0);
+    for (size_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+        for (size_t i = 0; i < engine_count * engine_count; ++i) {
+            result.place_probability[i] += static_cast<double>(place_counts[thread_index][i]);
+        }
+        for (size_t engine = 0; engine < engine_count; ++engine) {
+            result.expected_points[engine] += static_cast<double>(half_point_totals[thread_index][engine]);
+        }
+    }
+    for (auto& probability : result.place_probability) {
+        probability /= static_cast<double>(total);
+    }
+    for (auto& points : result.expected_points) {
+        points /= 2.0 * static_cast<double>(total);
+    }
+    return result;
+}
+
+}  // namespace ijccrl::core::stats
@@ -1,8 +1,14 @@
 #include "ijccrl/core/stats/StandingsTable.h"
 
+#include <cmath>
+
 namespace ijccrl::core::stats {
 
-StandingsTable::StandingsTable(std::vector<std::string> engine_names) {
+StandingsTable::StandingsTable(std::vector<std::string> engine_names)
+    : elo_(engine_names.size()),
+      crosstable_(engine_names.size() * engine_names.size()),
+      tie_breaks_(engine_names.size()),
+      search_(engine_names.size()) {
     standings_.reserve(engine_names.size());
     for (auto& name : engine_names) {
         EngineStats stats;
@@ -11,7 +17,24 @@ StandingsTable::StandingsTable(std::vector<std::string> engine_names) {
     }
 }
 
-void StandingsTable::RecordResult(int white_id, int black_id, const std::string& result) {
+namespace {
+
+double WhiteScore(const std::string& result) {
+    if (result == "1-0") {
+        return 1.0;
+    }
+    if (result == "0-1") {
+        return 0.0;
+    }
+    if (result == "1/2-1/2") {
+        return 0.5;
+    }
+    return -1.0;
+}
+
+}  // namespace
+
+void StandingsTable::RecordResult(int white_id, int black_id, const std::string& result, int pair_key) {
     if (white_id < 0 || black_id < 0 ||
         white_id >= static_cast<int>(standings_.size()) ||
         black_id >= static_cast<int>(standings_.size())) {
@@ -38,6 +61,98 @@ void StandingsTable::RecordResult(int white_id, int black_id, const std::string&
         white.points += 0.5;
         black.points += 0.5;
     }
+
+    RecordRating(white_id, black_id, result);
+    RecordHeadToHead(white_id, black_id, result);
+    tie_breaks_.AddGame(white_id, black_id, WhiteScore(result));
+    if (pair_key >= 0) {
+        RecordPairGame(pair_key, white_id, black_id, result);
+    }
+}
+
+void StandingsTable::RestoreResult(int white_id, int black_id, const std::string& result, int pair_key) {
+    RecordRating(white_id, black_id, result);
+    RecordHeadToHead(white_id, black_id, result);
+    tie_breaks_.AddGame(white_id, black_id, WhiteScore(result));
+    if (pair_key >= 0) {
+        RecordPairGame(pair_key, white_id, black_id, result);
+    }
+}
+
+int StandingsTable::UpdateRatings() {
+    const int iterations = elo_.Solve();
+    const auto& ratings = elo_.ratings();
+    for (size_t i = 0; i < standings_.size() && i < ratings.size(); ++i) {
+        standings_[i].elo = ratings[i].elo;
+        standings_[i].elo_error = ratings[i].error;
+    }
+    return iterations;
+}
+
+void StandingsTable::UpdateRanks() {
+    ranking_ = tie_breaks_.Rank(tie_break_order_);
+    for (size_t i = 0; i < ranking_.size(); ++i) {
+        const int id = ranking_[i];
+        auto& entry = standings_[static_cast<size_t>(id)];
+        entry.rank = static_cast<int>(i) + 1;
+        entry.buchholz = tie_breaks_.buchholz(id);
+        entry.sonneborn_berger = tie_breaks_.sonneborn_berger(id);
+        entry.koya = tie_breaks_.koya(id);
+    }
+}
+
+void StandingsTable::RecordRating(int white_id, int black_id, const std::string& result) {
+    const double white_score = WhiteScore(result);
+    if (white_score >= 0.0) {
+        elo_.AddResult(white_id, black_id, white_score);
+    }
+}
+
+void StandingsTable::RecordHeadToHead(int white_id, int black_id, const std::string& result) {
+    const size_t count = standings_.size();
+    if (white_id < 0 || black_id < 0 || white_id >= static_cast<int>(count) || black_id >= static_cast<int>(count)) {
+        return;
+    }
+    auto& white = crosstable_[static_cast<size_t>(white_id) * count + static_cast<size_t>(black_id)];
+    auto& black = crosstable_[static_cast<size_t>(black_id) * count + static_cast<size_t>(white_id)];
+    if (result == "1-0") {
+        white.wins += 1;
+        black.losses += 1;
+    } else if (result == "0-1") {
+        white.losses += 1;
+        black.wins += 1;
+    } else if (result == "1/2-1/2") {
+        white.draws += 1;
+        black.draws += 1;
+    }
+}
+
+void StandingsTable::RecordPairGame(int pair_key, int white_id, int black_id, const std::string& result) {
+    const double white_score = WhiteScore(result);
+    if (white_score < 0.0 || white_id < 0 || black_id < 0 ||
+        white_id >= static_cast<int>(standings_.size()) ||
+        black_id >= static_cast<int>(standings_.size())) {
+        return;
+    }
+
+    auto it = open_pairs_.find(pair_key);
+    if (it == open_pairs_.end()) {
+        open_pairs_.emplace(pair_key, OpenPair{white_id, black_id, white_score});
+        return;
+    }
+    const OpenPair first = it->second;
+    open_pairs_.erase(it);
+    if (first.white_id != black_id || first.black_id != white_id) {
+        return;
+    }
+
+    const double first_white_total = first.white_score + (1.0 - white_score);
+    const int bucket = static_cast<int>(std::lround(first_white_total * 2.0));
+    if (bucket < 0 || bucket > 4) {
+        return;
+    }
+    standings_[static_cast<size_t>(first.white_id)].pentanomial[static_cast<size_t>(bucket)] += 1;
+    standings_[static_cast<size_t>(first.black_id)].pentanomial[static_cast<size_t>(4 - bucket)] += 1;
 }
 
 void StandingsTable::RecordBye(int engine_id, double points) {
@@ -50,10 +165,30 @@ void StandingsTable::RecordBye(int engine_id, double points) {
     entry.draws += points > 0.0 && points < 1.0 ? 1 : 0;
     entry.points += points;
     games_played_ += 1;
+    tie_breaks_.AddBye(engine_id, points);
+}
+
+void StandingsTable::RecordSearch(int engine_id, const GameSearchStats& search) {
+    if (engine_id < 0 || engine_id >= static_cast<int>(standings_.size())) {
+        return;
+    }
+    auto& aggregate = search_[static_cast<size_t>(engine_id)];
+    aggregate.Add(search);
+    standings_[static_cast<size_t>(engine_id)].search = aggregate.Summarize();
+}
+
+void StandingsTable::RestoreBye(int engine_id, double points) {
+    tie_breaks_.AddBye(engine_id, points);
 }
 
 void StandingsTable::LoadSnapshot(std::vector<EngineStats> snapshot) {
     standings_ = std::move(snapshot);
+    open_pairs_.clear();
+    elo_ = EloEstimator(standings_.size());
+    crosstable_.assign(standings_.size() * standings_.size(), HeadToHead{});
+    tie_breaks_ = TieBreaks(standings_.size());
+    search_.assign(standings_.size(), SearchAggregate{});
+    ranking_.clear();
     int total_engine_games = 0;
     for (const auto& entry : standings_) {
         total_engine_games += entry.games;
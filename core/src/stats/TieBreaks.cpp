@@ -0,0 +1,178 @@
+#include "ijccrl/core/stats/TieBreaks.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace ijccrl::core::stats {
+
+TieBreaks::TieBreaks(size_t engine_count) : players_(engine_count) {}
+
+void TieBreaks::AddGame(int white_id, int black_id, double white_score) {
+    const int count = static_cast<int>(players_.size());
+    if (white_id < 0 || black_id < 0 || white_id == black_id || white_id >= count || black_id >= count ||
+        white_score < 0.0 || white_score > 1.0) {
+        return;
+    }
+    const double black_score = 1.0 - white_score;
+    AddPoints(white_id, white_score);
+    AddPoints(black_id, black_score);
+
+    auto& white_meeting = MeetingWith(white_id, black_id);
+    white_meeting.games += 1;
+    white_meeting.score += white_score;
+    auto& black_meeting = MeetingWith(black_id, white_id);
+    black_meeting.games += 1;
+    black_meeting.score += black_score;
+
+    auto& white = players_[static_cast<size_t>(white_id)];
+    auto& black = players_[static_cast<size_t>(black_id)];
+    white.buchholz += black.points;
+    black.buchholz += white.points;
+    white.sonneborn_berger += white_score * black.points;
+    black.sonneborn_berger += black_score * white.points;
+    if (black.koya_qualified) {
+        white.koya += white_score;
+    }
+    if (white.koya_qualified) {
+        black.koya += black_score;
+    }
+}
+
+void TieBreaks::AddBye(int engine_id, double points) {
+    if (engine_id < 0 || engine_id >= static_cast<int>(players_.size())) {
+        return;
+    }
+    AddPoints(engine_id, points);
+}
+
+// Counts one more game for engine_id and pushes the point change to the
+// opponents it has already met. The new game's own contributions are added
+// by the caller once both players are updated.
+void TieBreaks::AddPoints(int engine_id, double points) {
+    auto& player = players_[static_cast<size_t>(engine_id)];
+    player.points += points;
+    player.games += 1;
+    const bool qualified = 2.0 * player.points >= player.games;
+    const bool flipped = qualified != player.koya_qualified;
+    player.koya_qualified = qualified;
+    if (points == 0.0 && !flipped) {
+        return;
+    }
+    for (const auto& meeting : player.meetings) {
+        auto& opponent = players_[static_cast<size_t>(meeting.opponent)];
+        const double opponent_score = meeting.games - meeting.score;
+        opponent.buchholz += points * meeting.games;
+        opponent.sonneborn_berger += points * opponent_score;
+        if (flipped) {
+            opponent.koya += qualified ? opponent_score : -opponent_score;
+        }
+    }
+}
+
+TieBreaks::Meeting& TieBreaks::MeetingWith(int engine_id, int opponent_id) {
+    auto& meetings = players_[static_cast<size_t>(engine_id)].meetings;
+    for (auto& meeting : meetings) {
+        if (meeting.opponent == opponent_id) {
+            return meeting;
+        }
+    }
+    meetings.push_back({opponent_id, 0, 0.0});
+    return meetings.back();
+}
+
+std::vector<int> TieBreaks::Rank(const std::vector<TieBreak>& order) const {
+    std::vector<int> ranking(players_.size());
+    std::iota(ranking.begin(), ranking.end(), 0);
+
+    // Groups of players still tied, refined one criterion at a time; the
+    // final stable sort keeps engine id order inside groups that never split.
+    std::vector<double> key(players_.size(), 0.0);
+    std::vector<size_t> group_stamp(players_.size(), 0);
+    size_t stamp = 0;
+    const auto refine = [&](size_t begin, size_t end, const auto& next) {
+        std::stable_sort(ranking.begin() + static_cast<std::ptrdiff_t>(begin),
+                         ranking.begin() + static_cast<std::ptrdiff_t>(end),
+                         [&](int a, int b) { return key[static_cast<size_t>(a)] > key[static_cast<size_t>(b)]; });
+        for (size_t group = begin; group < end;) {
+            size_t group_end = group + 1;
+            while (group_end < end && key[static_cast<size_t>(ranking[group_end])] ==
+                                          key[static_cast<size_t>(ranking[group])]) {
+                ++group_end;
+            }
+            if (group_end - group > 1) {
+                next(group, group_end);
+            }
+            group = group_end;
+        }
+    };
+
+    std::function<void(size_t, size_t, size_t)> apply = [&](size_t begin, size_t end, size_t level) {
+        const auto next = [&](size_t group, size_t group_end) { apply(group, group_end, level + 1); };
+        const bool direct = level >= 1 && level <= order.size() && order[level - 1] == TieBreak::kDirectEncounter;
+        if (direct) {
+            stamp += 1;
+            for (size_t i = begin; i < end; ++i) {
+                group_stamp[static_cast<size_t>(ranking[i])] = stamp;
+            }
+        }
+        for (size_t i = begin; i < end; ++i) {
+            const int id = ranking[i];
+            const auto& player = players_[static_cast<size_t>(id)];
+            double value = 0.0;
+            if (level == 0) {
+                value = player.points;
+            } else if (level > order.size()) {
+                value = -static_cast<double>(player.games);
+            } else {
+                switch (order[level - 1]) {
+                    case TieBreak::kBuchholz:
+                        value = player.buchholz;
+                        break;
+                    case TieBreak::kSonnebornBerger:
+                        value = player.sonneborn_berger;
+                        break;
+                    case TieBreak::kKoya:
+                        value = player.koya;
+                        break;
+                    case TieBreak::kDirectEncounter:
+                        for (const auto& meeting : player.meetings) {
+                            if (group_stamp[static_cast<size_t>(meeting.opponent)] == stamp) {
+                                value += meeting.score;
+                            }
+                        }
+                        break;
+                }
+            }
+            key[static_cast<size_t>(id)] = value;
+        }
+        if (level > order.size()) {
+            refine(begin, end, [](size_t, size_t) {});
+        } else {
+            refine(begin, end, next);
+        }
+    };
+    apply(0, ranking.size(), 0);
+    return ranking;
+}
+
+bool TieBreaks::Parse(const std::string& name, TieBreak* tie_break) {
+    if (name == "buchholz") {
+        *tie_break = TieBreak::kBuchholz;
+    } else if (name == "sonneborn_berger") {
+        *tie_break = TieBreak::kSonnebornBerger;
+    } else if (name == "direct_encounter") {
+        *tie_break = TieBreak::kDirectEncounter;
+    } else if (name == "koya") {
+        *tie_break = TieBreak::kKoya;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::vector<TieBreak> TieBreaks::DefaultOrder() {
+    return {TieBreak::kBuchholz, TieBreak::kSonnebornBerger, TieBreak::kDirectEncounter, TieBreak::kKoya};
+}
+
+}  // namespace ijccrl::core::stats
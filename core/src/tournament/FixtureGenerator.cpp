@@ -0,0 +1,158 @@
+#include "ijccrl/core/tournament/FixtureGenerator.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace ijccrl::core::tournament {
+
+namespace {
+
+std::string PairingIdFor(int a, int b) {
+    const int low = std::min(a, b);
+    const int high = std::max(a, b);
+    std::ostringstream out;
+    out << "pair_" << low << "_" << high;
+    return out.str();
+}
+
+Fixture MakeFixture(int round_index, int white, int black, int game_index) {
+    const bool swap_for_game = (game_index % 2 == 1);
+    Fixture fixture;
+    fixture.round_index = round_index;
+    fixture.white_engine_id = swap_for_game ? black : white;
+    fixture.black_engine_id = swap_for_game ? white : black;
+    fixture.game_index_within_pairing = game_index;
+    fixture.pairing_id = PairingIdFor(white, black);
+    return fixture;
+}
+
+}  // namespace
+
+FixtureGenerator FixtureGenerator::RoundRobin(int engine_count,
+                                              bool double_round_robin,
+                                              int games_per_pairing,
+                                              int repeat_count) {
+    FixtureGenerator generator;
+    generator.kind_ = Kind::RoundRobin;
+    if (engine_count < 2 || games_per_pairing < 1 || repeat_count < 1) {
+        return generator;
+    }
+    generator.engine_count_ = engine_count;
+    generator.team_count_ = engine_count + (engine_count % 2);
+    generator.games_per_pairing_ = games_per_pairing;
+    generator.rounds_per_cycle_ = generator.team_count_ - 1;
+    generator.fixtures_per_round_ = (engine_count / 2) * games_per_pairing;
+    const int cycles = double_round_robin ? 2 : 1;
+    generator.size_ = generator.rounds_per_cycle_ * generator.fixtures_per_round_ * cycles * repeat_count;
+    return generator;
+}
+
+FixtureGenerator FixtureGenerator::Gauntlet(int engine_count,
+                                            const std::vector<int>& gauntlet_engine_ids,
+                                            int games_per_pairing,
+                                            int repeat_count) {
+    FixtureGenerator generator;
+    generator.kind_ = Kind::Gauntlet;
+    if (engine_count < 2 || games_per_pairing < 1 || repeat_count < 1) {
+        return generator;
+    }
+
+    std::vector<bool> is_gauntlet(static_cast<size_t>(engine_count), false);
+    for (int id : gauntlet_engine_ids) {
+        if (id >= 0 && id < engine_count && !is_gauntlet[static_cast<size_t>(id)]) {
+            is_gauntlet[static_cast<size_t>(id)] = true;
+            generator.players_.push_back(id);
+        }
+    }
+    if (generator.players_.empty()) {
+        is_gauntlet[0] = true;
+        generator.players_.push_back(0);
+    }
+    for (int id = 0; id < engine_count; ++id) {
+        if (!is_gauntlet[static_cast<size_t>(id)]) {
+            generator.opponents_.push_back(id);
+        }
+    }
+    if (generator.opponents_.empty()) {
+        return generator;
+    }
+
+    generator.engine_count_ = engine_count;
+    generator.games_per_pairing_ = games_per_pairing;
+    generator.rounds_per_cycle_ = static_cast<int>(generator.opponents_.size());
+    generator.fixtures_per_round_ = static_cast<int>(generator.players_.size()) * games_per_pairing;
+    generator.size_ = generator.rounds_per_cycle_ * generator.fixtures_per_round_ * repeat_count;
+    return generator;
+}
+
+int FixtureGenerator::round_count() const {
+    if (size_ == 0) {
+        return 0;
+    }
+    return At(size_ - 1).round_index + 1;
+}
+
+Fixture FixtureGenerator::At(int index) const {
+    if (index < 0 || index >= size_) {
+        return Fixture{};
+    }
+    return kind_ == Kind::Gauntlet ? GauntletAt(index) : RoundRobinAt(index);
+}
+
+// Circle method: team 0 stays at position 0 while the rest rotate one step per
+// round, so the team at any position is a closed-form function of the round.
+int FixtureGenerator::TeamAt(int position, int round) const {
+    if (position == 0) {
+        return 0;
+    }
+    const int span = team_count_ - 1;
+    const int original = ((position - 1 - round) % span + span) % span + 1;
+    return original < engine_count_ ? original : -1;
+}
+
+Fixture FixtureGenerator::RoundRobinAt(int index) const {
+    const int cycle_size = rounds_per_cycle_ * fixtures_per_round_;
+    const int block = index / cycle_size;
+    const int offset = index % cycle_size;
+    const int round = offset / fixtures_per_round_;
+    const int within = offset % fixtures_per_round_;
+    int board = within / games_per_pairing_;
+    const int game = within % games_per_pairing_;
+
+    if (engine_count_ % 2 == 1) {
+        const int bye_position = (engine_count_ - 1 + round) % rounds_per_cycle_ + 1;
+        const int bye_board = bye_position < team_count_ / 2 ? bye_position : team_count_ - 1 - bye_position;
+        if (board >= bye_board) {
+            ++board;
+        }
+    }
+
+    const int t1 = TeamAt(board, round);
+    const int t2 = TeamAt(team_count_ - 1 - board, round);
+    bool swap_colors = (round % 2 == 1);
+    if (board == 0) {
+        swap_colors = !swap_colors;
+    }
+    const int white = swap_colors ? t2 : t1;
+    const int black = swap_colors ? t1 : t2;
+    return MakeFixture(round + block * rounds_per_cycle_, white, black, game);
+}
+
+Fixture FixtureGenerator::GauntletAt(int index) const {
+    const int cycle_size = rounds_per_cycle_ * fixtures_per_round_;
+    const int repeat = index / cycle_size;
+    const int offset = index % cycle_size;
+    const int round = offset / fixtures_per_round_;
+    const int within = offset % fixtures_per_round_;
+    const int slot = within / games_per_pairing_;
+    const int game = within % games_per_pairing_;
+
+    const int player = players_[static_cast<size_t>(slot)];
+    const int opponent = opponents_[static_cast<size_t>(round + slot) % opponents_.size()];
+    const bool player_white = ((round + repeat + slot) % 2 == 0);
+    const int white = player_white ? player : opponent;
+    const int black = player_white ? opponent : player;
+    return MakeFixture(repeat * rounds_per_cycle_ + round, white, black, game);
+}
+
+}  // namespace ijccrl::core::tournament
@@ -0,0 +1,39 @@
+#include "ijccrl/core/tournament/GauntletScheduler.h"
+
+#include "ijccrl/core/tournament/FixtureGenerator.h"
+
+namespace ijccrl::core::tournament {
+
+std::vector<Fixture> GauntletScheduler::BuildSchedule(int engine_count,
+                                                      const std::vector<int>& gauntlet_engine_ids,
+                                                      int games_per_pairing,
+                                                      int repeat_count) {
+    const auto generator =
+        FixtureGenerator::Gauntlet(engine_count, gauntlet_engine_ids, games_per_pairing, repeat_count);
+    std::vector<Fixture> fixtures;
+    fixtures.reserve(static_cast<size_t>(generator.size()));
+    for (int i = 0; i < generator.size(); ++i) {
+        fixtures.push_back(generator.At(i));
+    }
+    return fixtures;
+}
+
+TournamentRound GauntletScheduler::BuildRound(const TournamentContext& context) {
+    TournamentRound round;
+    round.round_index = context.round_index;
+    if (context.engine_count < 2) {
+        return round;
+    }
+    const auto fixtures = BuildSchedule(context.engine_count,
+                                        context.gauntlet_engine_ids,
+                                        context.games_per_pairing,
+                                        context.repeat_count);
+    for (const auto& fixture : fixtures) {
+        if (fixture.round_index == context.round_index) {
+            round.fixtures.push_back(fixture);
+        }
+    }
+    return round;
+}
+
+}  // namespace ijccrl::core::tournament
@@ -1,12 +1,32 @@
 #include "ijccrl/core/tournament/SwissScheduler.h"
 
+#include "ijccrl/core/tournament/WeightedMatching.h"
+
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
 #include <sstream>
 
 namespace ijccrl::core::tournament {
 
 namespace {
 
+// Pairing criteria are folded into a single edge weight, most important first:
+// repeated pairings and byes, score difference, colour conflicts, and finally
+// the Dutch S1/S2 order inside a score group. Large rounds only get edges near
+// each player's rank and Dutch partner; the window widens if that fails.
+constexpr std::int64_t kBaseWeight = 100'000'000'000'000'000;
+constexpr std::int64_t kRepeatPenalty = 10'000'000'000'000'000;
+constexpr std::int64_t kScoreDiffUnit = 10'000'000'000;
+constexpr std::int64_t kMaxScoreDiffSquared = 400;
+constexpr std::int64_t kColorUnit = 100'000;
+constexpr int kCandidateWindow = 8;
+
+std::int64_t HalfPoints(double points) {
+    return std::llround(points * 2.0);
+}
+
 long long PairKey(int a, int b) {
     const int low = std::min(a, b);
     const int high = std::max(a, b);
@@ -59,130 +79,280 @@ std::pair<int, int> ChooseColors(int a,
     return {b, a};
 }
 
-}  // namespace
-
-SwissRound SwissScheduler::BuildSwissRound(int round_index,
-                                           const std::vector<double>& scores,
-                                           const std::vector<std::vector<int>>& opponent_history,
-                                           const std::vector<int>& bye_history,
-                                           const std::vector<SwissColorState>& color_history,
-                                           const std::unordered_set<long long>& pairings_played,
-                                           int games_per_pairing,
-                                           bool avoid_repeats) {
-    SwissRound result;
-    result.round.round_index = round_index;
+void PairParticipants(int round_index,
+                      const std::vector<int>& participants,
+                      const std::vector<double>& scores,
+                      const std::vector<int>& ranking,
+                      const std::vector<int>& bye_history,
+                      const std::vector<SwissColorState>& color_history,
+                      const std::unordered_set<long long>& pairings_played,
+                      int games_per_pairing,
+                      bool avoid_repeats,
+                      SwissRound& result) {
     const int engine_count = static_cast<int>(scores.size());
-    if (engine_count < 2) {
-        return result;
-    }
-
     struct PlayerEntry {
         int engine_id = -1;
         double points = 0.0;
-        double buchholz = 0.0;
+        int position = 0;
     };
 
-    std::vector<PlayerEntry> players;
-    players.reserve(static_cast<size_t>(engine_count));
+    std::vector<int> position(static_cast<size_t>(engine_count));
     for (int i = 0; i < engine_count; ++i) {
-        double buchholz = 0.0;
-        for (int opp : opponent_history[static_cast<size_t>(i)]) {
-            if (opp >= 0 && opp < engine_count) {
-                buchholz += scores[static_cast<size_t>(opp)];
-            }
+        position[static_cast<size_t>(i)] = static_cast<int>(ranking.size()) + i;
+    }
+    for (size_t i = 0; i < ranking.size(); ++i) {
+        if (ranking[i] >= 0 && ranking[i] < engine_count) {
+            position[static_cast<size_t>(ranking[i])] = static_cast<int>(i);
         }
-        players.push_back({i, scores[static_cast<size_t>(i)], buchholz});
+    }
+
+    std::vector<PlayerEntry> players;
+    players.reserve(participants.size());
+    for (int i : participants) {
+        players.push_back({i, scores[static_cast<size_t>(i)], position[static_cast<size_t>(i)]});
     }
 
     std::stable_sort(players.begin(), players.end(), [](const auto& a, const auto& b) {
         if (a.points != b.points) {
             return a.points > b.points;
         }
-        if (a.buchholz != b.buchholz) {
-            return a.buchholz > b.buchholz;
-        }
-        return a.engine_id < b.engine_id;
+        return a.position < b.position;
     });
 
-    if (engine_count % 2 == 1) {
-        for (auto it = players.rbegin(); it != players.rend(); ++it) {
-            const int engine_id = it->engine_id;
-            if (std::find(bye_history.begin(), bye_history.end(), engine_id) == bye_history.end()) {
-                result.round.bye_engine_id = engine_id;
-                players.erase(std::next(it).base());
-                break;
-            }
+    std::vector<int> group_start(players.size(), 0);
+    std::vector<int> group_size(players.size(), 0);
+    for (size_t begin = 0; begin < players.size();) {
+        size_t end = begin;
+        while (end < players.size() && players[end].points == players[begin].points) {
+            ++end;
         }
-        if (!result.round.bye_engine_id.has_value() && !players.empty()) {
-            result.round.bye_engine_id = players.back().engine_id;
-            players.pop_back();
+        for (size_t i = begin; i < end; ++i) {
+            group_start[i] = static_cast<int>(begin);
+            group_size[i] = static_cast<int>(end - begin);
         }
+        begin = end;
     }
 
-    std::vector<std::vector<int>> groups;
-    for (const auto& entry : players) {
-        if (groups.empty() || entry.points != scores[static_cast<size_t>(groups.back().front())]) {
-            groups.emplace_back();
-        }
-        groups.back().push_back(entry.engine_id);
-    }
+    const int player_count = static_cast<int>(players.size());
+    const bool needs_bye = player_count % 2 == 1;
+    const int vertex_count = player_count + (needs_bye ? 1 : 0);
+    const int bye_vertex = player_count;
 
-    std::vector<int> carry;
-    for (size_t group_index = 0; group_index < groups.size(); ++group_index) {
-        std::vector<int> list;
-        list.reserve(carry.size() + groups[group_index].size());
-        list.insert(list.end(), carry.begin(), carry.end());
-        list.insert(list.end(), groups[group_index].begin(), groups[group_index].end());
-        carry.clear();
-
-        while (list.size() >= 2) {
-            const int a = list.front();
-            list.erase(list.begin());
-            int opponent_index = -1;
-            for (size_t i = 0; i < list.size(); ++i) {
-                const int b = list[i];
-                const long long key = PairKey(a, b);
-                if (!avoid_repeats || pairings_played.count(key) == 0) {
-                    opponent_index = static_cast<int>(i);
-                    break;
+    std::vector<std::pair<int, int>> candidates;
+    std::vector<int> mates;
+    for (int window : {kCandidateWindow, kCandidateWindow * 4, player_count}) {
+        candidates.clear();
+        for (int i = 0; i < player_count; ++i) {
+            const int partner = group_size[static_cast<size_t>(i)] / 2;
+            const int ideal = group_start[static_cast<size_t>(i)] +
+                              (i - group_start[static_cast<size_t>(i)] + partner) %
+                                  std::max(1, group_size[static_cast<size_t>(i)]);
+            for (int j = i + 1; j <= std::min(player_count - 1, i + window); ++j) {
+                candidates.emplace_back(i, j);
+            }
+            for (int j = std::max(i + 1, ideal - window); j <= std::min(player_count - 1, ideal + window); ++j) {
+                if (j > i + window) {
+                    candidates.emplace_back(i, j);
                 }
             }
-            if (opponent_index < 0) {
-                if (avoid_repeats && group_index + 1 < groups.size()) {
-                    carry.push_back(a);
-                    continue;
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        std::vector<MatchingEdge> edges;
+        edges.reserve(candidates.size() + (needs_bye ? players.size() : 0));
+        for (const auto& [i, j] : candidates) {
+            const int a = players[static_cast<size_t>(i)].engine_id;
+            const int b = players[static_cast<size_t>(j)].engine_id;
+            std::int64_t penalty = 0;
+            if (avoid_repeats && pairings_played.count(PairKey(a, b)) > 0) {
+                penalty += kRepeatPenalty;
+            }
+            const std::int64_t score_diff = HalfPoints(players[static_cast<size_t>(i)].points) -
+                                            HalfPoints(players[static_cast<size_t>(j)].points);
+            penalty += std::min<std::int64_t>(score_diff * score_diff, kMaxScoreDiffSquared) * kScoreDiffUnit;
+            const auto& a_state = color_history[static_cast<size_t>(a)];
+            const auto& b_state = color_history[static_cast<size_t>(b)];
+            const int color_penalty = std::min(ColorPenalty(a_state, 1) + ColorPenalty(b_state, -1),
+                                               ColorPenalty(a_state, -1) + ColorPenalty(b_state, 1));
+            penalty += static_cast<std::int64_t>(color_penalty) * kColorUnit;
+            if (group_start[static_cast<size_t>(i)] == group_start[static_cast<size_t>(j)]) {
+                penalty += std::abs(j - i - group_size[static_cast<size_t>(i)] / 2);
+            } else {
+                penalty += j - group_start[static_cast<size_t>(j)];
+            }
+            edges.push_back({i, j, kBaseWeight - penalty});
+        }
+        if (needs_bye) {
+            for (int i = 0; i < player_count; ++i) {
+                const int engine_id = players[static_cast<size_t>(i)].engine_id;
+                std::int64_t penalty =
+                    HalfPoints(players[static_cast<size_t>(i)].points) * kScoreDiffUnit + (player_count - 1 - i);
+                if (std::find(bye_history.begin(), bye_history.end(), engine_id) != bye_history.end()) {
+                    penalty += kRepeatPenalty;
                 }
-                opponent_index = 0;
+                edges.push_back({i, bye_vertex, kBaseWeight - penalty});
             }
+        }
 
-            const int b = list[static_cast<size_t>(opponent_index)];
-            list.erase(list.begin() + opponent_index);
-
-            const auto colors = ChooseColors(a, b, color_history);
-            const int white = colors.first;
-            const int black = colors.second;
-            const std::string pairing_id = PairingIdFor(a, b);
-            result.pairings.emplace_back(a, b);
-            for (int g = 0; g < games_per_pairing; ++g) {
-                Fixture fixture;
-                fixture.round_index = round_index;
-                fixture.game_index_within_pairing = g;
-                fixture.white_engine_id = (g % 2 == 0) ? white : black;
-                fixture.black_engine_id = (g % 2 == 0) ? black : white;
-                fixture.pairing_id = pairing_id;
-                result.round.fixtures.push_back(std::move(fixture));
+        mates = MaxWeightMatching(vertex_count, edges, true);
+        bool complete = true;
+        for (int i = 0; i < player_count && complete; ++i) {
+            const int mate = mates[static_cast<size_t>(i)];
+            if (mate < 0) {
+                complete = false;
+            } else if (avoid_repeats && mate != bye_vertex &&
+                       pairings_played.count(PairKey(players[static_cast<size_t>(i)].engine_id,
+                                                     players[static_cast<size_t>(mate)].engine_id)) > 0) {
+                complete = false;
             }
         }
+        if (complete || window >= player_count) {
+            break;
+        }
+    }
+
+    for (int i = 0; i < player_count; ++i) {
+        const int mate = mates[static_cast<size_t>(i)];
+        if (mate == bye_vertex || (mate < 0 && !result.round.bye_engine_id.has_value())) {
+            result.round.bye_engine_id = players[static_cast<size_t>(i)].engine_id;
+            continue;
+        }
+        if (mate < i) {
+            continue;
+        }
 
-        if (!list.empty()) {
-            carry.push_back(list.front());
+        const int a = players[static_cast<size_t>(i)].engine_id;
+        const int b = players[static_cast<size_t>(mate)].engine_id;
+        const auto colors = ChooseColors(a, b, color_history);
+        const int white = colors.first;
+        const int black = colors.second;
+        const std::string pairing_id = PairingIdFor(a, b);
+        result.pairings.emplace_back(a, b);
+        for (int g = 0; g < games_per_pairing; ++g) {
+            Fixture fixture;
+            fixture.round_index = round_index;
+            fixture.game_index_within_pairing = g;
+            fixture.white_engine_id = (g % 2 == 0) ? white : black;
+            fixture.black_engine_id = (g % 2 == 0) ? black : white;
+            fixture.pairing_id = pairing_id;
+            result.round.fixtures.push_back(std::move(fixture));
         }
     }
+}
+
+}  // namespace
 
-    if (!carry.empty() && !result.round.bye_engine_id.has_value()) {
-        result.round.bye_engine_id = carry.front();
+SwissRound SwissScheduler::BuildSwissRound(int round_index,
+                                           const std::vector<double>& scores,
+                                           const std::vector<int>& ranking,
+                                           const std::vector<int>& bye_history,
+                                           const std::vector<SwissColorState>& color_history,
+                                           const std::unordered_set<long long>& pairings_played,
+                                           int games_per_pairing,
+                                           bool avoid_repeats,
+                                           const std::vector<bool>& excluded) {
+    SwissRound result;
+    result.round.round_index = round_index;
+    std::vector<int> participants;
+    participants.reserve(scores.size());
+    for (int i = 0; i < static_cast<int>(scores.size()); ++i) {
+        if (static_cast<size_t>(i) >= excluded.size() || !excluded[static_cast<size_t>(i)]) {
+            participants.push_back(i);
+        }
+    }
+    if (participants.size() < 2) {
+        if (participants.size() == 1) {
+            result.round.bye_engine_id = participants.front();
+        }
+        return result;
     }
+    PairParticipants(round_index,
+                     participants,
+                     scores,
+                     ranking,
+                     bye_history,
+                     color_history,
+                     pairings_played,
+                     games_per_pairing,
+                     avoid_repeats,
+                     result);
+    return result;
+}
 
+SwissRound SwissScheduler::BuildEarlyPairings(int round_index,
+                                              const std::vector<double>& scores,
+                                              const std::vector<double>& pending_points,
+                                              const std::vector<bool>& excluded,
+                                              const std::vector<int>& ranking,
+                                              const std::vector<SwissColorState>& color_history,
+                                              const std::unordered_set<long long>& pairings_played,
+                                              int games_per_pairing,
+                                              bool avoid_repeats) {
+    SwissRound result;
+    result.round.round_index = round_index;
+    const int engine_count = static_cast<int>(scores.size());
+
+    std::vector<int> unfinished;
+    for (int i = 0; i < engine_count; ++i) {
+        if (pending_points[static_cast<size_t>(i)] > 0.0) {
+            unfinished.push_back(i);
+        }
+    }
+
+    std::map<std::int64_t, std::vector<int>> settled_groups;
+    for (int i = 0; i < engine_count; ++i) {
+        if (pending_points[static_cast<size_t>(i)] > 0.0 ||
+            (static_cast<size_t>(i) < excluded.size() && excluded[static_cast<size_t>(i)])) {
+            continue;
+        }
+        const std::int64_t score = HalfPoints(scores[static_cast<size_t>(i)]);
+        bool reachable = false;
+        for (int other : unfinished) {
+            const std::int64_t low = HalfPoints(scores[static_cast<size_t>(other)]);
+            const std::int64_t high = low + HalfPoints(pending_points[static_cast<size_t>(other)]);
+            if (score >= low && score <= high) {
+                reachable = true;
+                break;
+            }
+        }
+        if (!reachable) {
+            settled_groups[score].push_back(i);
+        }
+    }
+
+    const std::vector<int> no_byes;
+    for (const auto& [score, group] : settled_groups) {
+        (void)score;
+        if (group.size() < 2 || group.size() % 2 != 0) {
+            continue;
+        }
+        SwissRound group_round;
+        PairParticipants(round_index,
+                         group,
+                         scores,
+                         ranking,
+                         no_byes,
+                         color_history,
+                         pairings_played,
+                         games_per_pairing,
+                         avoid_repeats,
+                         group_round);
+        const bool repeats = avoid_repeats &&
+                             std::any_of(group_round.pairings.begin(),
+                                         group_round.pairings.end(),
+                                         [&](const auto& pairing) {
+                                             return pairings_played.count(
+                                                        PairKey(pairing.first, pairing.second)) > 0;
+                                         });
+        if (repeats) {
+            continue;
+        }
+        result.pairings.insert(result.pairings.end(), group_round.pairings.begin(), group_round.pairings.end());
+        for (auto& fixture : group_round.round.fixtures) {
+            result.round.fixtures.push_back(std::move(fixture));
+        }
+    }
     return result;
 }
 
@@ -197,7 +367,7 @@ TournamentRound SwissScheduler::BuildRound(const TournamentContext& context) {
     std::vector<SwissColorState> color_history(context.engine_count);
     SwissRound swiss_round = BuildSwissRound(context.round_index,
                                              context.scores,
-                                             context.opponents,
+                                             {},
                                              context.bye_history,
                                              color_history,
                                              pairings_played,
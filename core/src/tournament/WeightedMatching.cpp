@@ -0,0 +1,578 @@
+#include "ijccrl/core/tournament/WeightedMatching.h"
+
+#include <algorithm>
+
+namespace ijccrl::core::tournament {
+
+namespace {
+
+// Port of the primal-dual formulation by Galil ("Efficient algorithms for
+// finding maximum matching in graphs", 1986). Vertices are 0..n-1, blossoms
+// n..2n-1; edge endpoints are addressed as 2*k (u side) and 2*k+1 (v side).
+class BlossomMatcher {
+public:
+    BlossomMatcher(int vertex_count, const std::vector<MatchingEdge>& edges, bool max_cardinality)
+        : n_(vertex_count),
+          edges_(edges),
+          max_cardinality_(max_cardinality),
+          endpoint_(2 * edges.size()),
+          neighbend_(static_cast<size_t>(vertex_count)),
+          mate_(static_cast<size_t>(vertex_count), -1),
+          label_(static_cast<size_t>(2 * vertex_count), 0),
+          labelend_(static_cast<size_t>(2 * vertex_count), -1),
+          inblossom_(static_cast<size_t>(vertex_count)),
+          blossomparent_(static_cast<size_t>(2 * vertex_count), -1),
+          blossomchilds_(static_cast<size_t>(2 * vertex_count)),
+          blossombase_(static_cast<size_t>(2 * vertex_count), -1),
+          blossomendps_(static_cast<size_t>(2 * vertex_count)),
+          bestedge_(static_cast<size_t>(2 * vertex_count), -1),
+          blossombestedges_(static_cast<size_t>(2 * vertex_count)),
+          has_blossombestedges_(static_cast<size_t>(2 * vertex_count), false),
+          dualvar_(static_cast<size_t>(2 * vertex_count), 0),
+          allowedge_(edges.size(), false) {
+        std::int64_t max_weight = 0;
+        for (size_t k = 0; k < edges_.size(); ++k) {
+            const auto& edge = edges_[k];
+            endpoint_[2 * k] = edge.u;
+            endpoint_[2 * k + 1] = edge.v;
+            neighbend_[static_cast<size_t>(edge.u)].push_back(static_cast<int>(2 * k + 1));
+            neighbend_[static_cast<size_t>(edge.v)].push_back(static_cast<int>(2 * k));
+            max_weight = std::max(max_weight, edge.weight);
+        }
+        for (int v = 0; v < n_; ++v) {
+            inblossom_[static_cast<size_t>(v)] = v;
+            blossombase_[static_cast<size_t>(v)] = v;
+            dualvar_[static_cast<size_t>(v)] = max_weight;
+        }
+        for (int b = 2 * n_ - 1; b >= n_; --b) {
+            unusedblossoms_.push_back(b);
+        }
+    }
+
+    std::vector<int> Solve() {
+        if (edges_.empty()) {
+            return mate_;
+        }
+        for (int stage = 0; stage < n_; ++stage) {
+            std::fill(label_.begin(), label_.end(), 0);
+            std::fill(bestedge_.begin(), bestedge_.end(), -1);
+            for (int b = n_; b < 2 * n_; ++b) {
+                blossombestedges_[static_cast<size_t>(b)].clear();
+                has_blossombestedges_[static_cast<size_t>(b)] = false;
+            }
+            std::fill(allowedge_.begin(), allowedge_.end(), false);
+            queue_.clear();
+
+            for (int v = 0; v < n_; ++v) {
+                if (mate_[static_cast<size_t>(v)] == -1 && label_[At(inblossom_, v)] == 0) {
+                    AssignLabel(v, 1, -1);
+                }
+            }
+
+            bool augmented = false;
+            while (true) {
+                while (!queue_.empty() && !augmented) {
+                    const int v = queue_.back();
+                    queue_.pop_back();
+                    for (int p : neighbend_[static_cast<size_t>(v)]) {
+                        const int k = p / 2;
+                        const int w = endpoint_[static_cast<size_t>(p)];
+                        if (inblossom_[static_cast<size_t>(v)] == inblossom_[static_cast<size_t>(w)]) {
+                            continue;
+                        }
+                        std::int64_t kslack = 0;
+                        if (!allowedge_[static_cast<size_t>(k)]) {
+                            kslack = Slack(k);
+                            if (kslack <= 0) {
+                                allowedge_[static_cast<size_t>(k)] = true;
+                            }
+                        }
+                        if (allowedge_[static_cast<size_t>(k)]) {
+                            if (label_[At(inblossom_, w)] == 0) {
+                                AssignLabel(w, 2, p ^ 1);
+                            } else if (label_[At(inblossom_, w)] == 1) {
+                                const int base = ScanBlossom(v, w);
+                                if (base >= 0) {
+                                    AddBlossom(base, k);
+                                } else {
+                                    AugmentMatching(k);
+                                    augmented = true;
+                                    break;
+                                }
+                            } else if (label_[static_cast<size_t>(w)] == 0) {
+                                label_[static_cast<size_t>(w)] = 2;
+                                labelend_[static_cast<size_t>(w)] = p ^ 1;
+                            }
+                        } else if (label_[At(inblossom_, w)] == 1) {
+                            const int b = inblossom_[static_cast<size_t>(v)];
+                            if (bestedge_[static_cast<size_t>(b)] == -1 ||
+                                kslack < Slack(bestedge_[static_cast<size_t>(b)])) {
+                                bestedge_[static_cast<size_t>(b)] = k;
+                            }
+                        } else if (label_[static_cast<size_t>(w)] == 0) {
+                            if (bestedge_[static_cast<size_t>(w)] == -1 ||
+                                kslack < Slack(bestedge_[static_cast<size_t>(w)])) {
+                                bestedge_[static_cast<size_t>(w)] = k;
+                            }
+                        }
+                    }
+                }
+                if (augmented) {
+                    break;
+                }
+
+                int deltatype = -1;
+                std::int64_t delta = 0;
+                int deltaedge = -1;
+                int deltablossom = -1;
+                if (!max_cardinality_) {
+                    deltatype = 1;
+                    delta = *std::min_element(dualvar_.begin(), dualvar_.begin() + n_);
+                }
+                for (int v = 0; v < n_; ++v) {
+                    if (label_[At(inblossom_, v)] == 0 && bestedge_[static_cast<size_t>(v)] != -1) {
+                        const std::int64_t d = Slack(bestedge_[static_cast<size_t>(v)]);
+                        if (deltatype == -1 || d < delta) {
+                            delta = d;
+                            deltatype = 2;
+                            deltaedge = bestedge_[static_cast<size_t>(v)];
+                        }
+                    }
+                }
+                for (int b = 0; b < 2 * n_; ++b) {
+                    if (blossomparent_[static_cast<size_t>(b)] == -1 && label_[static_cast<size_t>(b)] == 1 &&
+                        bestedge_[static_cast<size_t>(b)] != -1) {
+                        const std::int64_t d = Slack(bestedge_[static_cast<size_t>(b)]) / 2;
+                        if (deltatype == -1 || d < delta) {
+                            delta = d;
+                            deltatype = 3;
+                            deltaedge = bestedge_[static_cast<size_t>(b)];
+                        }
+                    }
+                }
+                for (int b = n_; b < 2 * n_; ++b) {
+                    if (blossombase_[static_cast<size_t>(b)] >= 0 && blossomparent_[static_cast<size_t>(b)] == -1 &&
+                        label_[static_cast<size_t>(b)] == 2 &&
+                        (deltatype == -1 || dualvar_[static_cast<size_t>(b)] < delta)) {
+                        delta = dualvar_[static_cast<size_t>(b)];
+                        deltatype = 4;
+                        deltablossom = b;
+                    }
+                }
+                if (deltatype == -1) {
+                    deltatype = 1;
+                    delta = std::max<std::int64_t>(
+                        0, *std::min_element(dualvar_.begin(), dualvar_.begin() + n_));
+                }
+
+                for (int v = 0; v < n_; ++v) {
+                    const int label = label_[At(inblossom_, v)];
+                    if (label == 1) {
+                        dualvar_[static_cast<size_t>(v)] -= delta;
+                    } else if (label == 2) {
+                        dualvar_[static_cast<size_t>(v)] += delta;
+                    }
+                }
+                for (int b = n_; b < 2 * n_; ++b) {
+                    if (blossombase_[static_cast<size_t>(b)] >= 0 && blossomparent_[static_cast<size_t>(b)] == -1) {
+                        if (label_[static_cast<size_t>(b)] == 1) {
+                            dualvar_[static_cast<size_t>(b)] += delta;
+                        } else if (label_[static_cast<size_t>(b)] == 2) {
+                            dualvar_[static_cast<size_t>(b)] -= delta;
+                        }
+                    }
+                }
+
+                if (deltatype == 1) {
+                    break;
+                }
+                if (deltatype == 2) {
+                    allowedge_[static_cast<size_t>(deltaedge)] = true;
+                    int i = edges_[static_cast<size_t>(deltaedge)].u;
+                    if (label_[At(inblossom_, i)] == 0) {
+                        i = edges_[static_cast<size_t>(deltaedge)].v;
+                    }
+                    queue_.push_back(i);
+                } else if (deltatype == 3) {
+                    allowedge_[static_cast<size_t>(deltaedge)] = true;
+                    queue_.push_back(edges_[static_cast<size_t>(deltaedge)].u);
+                } else {
+                    ExpandBlossom(deltablossom, false);
+                }
+            }
+
+            if (!augmented) {
+                break;
+            }
+
+            for (int b = n_; b < 2 * n_; ++b) {
+                if (blossomparent_[static_cast<size_t>(b)] == -1 && blossombase_[static_cast<size_t>(b)] >= 0 &&
+                    label_[static_cast<size_t>(b)] == 1 && dualvar_[static_cast<size_t>(b)] == 0) {
+                    ExpandBlossom(b, true);
+                }
+            }
+        }
+
+        std::vector<int> result(static_cast<size_t>(n_), -1);
+        for (int v = 0; v < n_; ++v) {
+            if (mate_[static_cast<size_t>(v)] >= 0) {
+                result[static_cast<size_t>(v)] = endpoint_[static_cast<size_t>(mate_[static_cast<size_t>(v)])];
+            }
+        }
+        return result;
+    }
+
+private:
+    static size_t At(const std::vector<int>& values, int index) {
+        return static_cast<size_t>(values[static_cast<size_t>(index)]);
+    }
+
+    static int Wrap(const std::vector<int>& values, int index) {
+        const int size = static_cast<int>(values.size());
+        return values[static_cast<size_t>(((index % size) + size) % size)];
+    }
+
+    std::int64_t Slack(int k) const {
+        const auto& edge = edges_[static_cast<size_t>(k)];
+        return dualvar_[static_cast<size_t>(edge.u)] + dualvar_[static_cast<size_t>(edge.v)] - 2 * edge.weight;
+    }
+
+    void BlossomLeaves(int b, std::vector<int>& leaves) const {
+        if (b < n_) {
+            leaves.push_back(b);
+            return;
+        }
+        for (int child : blossomchilds_[static_cast<size_t>(b)]) {
+            BlossomLeaves(child, leaves);
+        }
+    }
+
+    void AssignLabel(int w, int t, int p) {
+        const int b = inblossom_[static_cast<size_t>(w)];
+        label_[static_cast<size_t>(w)] = label_[static_cast<size_t>(b)] = t;
+        labelend_[static_cast<size_t>(w)] = labelend_[static_cast<size_t>(b)] = p;
+        bestedge_[static_cast<size_t>(w)] = bestedge_[static_cast<size_t>(b)] = -1;
+        if (t == 1) {
+            BlossomLeaves(b, queue_);
+        } else if (t == 2) {
+            const int base = blossombase_[static_cast<size_t>(b)];
+            const int mate = mate_[static_cast<size_t>(base)];
+            AssignLabel(endpoint_[static_cast<size_t>(mate)], 1, mate ^ 1);
+        }
+    }
+
+    int ScanBlossom(int v, int w) {
+        std::vector<int> path;
+        int base = -1;
+        while (v != -1 || w != -1) {
+            int b = inblossom_[static_cast<size_t>(v)];
+            if (label_[static_cast<size_t>(b)] & 4) {
+                base = blossombase_[static_cast<size_t>(b)];
+                break;
+            }
+            path.push_back(b);
+            label_[static_cast<size_t>(b)] = 5;
+            if (labelend_[static_cast<size_t>(b)] == -1) {
+                v = -1;
+            } else {
+                v = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(b)])];
+                b = inblossom_[static_cast<size_t>(v)];
+                v = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(b)])];
+            }
+            if (w != -1) {
+                std::swap(v, w);
+            }
+        }
+        for (int b : path) {
+            label_[static_cast<size_t>(b)] = 1;
+        }
+        return base;
+    }
+
+    void AddBlossom(int base, int k) {
+        int v = edges_[static_cast<size_t>(k)].u;
+        int w = edges_[static_cast<size_t>(k)].v;
+        const int bb = inblossom_[static_cast<size_t>(base)];
+        int bv = inblossom_[static_cast<size_t>(v)];
+        int bw = inblossom_[static_cast<size_t>(w)];
+        const int b = unusedblossoms_.back();
+        unusedblossoms_.pop_back();
+        blossombase_[static_cast<size_t>(b)] = base;
+        blossomparent_[static_cast<size_t>(b)] = -1;
+        blossomparent_[static_cast<size_t>(bb)] = b;
+
+        std::vector<int> path;
+        std::vector<int> endps;
+        while (bv != bb) {
+            blossomparent_[static_cast<size_t>(bv)] = b;
+            path.push_back(bv);
+            endps.push_back(labelend_[static_cast<size_t>(bv)]);
+            v = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(bv)])];
+            bv = inblossom_[static_cast<size_t>(v)];
+        }
+        path.push_back(bb);
+        std::reverse(path.begin(), path.end());
+        std::reverse(endps.begin(), endps.end());
+        endps.push_back(2 * k);
+        while (bw != bb) {
+            blossomparent_[static_cast<size_t>(bw)] = b;
+            path.push_back(bw);
+            endps.push_back(labelend_[static_cast<size_t>(bw)] ^ 1);
+            w = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(bw)])];
+            bw = inblossom_[static_cast<size_t>(w)];
+        }
+        blossomchilds_[static_cast<size_t>(b)] = path;
+        blossomendps_[static_cast<size_t>(b)] = endps;
+
+        label_[static_cast<size_t>(b)] = 1;
+        labelend_[static_cast<size_t>(b)] = labelend_[static_cast<size_t>(bb)];
+        dualvar_[static_cast<size_t>(b)] = 0;
+
+        std::vector<int> leaves;
+        BlossomLeaves(b, leaves);
+        for (int leaf : leaves) {
+            if (label_[At(inblossom_, leaf)] == 2) {
+                queue_.push_back(leaf);
+            }
+            inblossom_[static_cast<size_t>(leaf)] = b;
+        }
+
+        std::vector<int> bestedgeto(static_cast<size_t>(2 * n_), -1);
+        for (int child : path) {
+            std::vector<int> candidates;
+            if (!has_blossombestedges_[static_cast<size_t>(child)]) {
+                std::vector<int> child_leaves;
+                BlossomLeaves(child, child_leaves);
+                for (int leaf : child_leaves) {
+                    for (int p : neighbend_[static_cast<size_t>(leaf)]) {
+                        candidates.push_back(p / 2);
+                    }
+                }
+            } else {
+                candidates = blossombestedges_[static_cast<size_t>(child)];
+            }
+            for (int edge : candidates) {
+                int i = edges_[static_cast<size_t>(edge)].u;
+                int j = edges_[static_cast<size_t>(edge)].v;
+                if (inblossom_[static_cast<size_t>(j)] == b) {
+                    std::swap(i, j);
+                }
+                const int bj = inblossom_[static_cast<size_t>(j)];
+                if (bj != b && label_[static_cast<size_t>(bj)] == 1 &&
+                    (bestedgeto[static_cast<size_t>(bj)] == -1 ||
+                     Slack(edge) < Slack(bestedgeto[static_cast<size_t>(bj)]))) {
+                    bestedgeto[static_cast<size_t>(bj)] = edge;
+                }
+            }
+            blossombestedges_[static_cast<size_t>(child)].clear();
+            has_blossombestedges_[static_cast<size_t>(child)] = false;
+            bestedge_[static_cast<size_t>(child)] = -1;
+        }
+
+        auto& best_edges = blossombestedges_[static_cast<size_t>(b)];
+        best_edges.clear();
+        for (int edge : bestedgeto) {
+            if (edge != -1) {
+                best_edges.push_back(edge);
+            }
+        }
+        has_blossombestedges_[static_cast<size_t>(b)] = true;
+        bestedge_[static_cast<size_t>(b)] = -1;
+        for (int edge : best_edges) {
+            if (bestedge_[static_cast<size_t>(b)] == -1 || Slack(edge) < Slack(bestedge_[static_cast<size_t>(b)])) {
+                bestedge_[static_cast<size_t>(b)] = edge;
+            }
+        }
+    }
+
+    void ExpandBlossom(int b, bool endstage) {
+        const std::vector<int> childs = blossomchilds_[static_cast<size_t>(b)];
+        for (int s : childs) {
+            blossomparent_[static_cast<size_t>(s)] = -1;
+            if (s < n_) {
+                inblossom_[static_cast<size_t>(s)] = s;
+            } else if (endstage && dualvar_[static_cast<size_t>(s)] == 0) {
+                ExpandBlossom(s, endstage);
+            } else {
+                std::vector<int> leaves;
+                BlossomLeaves(s, leaves);
+                for (int leaf : leaves) {
+                    inblossom_[static_cast<size_t>(leaf)] = s;
+                }
+            }
+        }
+
+        if (!endstage && label_[static_cast<size_t>(b)] == 2) {
+            const auto& endps = blossomendps_[static_cast<size_t>(b)];
+            const int entrychild =
+                inblossom_[static_cast<size_t>(endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(b)] ^ 1)])];
+            int j = static_cast<int>(std::find(childs.begin(), childs.end(), entrychild) - childs.begin());
+            int jstep = 0;
+            int endptrick = 0;
+            if (j & 1) {
+                j -= static_cast<int>(childs.size());
+                jstep = 1;
+                endptrick = 0;
+            } else {
+                jstep = -1;
+                endptrick = 1;
+            }
+            int p = labelend_[static_cast<size_t>(b)];
+            while (j != 0) {
+                label_[static_cast<size_t>(endpoint_[static_cast<size_t>(p ^ 1)])] = 0;
+                label_[static_cast<size_t>(
+                    endpoint_[static_cast<size_t>(Wrap(endps, j - endptrick) ^ endptrick ^ 1)])] = 0;
+                AssignLabel(endpoint_[static_cast<size_t>(p ^ 1)], 2, p);
+                allowedge_[static_cast<size_t>(Wrap(endps, j - endptrick) / 2)] = true;
+                j += jstep;
+                p = Wrap(endps, j - endptrick) ^ endptrick;
+                allowedge_[static_cast<size_t>(p / 2)] = true;
+                j += jstep;
+            }
+            int bv = Wrap(childs, j);
+            label_[static_cast<size_t>(endpoint_[static_cast<size_t>(p ^ 1)])] = label_[static_cast<size_t>(bv)] = 2;
+            labelend_[static_cast<size_t>(endpoint_[static_cast<size_t>(p ^ 1)])] =
+                labelend_[static_cast<size_t>(bv)] = p;
+            bestedge_[static_cast<size_t>(bv)] = -1;
+            j += jstep;
+            while (Wrap(childs, j) != entrychild) {
+                bv = Wrap(childs, j);
+                if (label_[static_cast<size_t>(bv)] == 1) {
+                    j += jstep;
+                    continue;
+                }
+                std::vector<int> leaves;
+                BlossomLeaves(bv, leaves);
+                int labelled = -1;
+                for (int leaf : leaves) {
+                    if (label_[static_cast<size_t>(leaf)] != 0) {
+                        labelled = leaf;
+                        break;
+                    }
+                }
+                if (labelled >= 0) {
+                    label_[static_cast<size_t>(labelled)] = 0;
+                    label_[static_cast<size_t>(
+                        endpoint_[static_cast<size_t>(mate_[At(blossombase_, bv)])])] = 0;
+                    AssignLabel(labelled, 2, labelend_[static_cast<size_t>(labelled)]);
+                }
+                j += jstep;
+            }
+        }
+
+        label_[static_cast<size_t>(b)] = -1;
+        labelend_[static_cast<size_t>(b)] = -1;
+        blossomchilds_[static_cast<size_t>(b)].clear();
+        blossomendps_[static_cast<size_t>(b)].clear();
+        blossombase_[static_cast<size_t>(b)] = -1;
+        blossombestedges_[static_cast<size_t>(b)].clear();
+        has_blossombestedges_[static_cast<size_t>(b)] = false;
+        bestedge_[static_cast<size_t>(b)] = -1;
+        unusedblossoms_.push_back(b);
+    }
+
+    void AugmentBlossom(int b, int v) {
+        int t = v;
+        while (blossomparent_[static_cast<size_t>(t)] != b) {
+            t = blossomparent_[static_cast<size_t>(t)];
+        }
+        if (t >= n_) {
+            AugmentBlossom(t, v);
+        }
+        auto& childs = blossomchilds_[static_cast<size_t>(b)];
+        auto& endps = blossomendps_[static_cast<size_t>(b)];
+        const int i = static_cast<int>(std::find(childs.begin(), childs.end(), t) - childs.begin());
+        int j = i;
+        int jstep = 0;
+        int endptrick = 0;
+        if (i & 1) {
+            j -= static_cast<int>(childs.size());
+            jstep = 1;
+            endptrick = 0;
+        } else {
+            jstep = -1;
+            endptrick = 1;
+        }
+        while (j != 0) {
+            j += jstep;
+            t = Wrap(childs, j);
+            const int p = Wrap(endps, j - endptrick) ^ endptrick;
+            if (t >= n_) {
+                AugmentBlossom(t, endpoint_[static_cast<size_t>(p)]);
+            }
+            j += jstep;
+            t = Wrap(childs, j);
+            if (t >= n_) {
+                AugmentBlossom(t, endpoint_[static_cast<size_t>(p ^ 1)]);
+            }
+            mate_[static_cast<size_t>(endpoint_[static_cast<size_t>(p)])] = p ^ 1;
+            mate_[static_cast<size_t>(endpoint_[static_cast<size_t>(p ^ 1)])] = p;
+        }
+        std::rotate(childs.begin(), childs.begin() + i, childs.end());
+        std::rotate(endps.begin(), endps.begin() + i, endps.end());
+        blossombase_[static_cast<size_t>(b)] = blossombase_[At(childs, 0)];
+    }
+
+    void AugmentMatching(int k) {
+        const int endpoints[2][2] = {{edges_[static_cast<size_t>(k)].u, 2 * k + 1},
+                                     {edges_[static_cast<size_t>(k)].v, 2 * k}};
+        for (const auto& start : endpoints) {
+            int s = start[0];
+            int p = start[1];
+            while (true) {
+                const int bs = inblossom_[static_cast<size_t>(s)];
+                if (bs >= n_) {
+                    AugmentBlossom(bs, s);
+                }
+                mate_[static_cast<size_t>(s)] = p;
+                if (labelend_[static_cast<size_t>(bs)] == -1) {
+                    break;
+                }
+                const int t = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(bs)])];
+                const int bt = inblossom_[static_cast<size_t>(t)];
+                s = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(bt)])];
+                const int j = endpoint_[static_cast<size_t>(labelend_[static_cast<size_t>(bt)] ^ 1)];
+                if (bt >= n_) {
+                    AugmentBlossom(bt, j);
+                }
+                mate_[static_cast<size_t>(j)] = labelend_[static_cast<size_t>(bt)];
+                p = labelend_[static_cast<size_t>(bt)] ^ 1;
+            }
+        }
+    }
+
+    int n_;
+    const std::vector<MatchingEdge>& edges_;
+    bool max_cardinality_;
+    std::vector<int> endpoint_;
+    std::vector<std::vector<int>> neighbend_;
+    std::vector<int> mate_;
+    std::vector<int> label_;
+    std::vector<int> labelend_;
+    std::vector<int> inblossom_;
+    std::vector<int> blossomparent_;
+    std::vector<std::vector<int>> blossomchilds_;
+    std::vector<int> blossombase_;
+    std::vector<std::vector<int>> blossomendps_;
+    std::vector<int> bestedge_;
+    std::vector<std::vector<int>> blossombestedges_;
+    std::vector<bool> has_blossombestedges_;
+    std::vector<int> unusedblossoms_;
+    std::vector<std::int64_t> dualvar_;
+    std::vector<bool> allowedge_;
+    std::vector<int> queue_;
+};
+
+}  // namespace
+
+std::vector<int> MaxWeightMatching(int vertex_count,
+                                   const std::vector<MatchingEdge>& edges,
+                                   bool max_cardinality) {
+    if (vertex_count <= 0) {
+        return {};
+    }
+    BlossomMatcher matcher(vertex_count, edges, max_cardinality);
+    return matcher.Solve();
+}
+
+}  // namespace ijccrl::core::tournament
@@ -202,6 +202,7 @@ bool UciEngine::Go(int wtime_ms,
         }
 
         if (line.rfind("bestmove ", 0) == 0) {
+            last_bestmove_time_ = std::chrono::steady_clock::now();
             std::istringstream iss(line);
             std::string token;
             iss >> token;  // bestmove
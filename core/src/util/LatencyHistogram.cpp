@@ -0,0 +1,173 @@
+#include "ijccrl/core/util/LatencyHistogram.h"
+
+#include <algorithm>
+#include <bitset>
+
+namespace ijccrl::core::util {
+
+namespace {
+
+constexpr std::size_t kStageCount = static_cast<std::size_t>(BroadcastStage::Count);
+
+struct MoveMark {
+    bool valid = false;
+    std::chrono::steady_clock::time_point received{};
+    std::bitset<kStageCount> recorded;
+};
+
+thread_local MoveMark current_mark;
+
+int FloorLog2(std::uint64_t value) {
+    int result = 0;
+    while (value > 1) {
+        value >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace
+
+std::size_t LatencyHistogram::BucketFor(std::uint64_t micros) {
+    if (micros < kLinearBuckets) {
+        return static_cast<std::size_t>(micros);
+    }
+    const int exponent = std::min(FloorLog2(micros), 43);
+    const std::uint64_t sub = std::min<std::uint64_t>((micros >> (exponent - 3)) - kSubBuckets,
+                                                      kSubBuckets - 1);
+    return kLinearBuckets + static_cast<std::size_t>(exponent - 4) * kSubBuckets +
+           static_cast<std::size_t>(sub);
+}
+
+std::uint64_t LatencyHistogram::BucketUpperBound(std::size_t index) {
+    if (index < kLinearBuckets) {
+        return index;
+    }
+    const std::size_t offset = index - kLinearBuckets;
+    const int exponent = static_cast<int>(offset / kSubBuckets) + 4;
+    const std::uint64_t sub = offset % kSubBuckets;
+    const std::uint64_t width = std::uint64_t{1} << (exponent - 3);
+    return (kSubBuckets + sub) * width + width - 1;
+}
+
+void LatencyHistogram::Record(std::chrono::steady_clock::duration elapsed) {
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    RecordMicros(micros < 0 ? 0 : static_cast<std::uint64_t>(micros));
+}
+
+void LatencyHistogram::RecordMicros(std::uint64_t micros) {
+    buckets_[BucketFor(micros)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t previous = max_micros_.load(std::memory_order_relaxed);
+    while (micros > previous &&
+           !max_micros_.compare_exchange_weak(previous, micros, std::memory_order_relaxed)) {
+    }
+}
+
+LatencyHistogram::Summary LatencyHistogram::Summarize() const {
+    Summary summary;
+    std::array<std::uint64_t, kBucketCount> counts{};
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        summary.count += counts[i];
+    }
+    if (summary.count == 0) {
+        return summary;
+    }
+    const std::uint64_t max_micros = max_micros_.load(std::memory_order_relaxed);
+    const auto percentile = [&](double fraction) {
+        const auto target = static_cast<std::uint64_t>(
+            std::max(1.0, fraction * static_cast<double>(summary.count)));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= target) {
+                return std::min(BucketUpperBound(i), max_micros);
+            }
+        }
+        return max_micros;
+    };
+    summary.p50_ms = static_cast<double>(percentile(0.50)) / 1000.0;
+    summary.p99_ms = static_cast<double>(percentile(0.99)) / 1000.0;
+    summary.max_ms = static_cast<double>(max_micros) / 1000.0;
+    return summary;
+}
+
+void LatencyHistogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    max_micros_.store(0, std::memory_order_relaxed);
+}
+
+const char* BroadcastStageName(BroadcastStage stage) {
+    switch (stage) {
+        case BroadcastStage::Runner:
+            return "bestmove_to_runner";
+        case BroadcastStage::TlcsFeed:
+            return "bestmove_to_tlcs_feed";
+        case BroadcastStage::LivePgn:
+            return "bestmove_to_live_pgn";
+        case BroadcastStage::GuiState:
+            return "bestmove_to_gui_state";
+        case BroadcastStage::Count:
+            break;
+    }
+    return "unknown";
+}
+
+void MarkBestmoveReceived(std::chrono::steady_clock::time_point received) {
+    current_mark.valid = true;
+    current_mark.received = received;
+    current_mark.recorded.reset();
+}
+
+void ClearBestmoveMark() {
+    current_mark.valid = false;
+    current_mark.recorded.reset();
+}
+
+bool CurrentBestmoveMark(std::chrono::steady_clock::time_point* received) {
+    if (!current_mark.valid) {
+        return false;
+    }
+    if (received) {
+        *received = current_mark.received;
+    }
+    return true;
+}
+
+void BroadcastLatency::Record(BroadcastStage stage) {
+    const auto index = static_cast<std::size_t>(stage);
+    if (!current_mark.valid || index >= kStageCount || current_mark.recorded.test(index)) {
+        return;
+    }
+    current_mark.recorded.set(index);
+    histograms_[index].Record(std::chrono::steady_clock::now() - current_mark.received);
+}
+
+void BroadcastLatency::Record(BroadcastStage stage, std::chrono::steady_clock::time_point received) {
+    const auto index = static_cast<std::size_t>(stage);
+    if (index >= kStageCount) {
+        return;
+    }
+    histograms_[index].Record(std::chrono::steady_clock::now() - received);
+}
+
+std::vector<std::pair<std::string, LatencyHistogram::Summary>> BroadcastLatency::Snapshot() const {
+    std::vector<std::pair<std::string, LatencyHistogram::Summary>> snapshot;
+    snapshot.reserve(kStageCount);
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        snapshot.emplace_back(BroadcastStageName(static_cast<BroadcastStage>(i)), histograms_[i].Summarize());
+    }
+    return snapshot;
+}
+
+void BroadcastLatency::Reset() {
+    for (auto& histogram : histograms_) {
+        histogram.Reset();
+    }
+}
+
+}  // namespace ijccrl::core::util
@@ -0,0 +1,114 @@
+#include "ijccrl/core/util/MappedFile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ijccrl::core::util {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+                if (data) {
+                    CloseHandle(file);
+                    mapping_ = data;
+                    data_ = static_cast<const char*>(data);
+                    size_ = static_cast<size_t>(size.QuadPart);
+                    return true;
+                }
+            }
+        }
+        CloseHandle(file);
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        struct stat info {};
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                ::madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+                ::close(fd);
+                mapping_ = data;
+                data_ = static_cast<const char*>(data);
+                size_ = static_cast<size_t>(info.st_size);
+                return true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    buffer_ = contents.str();
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mapping_) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping_);
+#else
+        ::munmap(mapping_, size_);
+#endif
+        mapping_ = nullptr;
+    }
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+}
+
+std::vector<std::string_view> SplitChunks(std::string_view text,
+                                          size_t max_chunks,
+                                          size_t min_chunk_bytes,
+                                          const std::function<size_t(std::string_view, size_t)>& next_boundary) {
+    std::vector<std::string_view> chunks;
+    const size_t count =
+        std::max<size_t>(1, std::min(max_chunks, text.size() / std::max<size_t>(1, min_chunk_bytes)));
+    size_t start = 0;
+    for (size_t i = 1; i < count && start < text.size(); ++i) {
+        const size_t target = std::max(start, text.size() * i / count);
+        const size_t cut = std::min(text.size(), next_boundary(text, target));
+        if (cut > start) {
+            chunks.push_back(text.substr(start, cut - start));
+            start = cut;
+        }
+    }
+    if (start < text.size() || chunks.empty()) {
+        chunks.push_back(text.substr(start));
+    }
+    return chunks;
+}
+
+}  // namespace ijccrl::core::util
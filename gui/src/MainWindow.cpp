@@ -22,6 +22,7 @@
 #include <QUrl>
 #include <QVBoxLayout>
 #include <algorithm>
+#include <cmath>
 
 namespace {
 
@@ -131,14 +132,18 @@ void MainWindow::createUi() {
     tournament_mode_->addItem("Gauntlet", "gauntlet");
     tournament_mode_->addItem("Swiss", "swiss");
     tournament_mode_->addItem("H2H", "h2h");
+    tournament_mode_->addItem("SPRT (A vs B)", "sprt");
     tournament_mode_->setCurrentIndex(0);
-    tournament_mode_->setItemData(1, 0, Qt::UserRole - 1);
     tournament_mode_->setItemData(3, 0, Qt::UserRole - 1);
     connect(tournament_mode_, qOverload<int>(&QComboBox::currentIndexChanged),
             this,
             &MainWindow::updateTournamentOptions);
 
     double_rr_ = new QCheckBox("Double round robin", setup_tab);
+    gauntlet_engines_ = new QLineEdit(setup_tab);
+    gauntlet_engines_->setPlaceholderText("Engine names, separated by ';' (default: first engine)");
+    tie_breaks_ = new QLineEdit("buchholz; sonneborn_berger; direct_encounter; koya", setup_tab);
+    tie_breaks_->setPlaceholderText("buchholz, sonneborn_berger, direct_encounter, koya; separated by ';'");
     rounds_spin_ = new QSpinBox(setup_tab);
     rounds_spin_->setRange(1, 200);
     rounds_spin_->setValue(1);
@@ -149,6 +154,14 @@ void MainWindow::createUi() {
     avoid_repeats_->setChecked(true);
     bye_points_ = new QCheckBox("Bye = 1 point", setup_tab);
     bye_points_->setChecked(true);
+    paired_openings_ = new QCheckBox("Play each opening with both colours", setup_tab);
+    swiss_overlap_ = new QCheckBox("Start settled score groups of the next round early", setup_tab);
+    longest_first_ = new QCheckBox("Start longest expected games first", setup_tab);
+    distributed_listen_ = new QLineEdit(setup_tab);
+    distributed_listen_->setPlaceholderText("host:port or unix:/path (empty: play games locally)");
+    distributed_token_ = new QLineEdit(setup_tab);
+    distributed_token_->setEchoMode(QLineEdit::Password);
+    distributed_token_->setPlaceholderText("shared secret workers pass with --token");
 
     concurrency_spin_ = new QSpinBox(setup_tab);
     concurrency_spin_->setRange(1, 128);
@@ -165,11 +178,12 @@ void MainWindow::createUi() {
     openings_type_ = new QComboBox(setup_tab);
     openings_type_->addItem("EPD", "epd");
     openings_type_->addItem("PGN", "pgn");
+    openings_type_->addItem("Polyglot book", "polyglot");
 
     openings_path_ = new QLineEdit(setup_tab);
     auto* openings_browse = new QPushButton("Browse", setup_tab);
     connect(openings_browse, &QPushButton::clicked, [this]() {
-        const auto path = QFileDialog::getOpenFileName(this, "Select openings suite", "", "Suites (*.epd *.pgn);;All files (*)");
+        const auto path = QFileDialog::getOpenFileName(this, "Select openings suite", "", "Suites (*.epd *.pgn *.bin);;All files (*)");
         if (!path.isEmpty()) {
             openings_path_->setText(path);
         }
@@ -181,6 +195,25 @@ void MainWindow::createUi() {
 
     openings_seed_ = new QSpinBox(setup_tab);
     openings_seed_->setRange(0, 9999999);
+    openings_dedupe_ = new QCheckBox("Skip duplicate positions", setup_tab);
+    openings_position_ids_ = new QCheckBox("Identify openings by position hash", setup_tab);
+    openings_book_lines_ = new QSpinBox(setup_tab);
+    openings_book_lines_->setRange(1, 1000000);
+    openings_book_lines_->setValue(1000);
+    openings_book_depth_ = new QSpinBox(setup_tab);
+    openings_book_depth_->setRange(1, 200);
+    openings_book_depth_->setValue(16);
+    openings_max_bias_ = new QSpinBox(setup_tab);
+    openings_max_bias_->setRange(0, 50);
+    openings_max_bias_->setSpecialValueText("Off");
+    openings_bias_min_games_ = new QSpinBox(setup_tab);
+    openings_bias_min_games_->setRange(1, 100000);
+    openings_bias_min_games_->setValue(20);
+    simulations_spin_ = new QSpinBox(setup_tab);
+    simulations_spin_->setRange(0, 10000000);
+    simulations_spin_->setSingleStep(10000);
+    simulations_spin_->setSpecialValueText("Off");
+    simulations_spin_->setValue(100000);
 
     server_ini_path_ = new QLineEdit(setup_tab);
     auto* server_browse = new QPushButton("Browse", setup_tab);
@@ -267,17 +300,31 @@ void MainWindow::createUi() {
 
     options_layout->addRow("Tournament mode", tournament_mode_);
     options_layout->addRow("Double RR", double_rr_);
+    options_layout->addRow("Gauntlet engines", gauntlet_engines_);
+    options_layout->addRow("Tie-breaks", tie_breaks_);
     options_layout->addRow("Rounds", rounds_spin_);
     options_layout->addRow("Games per pairing", games_per_pairing_);
     options_layout->addRow("Concurrency", concurrency_spin_);
+    options_layout->addRow("Worker listen address", distributed_listen_);
+    options_layout->addRow("Worker token", distributed_token_);
     options_layout->addRow("", avoid_repeats_);
     options_layout->addRow("", bye_points_);
+    options_layout->addRow("", paired_openings_);
+    options_layout->addRow("", swiss_overlap_);
+    options_layout->addRow("", longest_first_);
     options_layout->addRow("TC base (sec)", base_seconds_spin_);
     options_layout->addRow("TC increment (sec)", increment_seconds_spin_);
     options_layout->addRow("Openings type", openings_type_);
     options_layout->addRow("Openings suite", openings_path_row);
     options_layout->addRow("Openings policy", openings_policy_);
     options_layout->addRow("Openings seed", openings_seed_);
+    options_layout->addRow("", openings_dedupe_);
+    options_layout->addRow("", openings_position_ids_);
+    options_layout->addRow("Book lines", openings_book_lines_);
+    options_layout->addRow("Book depth (plies)", openings_book_depth_);
+    options_layout->addRow("Skip openings biased by (%)", openings_max_bias_);
+    options_layout->addRow("Bias sample (games)", openings_bias_min_games_);
+    options_layout->addRow("Final place simulations", simulations_spin_);
     options_layout->addRow("TLCS server.ini", server_row);
     options_layout->addRow("Output dir", output_row);
     options_layout->addRow("", adjudication_enabled_);
@@ -313,6 +360,18 @@ void MainWindow::createUi() {
     standings_view_->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
     live_layout->addWidget(standings_view_);
 
+    crosstable_model_ = new CrosstableModel(this);
+    crosstable_view_ = new QTableView(live_tab);
+    crosstable_view_->setModel(crosstable_model_);
+    crosstable_view_->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    live_layout->addWidget(crosstable_view_);
+
+    simulation_model_ = new SimulationModel(this);
+    simulation_view_ = new QTableView(live_tab);
+    simulation_view_->setModel(simulation_model_);
+    simulation_view_->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    live_layout->addWidget(simulation_view_);
+
     // Logs tab
     auto* logs_tab = new QWidget(this);
     auto* logs_layout = new QVBoxLayout(logs_tab);
@@ -356,10 +415,16 @@ void MainWindow::createMenus() {
 
 void MainWindow::updateTournamentOptions() {
     const bool is_swiss = tournament_mode_->currentData().toString() == "swiss";
-    double_rr_->setEnabled(!is_swiss);
-    rounds_spin_->setEnabled(is_swiss);
+    const bool is_sprt = tournament_mode_->currentData().toString() == "sprt";
+    const bool is_gauntlet = tournament_mode_->currentData().toString() == "gauntlet";
+    double_rr_->setEnabled(!is_swiss && !is_sprt && !is_gauntlet);
+    rounds_spin_->setEnabled(is_swiss || is_sprt || is_gauntlet);
+    gauntlet_engines_->setEnabled(is_gauntlet);
+    paired_openings_->setEnabled(!is_sprt && !is_gauntlet);
     avoid_repeats_->setEnabled(is_swiss);
     bye_points_->setEnabled(is_swiss);
+    swiss_overlap_->setEnabled(is_swiss);
+    longest_first_->setEnabled(!is_sprt);
 }
 
 void MainWindow::refreshRecentProfiles() {
@@ -574,6 +639,8 @@ void MainWindow::updateLiveView() {
     live_panel_->updateState(state, tlcs_enabled);
 
     standings_model_->setStandings(runner_service_.getStandingsSnapshot());
+    crosstable_model_->setCrosstable(runner_service_.getCrosstableSnapshot());
+    simulation_model_->setSimulation(runner_service_.getSimulationSnapshot());
     log_view_->setLogText(QString::fromStdString(runner_service_.getLastLogLines(400)));
 
     pause_action_->setEnabled(state.running && !state.paused);
@@ -687,6 +754,18 @@ ijccrl::core::api::RunnerConfig MainWindow::buildConfigFromUi() const {
     config.tournament.concurrency = concurrency_spin_->value();
     config.tournament.avoid_repeats = avoid_repeats_->isChecked();
     config.tournament.bye_points = bye_points_->isChecked() ? 1.0 : 0.0;
+    config.tournament.paired_openings = paired_openings_->isChecked();
+    config.tournament.swiss_overlap = swiss_overlap_->isChecked();
+    config.tournament.job_order = longest_first_->isChecked() ? "longest_first" : "fixture";
+    config.distributed.listen = distributed_listen_->text().trimmed().toStdString();
+    config.distributed.token = distributed_token_->text().toStdString();
+    for (const auto& name : SplitOptions(gauntlet_engines_->text())) {
+        config.tournament.gauntlet_engines.push_back(name.trimmed().toStdString());
+    }
+    config.tournament.tie_breaks.clear();
+    for (const auto& name : SplitOptions(tie_breaks_->text())) {
+        config.tournament.tie_breaks.push_back(name.trimmed().toStdString());
+    }
 
     config.time_control.base_seconds = base_seconds_spin_->value();
     config.time_control.increment_seconds = increment_seconds_spin_->value();
@@ -695,6 +774,13 @@ ijccrl::core::api::RunnerConfig MainWindow::buildConfigFromUi() const {
     config.openings.path = openings_path_->text().toStdString();
     config.openings.policy = openings_policy_->currentData().toString().toStdString();
     config.openings.seed = openings_seed_->value();
+    config.openings.dedupe = openings_dedupe_->isChecked();
+    config.openings.position_ids = openings_position_ids_->isChecked();
+    config.openings.book_lines = openings_book_lines_->value();
+    config.openings.book_depth = openings_book_depth_->value();
+    config.openings.max_bias = openings_max_bias_->value() / 100.0;
+    config.openings.bias_min_games = openings_bias_min_games_->value();
+    config.output.simulations = simulations_spin_->value();
 
     output_dir_ = output_dir_edit_->text().isEmpty() ? "out" : output_dir_edit_->text();
     const auto output_base = output_dir_.toStdString();
@@ -775,6 +861,21 @@ void MainWindow::applyConfigToUi(const ijccrl::core::api::RunnerConfig& config)
     concurrency_spin_->setValue(config.tournament.concurrency);
     avoid_repeats_->setChecked(config.tournament.avoid_repeats);
     bye_points_->setChecked(config.tournament.bye_points > 0.0);
+    paired_openings_->setChecked(config.tournament.paired_openings);
+    swiss_overlap_->setChecked(config.tournament.swiss_overlap);
+    longest_first_->setChecked(config.tournament.job_order == "longest_first");
+    distributed_listen_->setText(QString::fromStdString(config.distributed.listen));
+    distributed_token_->setText(QString::fromStdString(config.distributed.token));
+    QStringList gauntlet_names;
+    for (const auto& name : config.tournament.gauntlet_engines) {
+        gauntlet_names << QString::fromStdString(name);
+    }
+    gauntlet_engines_->setText(gauntlet_names.join("; "));
+    QStringList tie_break_names;
+    for (const auto& name : config.tournament.tie_breaks) {
+        tie_break_names << QString::fromStdString(name);
+    }
+    tie_breaks_->setText(tie_break_names.join("; "));
 
     base_seconds_spin_->setValue(config.time_control.base_seconds);
     increment_seconds_spin_->setValue(config.time_control.increment_seconds);
@@ -789,6 +890,13 @@ void MainWindow::applyConfigToUi(const ijccrl::core::api::RunnerConfig& config)
         openings_policy_->setCurrentIndex(policy_index);
     }
     openings_seed_->setValue(config.openings.seed);
+    openings_dedupe_->setChecked(config.openings.dedupe);
+    openings_position_ids_->setChecked(config.openings.position_ids);
+    openings_book_lines_->setValue(config.openings.book_lines);
+    openings_book_depth_->setValue(config.openings.book_depth);
+    openings_max_bias_->setValue(static_cast<int>(std::lround(config.openings.max_bias * 100.0)));
+    openings_bias_min_games_->setValue(config.openings.bias_min_games);
+    simulations_spin_->setValue(config.output.simulations);
 
     server_ini_path_->setText(QString::fromStdString(config.broadcast.server_ini));
     adjudication_enabled_->setChecked(config.adjudication.enabled);
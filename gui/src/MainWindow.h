@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Models/CrosstableModel.h"
 #include "Models/EnginesModel.h"
+#include "Models/SimulationModel.h"
 #include "Models/StandingsModel.h"
 #include "Widgets/LiveGamePanel.h"
 #include "Widgets/LogView.h"
@@ -52,14 +54,23 @@ private:
 
     EnginesModel* engines_model_ = nullptr;
     StandingsModel* standings_model_ = nullptr;
+    CrosstableModel* crosstable_model_ = nullptr;
+    SimulationModel* simulation_model_ = nullptr;
 
     QComboBox* tournament_mode_ = nullptr;
     QCheckBox* double_rr_ = nullptr;
+    QLineEdit* gauntlet_engines_ = nullptr;
+    QLineEdit* tie_breaks_ = nullptr;
     QSpinBox* rounds_spin_ = nullptr;
     QSpinBox* games_per_pairing_ = nullptr;
     QSpinBox* concurrency_spin_ = nullptr;
     QCheckBox* avoid_repeats_ = nullptr;
     QCheckBox* bye_points_ = nullptr;
+    QCheckBox* paired_openings_ = nullptr;
+    QCheckBox* swiss_overlap_ = nullptr;
+    QCheckBox* longest_first_ = nullptr;
+    QLineEdit* distributed_listen_ = nullptr;
+    QLineEdit* distributed_token_ = nullptr;
 
     QSpinBox* base_seconds_spin_ = nullptr;
     QSpinBox* increment_seconds_spin_ = nullptr;
@@ -68,6 +79,13 @@ private:
     QLineEdit* openings_path_ = nullptr;
     QComboBox* openings_policy_ = nullptr;
     QSpinBox* openings_seed_ = nullptr;
+    QCheckBox* openings_dedupe_ = nullptr;
+    QCheckBox* openings_position_ids_ = nullptr;
+    QSpinBox* openings_book_lines_ = nullptr;
+    QSpinBox* openings_book_depth_ = nullptr;
+    QSpinBox* openings_max_bias_ = nullptr;
+    QSpinBox* openings_bias_min_games_ = nullptr;
+    QSpinBox* simulations_spin_ = nullptr;
 
     QLineEdit* server_ini_path_ = nullptr;
     QLineEdit* output_dir_edit_ = nullptr;
@@ -87,6 +105,8 @@ private:
 
     LiveGamePanel* live_panel_ = nullptr;
     QTableView* standings_view_ = nullptr;
+    QTableView* crosstable_view_ = nullptr;
+    QTableView* simulation_view_ = nullptr;
     LogView* log_view_ = nullptr;
 
     QSpinBox* log_refresh_spin_ = nullptr;
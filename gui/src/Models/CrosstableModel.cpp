@@ -0,0 +1,55 @@
+#include "Models/CrosstableModel.h"
+
+CrosstableModel::CrosstableModel(QObject* parent)
+    : QAbstractTableModel(parent) {}
+
+int CrosstableModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(crosstable_.names.size());
+}
+
+int CrosstableModel::columnCount(const QModelIndex& parent) const {
+    return rowCount(parent);
+}
+
+QVariant CrosstableModel::data(const QModelIndex& index, int role) const {
+    const size_t count = crosstable_.names.size();
+    if (!index.isValid() || index.row() >= static_cast<int>(count) || index.column() >= static_cast<int>(count) ||
+        crosstable_.cells.size() != count * count) {
+        return {};
+    }
+    if (index.row() == index.column()) {
+        return role == Qt::DisplayRole ? QVariant(QString::fromUtf8("×")) : QVariant();
+    }
+
+    const auto& cell = crosstable_.cells[static_cast<size_t>(index.row()) * count + static_cast<size_t>(index.column())];
+    const int games = cell.wins + cell.draws + cell.losses;
+    if (role == Qt::DisplayRole) {
+        if (games == 0) {
+            return QString("-");
+        }
+        return QString("%1/%2").arg(cell.wins + 0.5 * cell.draws, 0, 'f', 1).arg(games);
+    }
+    if (role == Qt::ToolTipRole && games > 0) {
+        return QString("+%1 =%2 -%3").arg(cell.wins).arg(cell.draws).arg(cell.losses);
+    }
+    if (role == Qt::TextAlignmentRole) {
+        return Qt::AlignCenter;
+    }
+    return {};
+}
+
+QVariant CrosstableModel::headerData(int section, Qt::Orientation, int role) const {
+    if (role != Qt::DisplayRole || section < 0 || section >= static_cast<int>(crosstable_.names.size())) {
+        return {};
+    }
+    return QString::fromStdString(crosstable_.names[static_cast<size_t>(section)]);
+}
+
+void CrosstableModel::setCrosstable(const ijccrl::core::api::CrosstableSnapshot& crosstable) {
+    beginResetModel();
+    crosstable_ = crosstable;
+    endResetModel();
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "ijccrl/core/api/RunnerService.h"
+
+#include <QAbstractTableModel>
+
+class CrosstableModel final : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    explicit CrosstableModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+    void setCrosstable(const ijccrl::core::api::CrosstableSnapshot& crosstable);
+
+private:
+    ijccrl::core::api::CrosstableSnapshot crosstable_{};
+};
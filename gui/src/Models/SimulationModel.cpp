@@ -0,0 +1,70 @@
+#include "Models/SimulationModel.h"
+
+SimulationModel::SimulationModel(QObject* parent)
+    : QAbstractTableModel(parent) {}
+
+int SimulationModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(simulation_.names.size());
+}
+
+// Expected points, then one column per final place.
+int SimulationModel::columnCount(const QModelIndex& parent) const {
+    if (parent.isValid() || simulation_.names.empty()) {
+        return 0;
+    }
+    return static_cast<int>(simulation_.names.size()) + 1;
+}
+
+QVariant SimulationModel::data(const QModelIndex& index, int role) const {
+    const size_t count = simulation_.names.size();
+    if (!index.isValid() || index.row() >= static_cast<int>(count) || index.column() > static_cast<int>(count) ||
+        simulation_.placeProbability.size() != count * count || simulation_.expectedPoints.size() != count) {
+        return {};
+    }
+    const auto row = static_cast<size_t>(index.row());
+    if (role == Qt::DisplayRole) {
+        if (index.column() == 0) {
+            return QString::number(simulation_.expectedPoints[row], 'f', 2);
+        }
+        const double probability = simulation_.placeProbability[row * count + static_cast<size_t>(index.column() - 1)];
+        if (probability == 0.0) {
+            return QString("-");
+        }
+        return QString("%1%").arg(probability * 100.0, 0, 'f', 1);
+    }
+    if (role == Qt::ToolTipRole) {
+        return QString("%1 simulations of %2 remaining games after %3 played")
+            .arg(simulation_.simulations)
+            .arg(simulation_.remainingGames)
+            .arg(simulation_.gamesPlayed);
+    }
+    if (role == Qt::TextAlignmentRole) {
+        return Qt::AlignCenter;
+    }
+    return {};
+}
+
+QVariant SimulationModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (role != Qt::DisplayRole || section < 0) {
+        return {};
+    }
+    if (orientation == Qt::Vertical) {
+        if (section >= static_cast<int>(simulation_.names.size())) {
+            return {};
+        }
+        return QString::fromStdString(simulation_.names[static_cast<size_t>(section)]);
+    }
+    if (section == 0) {
+        return QString("xPts");
+    }
+    return QString("P(#%1)").arg(section);
+}
+
+void SimulationModel::setSimulation(const ijccrl::core::api::SimulationSnapshot& simulation) {
+    beginResetModel();
+    simulation_ = simulation;
+    endResetModel();
+}
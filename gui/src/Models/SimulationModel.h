@@ -0,0 +1,22 @@
+#pragma once
+
+#include "ijccrl/core/api/RunnerService.h"
+
+#include <QAbstractTableModel>
+
+class SimulationModel final : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    explicit SimulationModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+    void setSimulation(const ijccrl::core::api::SimulationSnapshot& simulation);
+
+private:
+    ijccrl::core::api::SimulationSnapshot simulation_{};
+};
@@ -1,5 +1,8 @@
 #include "Models/StandingsModel.h"
 
+#include <algorithm>
+#include <limits>
+
 StandingsModel::StandingsModel(QObject* parent)
     : QAbstractTableModel(parent) {}
 
@@ -14,7 +17,7 @@ int StandingsModel::columnCount(const QModelIndex& parent) const {
     if (parent.isValid()) {
         return 0;
     }
-    return 7;
+    return 14;
 }
 
 QVariant StandingsModel::data(const QModelIndex& index, int role) const {
@@ -39,10 +42,49 @@ QVariant StandingsModel::data(const QModelIndex& index, int role) const {
                 return QString::number(row.points, 'f', 1);
             case 6:
                 return QString::number(row.scorePercent, 'f', 1) + "%";
+            case 7:
+                if (row.games == 0) {
+                    return QString("-");
+                }
+                return QString("%1 ± %2")
+                    .arg(row.elo, 0, 'f', 0)
+                    .arg(row.eloError, 0, 'f', 0);
+            case 8:
+                return QString::number(row.buchholz, 'f', 1);
+            case 9:
+                return QString::number(row.sonnebornBerger, 'f', 2);
+            case 10:
+                return QString::number(row.koya, 'f', 1);
+            case 11:
+                if (row.search.games == 0) {
+                    return QString("-");
+                }
+                return QString("%1 (%2)").arg(row.search.average_depth, 0, 'f', 1).arg(row.search.min_depth);
+            case 12:
+                if (row.search.games == 0) {
+                    return QString("-");
+                }
+                return QString::number(static_cast<double>(row.search.nps_p50) / 1000.0, 'f', 0);
+            case 13:
+                if (row.search.games == 0) {
+                    return QString("-");
+                }
+                return QString::number(row.search.time_usage() * 100.0, 'f', 0) + "%";
             default:
                 break;
         }
     }
+    if (role == Qt::ToolTipRole && index.column() >= 11 && row.search.games > 0) {
+        return QString("Depth avg %1, min %2\nkN/s p10 %3, p50 %4, p90 %5\nTime %6 s of %7 s, closest to timeout %8 ms")
+            .arg(row.search.average_depth, 0, 'f', 1)
+            .arg(row.search.min_depth)
+            .arg(row.search.nps_p10 / 1000)
+            .arg(row.search.nps_p50 / 1000)
+            .arg(row.search.nps_p90 / 1000)
+            .arg(row.search.time_used_seconds, 0, 'f', 1)
+            .arg(row.search.time_allotted_seconds, 0, 'f', 1)
+            .arg(row.search.min_margin_ms);
+    }
     return {};
 }
 
@@ -66,6 +108,20 @@ QVariant StandingsModel::headerData(int section, Qt::Orientation orientation, in
             return "Pts";
         case 6:
             return "Score";
+        case 7:
+            return "Elo";
+        case 8:
+            return "Bh";
+        case 9:
+            return "SB";
+        case 10:
+            return "Koya";
+        case 11:
+            return "Depth";
+        case 12:
+            return "kN/s";
+        case 13:
+            return "Time";
         default:
             break;
     }
@@ -75,5 +131,10 @@ QVariant StandingsModel::headerData(int section, Qt::Orientation orientation, in
 void StandingsModel::setStandings(const std::vector<ijccrl::core::api::StandingRow>& standings) {
     beginResetModel();
     standings_ = standings;
+    std::stable_sort(standings_.begin(), standings_.end(), [](const auto& a, const auto& b) {
+        const int a_rank = a.rank > 0 ? a.rank : std::numeric_limits<int>::max();
+        const int b_rank = b.rank > 0 ? b.rank : std::numeric_limits<int>::max();
+        return a_rank < b_rank;
+    });
     endResetModel();
 }
@@ -16,6 +16,8 @@ LiveGamePanel::LiveGamePanel(QWidget* parent)
     last_move_label_ = new QLabel("Last move: -", this);
     termination_label_ = new QLabel("Termination: -", this);
     tablebase_label_ = new QLabel("TB used: -", this);
+    sprt_label_ = new QLabel("SPRT: -", this);
+    sprt_label_->setVisible(false);
     live_pgn_label_ = new QLabel("Live PGN: -", this);
     tlcs_label_ = new QLabel("TLCS mode: -", this);
     pairings_list_ = new QListWidget(this);
@@ -32,6 +34,7 @@ LiveGamePanel::LiveGamePanel(QWidget* parent)
     layout->addWidget(last_move_label_);
     layout->addWidget(termination_label_);
     layout->addWidget(tablebase_label_);
+    layout->addWidget(sprt_label_);
     layout->addWidget(new QLabel("Current round pairings:", this));
     layout->addWidget(pairings_list_);
 
@@ -62,6 +65,15 @@ void LiveGamePanel::updateState(const ijccrl::core::api::RunnerState& state, boo
                                              ? QString("-")
                                              : QString::fromStdString(state.terminationReason)));
     tablebase_label_->setText(QString("TB used: %1").arg(state.tablebaseUsed ? "yes" : "-"));
+    sprt_label_->setVisible(state.sprtEnabled);
+    if (state.sprtEnabled) {
+        sprt_label_->setText(QString("SPRT: LLR %1 (%2, %3) | %4")
+                                 .arg(state.sprtLlr, 0, 'f', 2)
+                                 .arg(state.sprtLowerBound, 0, 'f', 2)
+                                 .arg(state.sprtUpperBound, 0, 'f', 2)
+                                 .arg(QString::fromStdString(state.sprtStatus.empty() ? "running"
+                                                                                      : state.sprtStatus)));
+    }
     live_pgn_label_->setText(QString("Live PGN: %1").arg(live_pgn_path_));
     if (tlcs_enabled) {
         tlcs_label_->setText("TLCS mode: writing TOURNEYPGN");
@@ -29,6 +29,7 @@ private:
     QLabel* last_move_label_ = nullptr;
     QLabel* termination_label_ = nullptr;
     QLabel* tablebase_label_ = nullptr;
+    QLabel* sprt_label_ = nullptr;
     QLabel* live_pgn_label_ = nullptr;
     QLabel* tlcs_label_ = nullptr;
     QListWidget* pairings_list_ = nullptr;
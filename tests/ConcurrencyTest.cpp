@@ -0,0 +1,84 @@
+// Modes where one engine plays every game must still run
+// tournament.concurrency games at once: a gauntlet with no gauntlet_engines
+// listed (engine 0 against everyone) and SPRT (always the first two engines).
+#include "ijccrl/core/api/RunnerService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv) {
+    using ijccrl::core::api::RunnerConfig;
+
+    const std::string mode = argc > 1 ? argv[1] : "gauntlet";
+    const std::filesystem::path out_dir = std::filesystem::current_path() / (mode + "_concurrency_out");
+    std::filesystem::remove_all(out_dir);
+
+    RunnerConfig config;
+    for (const char* name : {"Gauntlet", "OpponentA", "OpponentB", "OpponentC"}) {
+        ijccrl::core::api::EngineConfig engine;
+        engine.name = name;
+        engine.cmd = IJCCRL_FAKE_ENGINE;
+        engine.args = {"15"};
+        config.engines.push_back(engine);
+    }
+    config.tournament.mode = mode;
+    if (mode == "sprt") {
+        config.tournament.rounds = 6;
+    }
+    config.tournament.concurrency = 3;
+    config.time_control.move_time_ms = 15;
+    config.limits.max_plies = 20;
+    config.output.simulations = 0;
+    for (std::string* path : {&config.output.tournament_pgn,
+                              &config.output.live_pgn,
+                              &config.output.results_json,
+                              &config.output.pairings_csv,
+                              &config.output.checkpoint_json,
+                              &config.output.standings_csv,
+                              &config.output.standings_html,
+                              &config.output.crosstable_json,
+                              &config.output.crosstable_html,
+                              &config.output.summary_json,
+                              &config.output.metrics_json,
+                              &config.output.opening_stats,
+                              &config.output.games_dir}) {
+        *path = (out_dir / std::filesystem::path(*path).filename()).string();
+    }
+
+    const auto ids = ijccrl::core::api::ResolveGauntletEngines(config, nullptr);
+    if (mode == "gauntlet" && ids != std::vector<int>{0}) {
+        std::cerr << "expected engine 0 as the default gauntlet engine" << '\n';
+        return 1;
+    }
+
+    ijccrl::core::api::RunnerService service;
+    service.setConfig(config);
+    if (!service.start()) {
+        std::cerr << "runner did not start" << '\n';
+        return 1;
+    }
+    int peak_active = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+    while (std::chrono::steady_clock::now() < deadline) {
+        const auto state = service.getStateSnapshot();
+        peak_active = std::max(peak_active, state.activeGames);
+        if (!state.running && peak_active > 0) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    service.requestStop();
+    service.waitForFinish();
+    std::filesystem::remove_all(out_dir);
+
+    std::cout << "peak concurrent games: " << peak_active << '\n';
+    if (peak_active < 2) {
+        std::cerr << mode << " ran one game at a time" << '\n';
+        return 1;
+    }
+    return 0;
+}
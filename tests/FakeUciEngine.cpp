@@ -0,0 +1,40 @@
+// Minimal UCI engine for tests: shuffles a knight back and forth, sleeping
+// for the number of milliseconds given as the first argument on every move.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv) {
+    const int delay_ms = argc > 1 ? std::atoi(argv[1]) : 0;
+    int plies = 0;
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line == "uci") {
+            std::cout << "id name FakeUciEngine\nuciok" << std::endl;
+        } else if (line == "isready") {
+            std::cout << "readyok" << std::endl;
+        } else if (line.rfind("position", 0) == 0) {
+            plies = 0;
+            const auto moves = line.find(" moves ");
+            if (moves != std::string::npos) {
+                std::istringstream stream(line.substr(moves + 7));
+                std::string move;
+                while (stream >> move) {
+                    ++plies;
+                }
+            }
+        } else if (line.rfind("go", 0) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+            static const char* const kWhite[] = {"g1f3", "f3g1"};
+            static const char* const kBlack[] = {"g8f6", "f6g8"};
+            const char* move = (plies % 2 == 0 ? kWhite : kBlack)[(plies / 2) % 2];
+            std::cout << "bestmove " << move << std::endl;
+        } else if (line == "quit") {
+            break;
+        }
+    }
+    return 0;
+}